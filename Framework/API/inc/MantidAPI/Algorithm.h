@@ -182,6 +182,16 @@ public:
   /// Override if the algorithm is not part of the Mantid distribution.
   const std::string helpURL() const override { return ""; }
 
+  /// Whether, with the current property values, running on the sum of two
+  /// inputs gives the sum of the outputs for each input. Live data uses this to
+  /// post-process each new chunk instead of all the accumulated data.
+  virtual bool isChunkMergeable() const { return false; }
+
+  /// Whether the members of WorkspaceGroup inputs can be processed at the same
+  /// time. The base processGroups() then runs them concurrently if the
+  /// MultiThreaded.MaxConcurrentGroupMembers setting allows it.
+  virtual bool groupMembersAreIndependent() const { return false; }
+
   template <typename T, typename = typename std::enable_if<std::is_convertible<T *, MatrixWorkspace *>::value>::type>
   std::tuple<std::shared_ptr<T>, Indexing::SpectrumIndexSet> getWorkspaceAndIndices(const std::string &name) const;
 
@@ -461,6 +471,14 @@ private:
 
   bool doCallProcessGroups(Mantid::Types::Core::DateAndTime &start_time);
 
+  size_t numberOfConcurrentGroupMembers() const;
+
+  Algorithm_sptr setUpGroupMember(size_t entry, double startProgress, double endProgress,
+                                  std::vector<std::string> &outputWSNames);
+
+  void processGroupMembersConcurrently(const std::vector<std::shared_ptr<WorkspaceGroup>> &outGroups,
+                                       size_t numConcurrent);
+
   // Report that the algorithm has completed.
   void reportCompleted(const double &duration, const bool groupProcessing = false);
 
@@ -12,6 +12,7 @@
 #include "MantidAPI/ITableWorkspace_fwd.h"
 #include "MantidKernel/PropertyManager.h"
 #include "MantidKernel/System.h"
+#include <mutex>
 #include <vector>
 
 namespace Mantid {
@@ -41,6 +42,10 @@ protected:
   void copyProperty(const API::Algorithm_sptr &alg, const std::string &name);
   virtual ITableWorkspace_sptr determineChunk(const std::string &filename);
   virtual MatrixWorkspace_sptr loadChunk(const size_t rowIndex);
+  virtual MatrixWorkspace_sptr processChunk(const MatrixWorkspace_sptr &chunk, const size_t rowIndex);
+  virtual MatrixWorkspace_sptr accumulateChunk(const MatrixWorkspace_sptr &accumulated, const MatrixWorkspace_sptr &chunk,
+                                               const size_t rowIndex);
+  MatrixWorkspace_sptr processChunks(const size_t numChunks, const size_t memoryBudget);
   Workspace_sptr load(const std::string &inputData, const bool loadQuiet = false);
   std::vector<std::string> splitInput(const std::string &input);
   void forwardProperties();
@@ -101,6 +106,8 @@ private:
   std::string m_propertyManagerPropertyName;
   /// Map property names to names in supplied properties manager
   std::map<std::string, std::string> m_nameToPMName;
+  /// Child algorithms may be created by the thread loading chunks
+  std::mutex m_childAlgorithmMutex;
 
   // This method is a workaround for the C4661 compiler warning in visual
   // studio. This allows the template declaration and definition to be separated
@@ -9,7 +9,6 @@
 #include "MantidAPI/DllConfig.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
-#include "MantidGeometry/Objects/InstrumentRayTracer.h"
 #include "MantidKernel/NearestNeighbours.h"
 #include "MantidKernel/V3D.h"
 
@@ -22,13 +21,18 @@
   This class solves the problem of finding a detector given a Qlab vector. Two
   search strategies are used depending on the instrument's geometry.
 
-  1) For rectangular detector geometries the InstrumentRayTracer class is used
-  to recursively search the instrument tree.
+  1) For rectangular detector geometries the direction of the scattered beam
+  is looked up in a table, built once, of the detectors that could lie in
+  each range of polar and azimuthal angle. Only those candidates are checked
+  for intersection, rather than ray tracing through the instrument tree.
 
   2) For geometries which do not use rectangular detectors ray tracing to every
   component is very expensive. In this case it is quicker to use a
   NearestNeighbours search to find likely detector positions.
 
+  Searches do not modify the searcher, so one searcher may be shared by
+  several threads.
+
   @author Samuel Jackson
   @date 2017
 */
@@ -45,13 +49,13 @@ public:
   /// Create a new DetectorSearcher with the given instrument & detectors
   DetectorSearcher(const Geometry::Instrument_const_sptr &instrument, const Geometry::DetectorInfo &detInfo);
   /// Find a detector that intsects with the given Qlab vector
-  DetectorSearchResult findDetectorIndex(const Kernel::V3D &q);
+  DetectorSearchResult findDetectorIndex(const Kernel::V3D &q) const;
 
 private:
-  /// Attempt to find a detector using a full instrument ray tracing strategy
-  DetectorSearchResult searchUsingInstrumentRayTracing(const Kernel::V3D &q);
+  /// Attempt to find a detector using the table of detector directions
+  DetectorSearchResult searchUsingDirectionLookup(const Kernel::V3D &q) const;
   /// Attempt to find a detector using a nearest neighbours search strategy
-  DetectorSearchResult searchUsingNearestNeighbours(const Kernel::V3D &q);
+  DetectorSearchResult searchUsingNearestNeighbours(const Kernel::V3D &q) const;
   /// Check whether the given direction in detector space intercepts with a
   /// detector
   std::tuple<bool, size_t>
@@ -59,16 +63,20 @@ private:
                               const Kernel::NearestNeighbours<3>::NearestNeighbourResults &neighbours) const;
   /// Helper function to build the nearest neighbour tree
   void createDetectorCache();
+  /// Helper function to build the table of detector directions
+  void createDirectionLookup();
+  /// Helper function to get the angles of a direction about the beam
+  std::tuple<double, double> polarAndAzimuth(const Kernel::V3D &direction) const;
   /// Helper function to convert a Qlab vector to a direction in detector space
   Kernel::V3D convertQtoDirection(const Kernel::V3D &q) const;
   /// Helper function to handle the tube gap parameter in tube instruments
   DetectorSearchResult handleTubeGap(const Kernel::V3D &detectorDir,
-                                     const Kernel::NearestNeighbours<3>::NearestNeighbourResults &neighbours);
+                                     const Kernel::NearestNeighbours<3>::NearestNeighbourResults &neighbours) const;
 
   // Instance variables
 
-  /// flag for whether to use InstrumentRayTracer or NearestNeighbours
-  const bool m_usingFullRayTrace;
+  /// flag for whether to use the direction table or NearestNeighbours
+  const bool m_usingDirectionLookup;
   /// flag for whether the crystallography convention is to be used
   const double m_crystallography_convention;
   /// detector info for the instrument
@@ -79,8 +87,16 @@ private:
   std::vector<size_t> m_indexMap;
   /// Detector search cache for fast look-up of detectors
   std::unique_ptr<Kernel::NearestNeighbours<3>> m_detectorCacheSearch;
-  /// instrument ray tracer object for searching in rectangular detectors
-  std::unique_ptr<Geometry::InstrumentRayTracer> m_rayTracer;
+  /// number of polar angle bins in the direction table
+  size_t m_numPolarBins{0};
+  /// number of azimuthal angle bins in the direction table
+  size_t m_numAzimuthalBins{0};
+  /// start of each bin's detector indices in m_binnedDetectors
+  std::vector<size_t> m_binOffsets;
+  /// indices of the detectors that could be hit by a direction in each bin
+  std::vector<size_t> m_binnedDetectors;
+  /// indices of detectors so close to the sample they are checked for every direction
+  std::vector<size_t> m_detectorsAroundSample;
 };
 } // namespace API
 } // namespace Mantid
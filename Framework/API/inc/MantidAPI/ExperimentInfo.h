@@ -17,6 +17,7 @@
 #include "MantidKernel/V3D.h"
 #include "MantidKernel/cow_ptr.h"
 
+#include <atomic>
 #include <mutex>
 
 namespace Mantid {
@@ -40,6 +41,7 @@ class XMLInstrumentParameter;
 namespace API {
 class Run;
 class Sample;
+class SpectrumGeometry;
 class SpectrumInfo;
 
 /** This class is shared by a few Workspace types
@@ -164,6 +166,8 @@ public:
   const Geometry::ComponentInfo &componentInfo() const;
   Geometry::ComponentInfo &mutableComponentInfo();
 
+  std::shared_ptr<const SpectrumGeometry> spectrumGeometry(const bool withSolidAngles = false) const;
+
   void invalidateSpectrumDefinition(const size_t index);
   void updateSpectrumDefinitionIfNecessary(const size_t index) const;
 
@@ -214,6 +218,14 @@ private:
   // This vector stores boolean flags but uses char to do so since
   // std::vector<bool> is not thread-safe.
   mutable std::vector<char> m_spectrumDefinitionNeedsUpdate;
+
+  void invalidateSpectrumGeometry() const;
+  mutable std::shared_ptr<const SpectrumGeometry> m_spectrumGeometry;
+  mutable std::mutex m_spectrumGeometryMutex;
+  // Cleared by any change that affects the cached SpectrumGeometry, including the
+  // const grouping updates of MD workspaces. Atomic since spectrum definitions may
+  // be invalidated from several threads.
+  mutable std::atomic<bool> m_spectrumGeometryIsValid{false};
 };
 
 /// Shared pointer to ExperimentInfo
@@ -0,0 +1,77 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/DllConfig.h"
+#include "MantidGeometry/IDTypes.h"
+#include "MantidKernel/V3D.h"
+
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Mantid {
+namespace API {
+
+/** NeighbourGraph : the nearest neighbours of a set of spectra, found with a
+  k-d tree search over their detector positions. Each spectrum's neighbours
+  are stored as one row in compressed sparse row form.
+
+  Graphs are built in parallel and kept in a process-wide cache, so
+  algorithms run one after another over the same instrument share the search
+  rather than repeating it. Use nearest() or enclosing() to get a graph. The
+  least recently used graphs are dropped when the cache would use more memory
+  than its limit, and the cache is emptied with the analysis data service by
+  FrameworkManager::clearData().
+*/
+class MANTID_API_DLL NeighbourGraph {
+public:
+  /// The most memory, in bytes, the cached graphs use unless setCacheLimit() is called
+  static constexpr size_t DEFAULT_CACHE_LIMIT = 256 * 1024 * 1024;
+
+  /// The spectra a graph is built over
+  struct Points {
+    std::vector<specnum_t> spectra;
+    /// Detector position of each spectrum
+    std::vector<Kernel::V3D> positions;
+    /// Positions are divided by this before the search
+    Kernel::V3D scale;
+    bool operator==(const Points &other) const;
+  };
+
+  static std::shared_ptr<const NeighbourGraph> nearest(const std::shared_ptr<const Points> &points,
+                                                       int nNeighbours);
+  static std::shared_ptr<const NeighbourGraph> enclosing(const std::shared_ptr<const Points> &points, double radius,
+                                                         int minNeighbours);
+  static void clearCache();
+  static void setCacheLimit(size_t bytes);
+
+  NeighbourGraph(std::shared_ptr<const Points> points, int nNeighbours);
+
+  /// @return the number of neighbours found for each spectrum
+  int numberOfNeighbours() const { return m_nNeighbours; }
+  /// @return the largest distance from any spectrum to one of its neighbours
+  double cutoff() const { return m_cutoff; }
+  std::map<specnum_t, Kernel::V3D> neighbours(specnum_t spectrum) const;
+  size_t getMemorySize() const;
+
+private:
+  std::shared_ptr<const Points> m_points;
+  int m_nNeighbours;
+  /// Start of each spectrum's row in m_neighbours
+  std::vector<size_t> m_offsets;
+  /// Index into m_points of each neighbour
+  std::vector<size_t> m_neighbours;
+  /// Position of each neighbour relative to the spectrum
+  std::vector<Kernel::V3D> m_displacements;
+  std::unordered_map<specnum_t, size_t> m_rowOfSpectrum;
+  double m_cutoff;
+};
+
+} // namespace API
+} // namespace Mantid
@@ -0,0 +1,76 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/DllConfig.h"
+
+#include <vector>
+
+namespace Mantid {
+namespace Geometry {
+class ComponentInfo;
+}
+namespace API {
+class SpectrumInfo;
+
+/** SpectrumGeometry : Immutable per-spectrum arrays of the geometry values
+  that unit conversion, focussing and normalisation need for every spectrum.
+
+  Filling these from SpectrumInfo walks the SpectrumDefinition and the
+  DetectorInfo of each spectrum, which is repeated by every algorithm that
+  needs them. A SpectrumGeometry is computed once, in parallel, and is
+  normally obtained from ExperimentInfo::spectrumGeometry(), which caches it
+  until the instrument, the DetectorInfo, the ComponentInfo or the spectrum
+  definitions change. The object itself never changes, so it can be shared by
+  any number of threads and outlives the cache entry it came from.
+
+  Values are NaN where they are undefined: all values for spectra without
+  detectors, and the angles and diffractometer constants of monitors. DIFA
+  and TZERO are 0 for spectra without calibration, as in
+  SpectrumInfo::diffractometerConstants().
+*/
+class MANTID_API_DLL SpectrumGeometry {
+public:
+  SpectrumGeometry(const SpectrumInfo &spectrumInfo, const Geometry::ComponentInfo *componentInfo = nullptr);
+
+  /// @return the number of spectra
+  size_t size() const { return m_l2.size(); }
+  /// @return the distance from the source to the sample
+  double l1() const { return m_l1; }
+  /// @return true if solid angles were computed
+  bool hasSolidAngles() const { return !m_solidAngle.empty(); }
+  /// @return true if the spectrum has at least one detector
+  bool hasDetectors(const size_t index) const { return m_hasDetectors[index] != 0; }
+  /// @return true if all the detectors of the spectrum are monitors
+  bool isMonitor(const size_t index) const { return m_isMonitor[index] != 0; }
+
+  const std::vector<double> &l2() const { return m_l2; }
+  const std::vector<double> &twoTheta() const { return m_twoTheta; }
+  const std::vector<double> &signedTwoTheta() const { return m_signedTwoTheta; }
+  const std::vector<double> &azimuthal() const { return m_azimuthal; }
+  const std::vector<double> &difa() const { return m_difa; }
+  const std::vector<double> &difc() const { return m_difc; }
+  const std::vector<double> &tzero() const { return m_tzero; }
+  const std::vector<double> &solidAngle() const;
+
+private:
+  double m_l1;
+  std::vector<double> m_l2;
+  std::vector<double> m_twoTheta;
+  std::vector<double> m_signedTwoTheta;
+  std::vector<double> m_azimuthal;
+  std::vector<double> m_difa;
+  std::vector<double> m_difc;
+  std::vector<double> m_tzero;
+  std::vector<double> m_solidAngle;
+  // Flags are stored as char, see ExperimentInfo::m_spectrumDefinitionNeedsUpdate
+  std::vector<char> m_hasDetectors;
+  std::vector<char> m_isMonitor;
+};
+
+} // namespace API
+} // namespace Mantid
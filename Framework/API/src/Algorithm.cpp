@@ -20,9 +20,11 @@
 #include "MantidKernel/CompositeValidator.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/EmptyValues.h"
+#include "MantidKernel/FunctionTask.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/PropertyWithValue.h"
 #include "MantidKernel/Strings.h"
+#include "MantidKernel/ThreadPool.h"
 #include "MantidKernel/Timer.h"
 #include "MantidKernel/UsageService.h"
 
@@ -40,6 +42,7 @@
 #include <iterator>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 // Index property handling template definitions
@@ -79,6 +82,27 @@ private:
   T m_onfinsh;
 };
 
+/// Execute the child algorithm for one member of the input group(s)
+void executeGroupMember(IAlgorithm &alg, const std::string &name, const size_t entry) {
+  try {
+    alg.execute();
+  } catch (std::exception &e) {
+    std::ostringstream msg;
+    msg << "Execution of " << name << " for group entry " << (entry + 1) << " failed: ";
+    msg << e.what(); // Add original message
+    throw std::runtime_error(msg.str());
+  }
+}
+
+/// Add the outputs of one member to the output groups
+void addToOutputGroups(const std::vector<WorkspaceGroup_sptr> &outGroups,
+                       const std::vector<std::string> &outputWSNames) {
+  for (size_t owp = 0; owp < outputWSNames.size(); owp++) {
+    if (!outputWSNames[owp].empty())
+      outGroups[owp]->add(outputWSNames[owp]);
+  }
+}
+
 } // namespace
 
 // Doxygen can't handle member specialization at the moment:
@@ -1397,139 +1421,213 @@ bool Algorithm::processGroups() {
     }
   }
 
-  double progress_proportion = 1.0 / static_cast<double>(m_groupSize);
-  // Go through each entry in the input group(s)
-  for (size_t entry = 0; entry < m_groupSize; entry++) {
-    // use create Child Algorithm that look like this one
-    Algorithm_sptr alg_sptr = this->createChildAlgorithm(this->name(), progress_proportion * static_cast<double>(entry),
-                                                         progress_proportion * (1 + static_cast<double>(entry)),
-                                                         this->isLogging(), this->version());
-    // Make a child algorithm and turn off history recording for it, but always
-    // store result in the ADS
-    alg_sptr->setChild(true);
-    alg_sptr->setAlwaysStoreInADS(true);
-    alg_sptr->enableHistoryRecordingForChild(false);
-    alg_sptr->setRethrows(true);
-
-    Algorithm *alg = alg_sptr.get();
-    // Set all non-workspace properties
-    this->copyNonWorkspaceProperties(alg, int(entry) + 1);
-
-    std::string outputBaseName;
-
-    // ---------- Set all the input workspaces ----------------------------
-    for (size_t iwp = 0; iwp < m_unrolledInputWorkspaces.size(); iwp++) {
-      const std::vector<Workspace_sptr> &thisGroup = m_unrolledInputWorkspaces[iwp];
-      if (!thisGroup.empty()) {
-        // By default (for a single group) point to the first/only workspace
-        Workspace_sptr ws = thisGroup[0];
-
-        if ((m_singleGroup == int(iwp)) || m_singleGroup < 0) {
-          // Either: this is the single group
-          // OR: all inputs are groups
-          // ... so get then entry^th workspace in this group
-          if (entry < thisGroup.size()) {
-            ws = thisGroup[entry];
-          } else {
-            // This can happen when one has more than one input group
-            // workspaces, having different sizes. For example one workspace
-            // group is the corrections which has N parts (e.g. weights for
-            // polarized measurement) while the other one is the actual input
-            // workspace group, where each item needs to be corrected together
-            // with all N inputs of the second group. In this case processGroup
-            // needs to be overridden, which is currently not possible in
-            // python.
-            throw std::runtime_error("Unable to process over groups; consider passing workspaces "
-                                     "one-by-one or override processGroup method of the algorithm.");
-          }
-        }
-        // Append the names together
-        if (!outputBaseName.empty())
-          outputBaseName += "_";
-        outputBaseName += ws->getName();
-
-        // Set the property using the name of that workspace
-        if (auto *prop = dynamic_cast<Property *>(m_inputWorkspaceProps[iwp])) {
-          if (ws->getName().empty()) {
-            alg->setProperty(prop->name(), ws);
-          } else {
-            alg->setPropertyValue(prop->name(), ws->getName());
-          }
+  const size_t numConcurrent = numberOfConcurrentGroupMembers();
+  if (numConcurrent > 1) {
+    processGroupMembersConcurrently(outGroups, numConcurrent);
+  } else {
+    double progress_proportion = 1.0 / static_cast<double>(m_groupSize);
+    // Go through each entry in the input group(s)
+    for (size_t entry = 0; entry < m_groupSize; entry++) {
+      std::vector<std::string> outputWSNames;
+      auto alg = setUpGroupMember(entry, progress_proportion * static_cast<double>(entry),
+                                  progress_proportion * (1 + static_cast<double>(entry)), outputWSNames);
+      executeGroupMember(*alg, this->name(), entry);
+      // this has to be done after execute() because a workspace must exist
+      // when it is added to a group
+      addToOutputGroups(outGroups, outputWSNames);
+    }
+  }
+
+  // restore group notifications
+  for (auto &outGroup : outGroups) {
+    outGroup->observeADSNotifications(true);
+  }
+
+  return true;
+}
+
+/** The number of group members to run at the same time. Members are only run
+ * concurrently if the algorithm declares them independent and the
+ * MultiThreaded.MaxConcurrentGroupMembers setting is more than one.
+ *
+ * @return the number of members, 1 if they are run one by one
+ */
+size_t Algorithm::numberOfConcurrentGroupMembers() const {
+  if (m_groupSize < 2 || !groupMembersAreIndependent())
+    return 1;
+  const auto maxMembers = ConfigService::Instance().getValue<int>("MultiThreaded.MaxConcurrentGroupMembers");
+  if (maxMembers.get_value_or(1) < 2)
+    return 1;
+  return std::min(m_groupSize, static_cast<size_t>(maxMembers.get()));
+}
+
+/** Create and set up the child algorithm for one member of the group(s).
+ *
+ * @param entry :: the index of the member
+ * @param startProgress :: progress of this algorithm when the child starts,
+ * or -1 if the child does not report progress
+ * @param endProgress :: progress of this algorithm when the child finishes
+ * @param outputWSNames :: set to the name of each output of the child, empty
+ * for unused outputs
+ * @return the child algorithm
+ */
+Algorithm_sptr Algorithm::setUpGroupMember(const size_t entry, const double startProgress, const double endProgress,
+                                           std::vector<std::string> &outputWSNames) {
+  // use create Child Algorithm that look like this one
+  Algorithm_sptr alg_sptr =
+      this->createChildAlgorithm(this->name(), startProgress, endProgress, this->isLogging(), this->version());
+  // Make a child algorithm and turn off history recording for it, but always
+  // store result in the ADS
+  alg_sptr->setChild(true);
+  alg_sptr->setAlwaysStoreInADS(true);
+  alg_sptr->enableHistoryRecordingForChild(false);
+  alg_sptr->setRethrows(true);
+
+  Algorithm *alg = alg_sptr.get();
+  // Set all non-workspace properties
+  this->copyNonWorkspaceProperties(alg, int(entry) + 1);
+
+  std::string outputBaseName;
+
+  // ---------- Set all the input workspaces ----------------------------
+  for (size_t iwp = 0; iwp < m_unrolledInputWorkspaces.size(); iwp++) {
+    const std::vector<Workspace_sptr> &thisGroup = m_unrolledInputWorkspaces[iwp];
+    if (!thisGroup.empty()) {
+      // By default (for a single group) point to the first/only workspace
+      Workspace_sptr ws = thisGroup[0];
+
+      if ((m_singleGroup == int(iwp)) || m_singleGroup < 0) {
+        // Either: this is the single group
+        // OR: all inputs are groups
+        // ... so get then entry^th workspace in this group
+        if (entry < thisGroup.size()) {
+          ws = thisGroup[entry];
         } else {
-          throw std::logic_error("Found a Workspace property which doesn't "
-                                 "inherit from Property.");
+          // This can happen when one has more than one input group
+          // workspaces, having different sizes. For example one workspace
+          // group is the corrections which has N parts (e.g. weights for
+          // polarized measurement) while the other one is the actual input
+          // workspace group, where each item needs to be corrected together
+          // with all N inputs of the second group. In this case processGroup
+          // needs to be overridden, which is currently not possible in
+          // python.
+          throw std::runtime_error("Unable to process over groups; consider passing workspaces "
+                                   "one-by-one or override processGroup method of the algorithm.");
         }
-      } // not an empty (i.e. optional) input
-    }   // for each InputWorkspace property
-
-    std::vector<std::string> outputWSNames(m_pureOutputWorkspaceProps.size());
-    // ---------- Set all the output workspaces ----------------------------
-    for (size_t owp = 0; owp < m_pureOutputWorkspaceProps.size(); owp++) {
-      if (auto *prop = dynamic_cast<Property *>(m_pureOutputWorkspaceProps[owp])) {
-        // Default name = "in1_in2_out"
-        const std::string inName = prop->value();
-        if (inName.empty())
-          continue;
-        std::string outName;
-        if (m_groupsHaveSimilarNames) {
-          outName.append(inName).append("_").append(Strings::toString(entry + 1));
+      }
+      // Append the names together
+      if (!outputBaseName.empty())
+        outputBaseName += "_";
+      outputBaseName += ws->getName();
+
+      // Set the property using the name of that workspace
+      if (auto *prop = dynamic_cast<Property *>(m_inputWorkspaceProps[iwp])) {
+        if (ws->getName().empty()) {
+          alg->setProperty(prop->name(), ws);
         } else {
-          outName.append(outputBaseName).append("_").append(inName);
-        }
-
-        auto inputProp =
-            std::find_if(m_inputWorkspaceProps.begin(), m_inputWorkspaceProps.end(), WorkspacePropertyValueIs(inName));
-
-        // Overwrite workspaces in any input property if they have the same
-        // name as an output (i.e. copy name button in algorithm dialog used)
-        // (only need to do this for a single input, multiple will be handled
-        // by ADS)
-        if (inputProp != m_inputWorkspaceProps.end()) {
-          const auto &inputGroup = m_unrolledInputWorkspaces[inputProp - m_inputWorkspaceProps.begin()];
-          if (!inputGroup.empty())
-            outName = inputGroup[entry]->getName();
+          alg->setPropertyValue(prop->name(), ws->getName());
         }
-        // Except if all inputs had similar names, then the name is "out_1"
-
-        // Set in the output
-        alg->setPropertyValue(prop->name(), outName);
-
-        outputWSNames[owp] = outName;
       } else {
         throw std::logic_error("Found a Workspace property which doesn't "
                                "inherit from Property.");
       }
-    } // for each OutputWorkspace property
+    } // not an empty (i.e. optional) input
+  }   // for each InputWorkspace property
+
+  outputWSNames.assign(m_pureOutputWorkspaceProps.size(), "");
+  // ---------- Set all the output workspaces ----------------------------
+  for (size_t owp = 0; owp < m_pureOutputWorkspaceProps.size(); owp++) {
+    if (auto *prop = dynamic_cast<Property *>(m_pureOutputWorkspaceProps[owp])) {
+      // Default name = "in1_in2_out"
+      const std::string inName = prop->value();
+      if (inName.empty())
+        continue;
+      std::string outName;
+      if (m_groupsHaveSimilarNames) {
+        outName.append(inName).append("_").append(Strings::toString(entry + 1));
+      } else {
+        outName.append(outputBaseName).append("_").append(inName);
+      }
 
-    // ------------ Execute the algo --------------
-    try {
-      alg->execute();
-    } catch (std::exception &e) {
-      std::ostringstream msg;
-      msg << "Execution of " << this->name() << " for group entry " << (entry + 1) << " failed: ";
-      msg << e.what(); // Add original message
-      throw std::runtime_error(msg.str());
-    }
+      auto inputProp =
+          std::find_if(m_inputWorkspaceProps.begin(), m_inputWorkspaceProps.end(), WorkspacePropertyValueIs(inName));
+
+      // Overwrite workspaces in any input property if they have the same
+      // name as an output (i.e. copy name button in algorithm dialog used)
+      // (only need to do this for a single input, multiple will be handled
+      // by ADS)
+      if (inputProp != m_inputWorkspaceProps.end()) {
+        const auto &inputGroup = m_unrolledInputWorkspaces[inputProp - m_inputWorkspaceProps.begin()];
+        if (!inputGroup.empty())
+          outName = inputGroup[entry]->getName();
+      }
+      // Except if all inputs had similar names, then the name is "out_1"
 
-    // ------------ Fill in the output workspace group ------------------
-    // this has to be done after execute() because a workspace must exist
-    // when it is added to a group
-    for (size_t owp = 0; owp < m_pureOutputWorkspaceProps.size(); owp++) {
-      auto *prop = dynamic_cast<Property *>(m_pureOutputWorkspaceProps[owp]);
-      if (prop && prop->value().empty())
-        continue;
-      // And add it to the output group
-      outGroups[owp]->add(outputWSNames[owp]);
+      // Set in the output
+      alg->setPropertyValue(prop->name(), outName);
+
+      outputWSNames[owp] = outName;
+    } else {
+      throw std::logic_error("Found a Workspace property which doesn't "
+                             "inherit from Property.");
     }
+  } // for each OutputWorkspace property
 
-  } // for each entry in each group
+  return alg_sptr;
+}
 
-  // restore group notifications
-  for (auto &outGroup : outGroups) {
-    outGroup->observeADSNotifications(true);
+/** Run the child algorithms for the members of the group(s) on a bounded pool
+ * of threads. The children are set up in order on this thread before any of
+ * them runs. Progress is reported as the leading members finish, so it always
+ * goes through the same values, and the outputs are added to the output
+ * groups in order once every member has finished.
+ *
+ * @param outGroups :: the output group of each output workspace property
+ * @param numConcurrent :: the number of members to run at the same time
+ * @throw std::runtime_error for the first member that failed
+ */
+void Algorithm::processGroupMembersConcurrently(const std::vector<WorkspaceGroup_sptr> &outGroups,
+                                                const size_t numConcurrent) {
+  std::vector<Algorithm_sptr> members(m_groupSize);
+  std::vector<std::vector<std::string>> outputWSNames(m_groupSize);
+  for (size_t entry = 0; entry < m_groupSize; entry++) {
+    // the children run at once, so this algorithm reports their progress
+    members[entry] = setUpGroupMember(entry, -1., -1., outputWSNames[entry]);
   }
 
-  return true;
+  // Share the cores out between the members that run at the same time
+  const int coresPerMember = std::max(1, static_cast<int>(PARALLEL_GET_MAX_THREADS) / static_cast<int>(numConcurrent));
+  std::vector<std::string> errors(m_groupSize);
+  std::vector<bool> finished(m_groupSize, false);
+  size_t numLeadingFinished = 0;
+  std::mutex finishedMutex;
+
+  ThreadPool pool(new ThreadSchedulerFIFO(), numConcurrent);
+  for (size_t entry = 0; entry < m_groupSize; entry++) {
+    pool.schedule(std::make_shared<FunctionTask>([&, entry]() {
+      PARALLEL_SET_NUM_THREADS(coresPerMember);
+      if (!m_cancel) {
+        try {
+          executeGroupMember(*members[entry], this->name(), entry);
+        } catch (std::exception &e) {
+          errors[entry] = e.what();
+        }
+      }
+      std::lock_guard<std::mutex> lock(finishedMutex);
+      finished[entry] = true;
+      for (; numLeadingFinished < m_groupSize && finished[numLeadingFinished]; numLeadingFinished++)
+        progress(static_cast<double>(numLeadingFinished + 1) / static_cast<double>(m_groupSize));
+    }));
+  }
+  pool.joinAll();
+  interruption_point();
+
+  const auto failure = std::find_if(errors.cbegin(), errors.cend(), [](const auto &error) { return !error.empty(); });
+  if (failure != errors.cend())
+    throw std::runtime_error(*failure);
+
+  for (const auto &names : outputWSNames)
+    addToOutputGroups(outGroups, names);
 }
 
 //--------------------------------------------------------------------------------------------
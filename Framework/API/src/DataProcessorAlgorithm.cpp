@@ -5,12 +5,14 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAPI/DataProcessorAlgorithm.h"
+#include "MantidAPI/AlgorithmHistory.h"
 #include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/AlgorithmProperty.h"
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/FileFinder.h"
 #include "MantidAPI/IEventWorkspace.h"
 #include "MantidAPI/ITableWorkspace.h"
+#include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/FacilityInfo.h"
@@ -18,7 +20,14 @@
 #include "MantidKernel/PropertyManagerDataService.h"
 #include "MantidKernel/System.h"
 #include "Poco/Path.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
 #include <stdexcept>
+#include <thread>
 #include <utility>
 
 using namespace Mantid::Kernel;
@@ -26,6 +35,130 @@ using namespace Mantid::API;
 
 namespace Mantid::API {
 
+namespace {
+/// Collects the history of the child algorithms that the owning algorithm
+/// creates on a chunk loading thread
+struct ChunkLoadHistory {
+  const void *owner{nullptr};
+  AlgorithmHistory_sptr history;
+};
+/// Other algorithms run by loadChunk on the same thread, e.g. a nested
+/// DataProcessorAlgorithm, keep their children in their own history
+thread_local ChunkLoadHistory g_chunkLoadHistory;
+
+/// A chunk loaded ahead of the one being processed
+struct LoadedChunk {
+  MatrixWorkspace_sptr workspace;
+  AlgorithmHistory_sptr history;
+  std::exception_ptr error;
+};
+
+/** Loads chunks in order on a separate thread, keeping no more than a given
+ * number loaded and waiting to be taken. With none allowed, each chunk is only
+ * loaded once it is asked for.
+ */
+class ChunkLoader {
+public:
+  ChunkLoader(const void *owner, std::function<MatrixWorkspace_sptr(size_t)> load, const size_t firstChunk,
+              const size_t numChunks, const size_t maxLoaded)
+      : m_owner(owner), m_load(std::move(load)), m_nextChunk(firstChunk), m_numChunks(numChunks),
+        m_maxLoaded(maxLoaded), m_thread([this] { run(); }) {}
+
+  ~ChunkLoader() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_changed.notify_all();
+    m_thread.join();
+  }
+
+  /// Change the number of chunks that may be loaded ahead, which may be none
+  void setMaxLoaded(const size_t maxLoaded) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_maxLoaded = maxLoaded;
+    }
+    m_changed.notify_all();
+  }
+
+  /// Wait for the next chunk to be loaded and take it
+  LoadedChunk take() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_waiting = true;
+    m_changed.notify_all();
+    m_changed.wait(lock, [this] { return !m_loaded.empty(); });
+    m_waiting = false;
+    auto chunk = std::move(m_loaded.front());
+    m_loaded.pop_front();
+    lock.unlock();
+    m_changed.notify_all();
+    return chunk;
+  }
+
+private:
+  void run() {
+    for (; m_nextChunk < m_numChunks; ++m_nextChunk) {
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // a chunk that is waited for is always loaded, whatever the limit
+        m_changed.wait(lock, [this] { return m_stop || m_loaded.size() < std::max<size_t>(m_waiting, m_maxLoaded); });
+        if (m_stop)
+          return;
+      }
+      LoadedChunk chunk;
+      chunk.history = std::make_shared<AlgorithmHistory>("LoadChunk", 1, "");
+      g_chunkLoadHistory = {m_owner, chunk.history};
+      try {
+        chunk.workspace = m_load(m_nextChunk);
+      } catch (...) {
+        chunk.error = std::current_exception();
+      }
+      g_chunkLoadHistory = {};
+      const bool failed = static_cast<bool>(chunk.error);
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_loaded.emplace_back(std::move(chunk));
+      }
+      m_changed.notify_all();
+      if (failed)
+        return;
+    }
+  }
+
+  /// The algorithm the chunks are loaded for
+  const void *m_owner;
+  std::function<MatrixWorkspace_sptr(size_t)> m_load;
+  size_t m_nextChunk;
+  const size_t m_numChunks;
+  size_t m_maxLoaded;
+  /// Whether take is waiting for a chunk
+  bool m_waiting{false};
+  bool m_stop{false};
+  std::deque<LoadedChunk> m_loaded;
+  std::mutex m_mutex;
+  std::condition_variable m_changed;
+  /// Started last, once the other members are constructed
+  std::thread m_thread;
+};
+
+/**
+ * The number of chunks that fit in a memory budget besides the output and the
+ * chunk being processed
+ * @param memoryBudget :: the budget in bytes, or 0 for no loading ahead
+ * @param chunkSize :: the memory used by a chunk in bytes
+ * @param outputSize :: the memory used by the accumulated output in bytes
+ */
+size_t chunksAhead(const size_t memoryBudget, const size_t chunkSize, const size_t outputSize) {
+  if (memoryBudget == 0)
+    return 0;
+  const size_t inUse = outputSize + chunkSize;
+  if (inUse >= memoryBudget)
+    return 0;
+  return chunkSize == 0 ? 1 : (memoryBudget - inUse) / chunkSize;
+}
+} // namespace
+
 //----------------------------------------------------------------------------------------------
 /** Constructor
  */
@@ -62,12 +195,15 @@ std::shared_ptr<Algorithm>
 GenericDataProcessorAlgorithm<Base>::createChildAlgorithm(const std::string &name, const double startProgress,
                                                           const double endProgress, const bool enableLogging,
                                                           const int &version) {
+  std::lock_guard<std::mutex> lock(m_childAlgorithmMutex);
   // call parent method to create the child algorithm
   auto alg = Algorithm::createChildAlgorithm(name, startProgress, endProgress, enableLogging, version);
   alg->enableHistoryRecordingForChild(this->isRecordingHistoryForChild());
   if (this->isRecordingHistoryForChild()) {
-    // pass pointer to the history object created in Algorithm to the child
-    alg->trackAlgorithmHistory(Base::m_history);
+    // pass pointer to the history object created in Algorithm to the child,
+    // or to the one of the chunk when it is loaded by processChunks
+    const bool loadingChunk = g_chunkLoadHistory.owner == this && g_chunkLoadHistory.history;
+    alg->trackAlgorithmHistory(loadingChunk ? g_chunkLoadHistory.history : Base::m_history);
   }
   return alg;
 }
@@ -199,6 +335,108 @@ template <class Base> MatrixWorkspace_sptr GenericDataProcessorAlgorithm<Base>::
   throw std::runtime_error("DataProcessorAlgorithm::loadChunk is not implemented");
 }
 
+/**
+ * Process a chunk loaded by loadChunk before it is accumulated. The default
+ * returns the chunk unchanged.
+ * @param chunk :: the loaded chunk
+ * @param rowIndex :: the index of the chunk
+ * @return the processed chunk
+ */
+template <class Base>
+MatrixWorkspace_sptr GenericDataProcessorAlgorithm<Base>::processChunk(const MatrixWorkspace_sptr &chunk,
+                                                                       const size_t rowIndex) {
+  UNUSED_ARG(rowIndex);
+  return chunk;
+}
+
+/**
+ * Add a processed chunk to the output. The default runs the accumulation
+ * algorithm, Plus unless changed with setAccumAlg.
+ * @param accumulated :: the output so far, null for the first chunk
+ * @param chunk :: the processed chunk
+ * @param rowIndex :: the index of the chunk
+ * @return the output including the chunk
+ */
+template <class Base>
+MatrixWorkspace_sptr GenericDataProcessorAlgorithm<Base>::accumulateChunk(const MatrixWorkspace_sptr &accumulated,
+                                                                          const MatrixWorkspace_sptr &chunk,
+                                                                          const size_t rowIndex) {
+  UNUSED_ARG(rowIndex);
+  if (!accumulated)
+    return chunk;
+  auto alg = createChildAlgorithm(m_accumulateAlg);
+  alg->setProperty("LHSWorkspace", accumulated);
+  alg->setProperty("RHSWorkspace", chunk);
+  alg->setProperty("OutputWorkspace", accumulated);
+  alg->executeAsChildAlg();
+  return alg->getProperty("OutputWorkspace");
+}
+
+/**
+ * Load, process and accumulate chunks 0 to numChunks - 1 in order.
+ *
+ * Chunks are loaded with loadChunk on a separate thread while the previous
+ * ones are passed through processChunk and accumulateChunk, and each is
+ * released once it has been accumulated. Chunks are only loaded ahead while
+ * the output, the chunk being processed and those loaded ahead fit in the
+ * memory budget, judged from the size of the first chunk. Without a budget,
+ * or if a second chunk does not fit in it, each chunk is loaded after the
+ * previous one has been accumulated, and the same happens once the output has
+ * grown too large for any chunk to be loaded ahead.
+ *
+ * loadChunk must not change the state of the algorithm when chunks are loaded
+ * ahead, as it runs at the same time as processChunk and accumulateChunk.
+ * Python algorithms override the same hooks, and their loadChunk then runs on
+ * the loading thread with the GIL, which processChunks releases while it waits.
+ *
+ * @param numChunks :: the number of chunks
+ * @param memoryBudget :: the memory the chunks and the output may use in
+ * bytes, or 0 to load one chunk at a time
+ * @return the accumulated output
+ */
+template <class Base>
+MatrixWorkspace_sptr GenericDataProcessorAlgorithm<Base>::processChunks(const size_t numChunks,
+                                                                        const size_t memoryBudget) {
+  if (numChunks == 0)
+    throw std::invalid_argument("DataProcessorAlgorithm::processChunks needs at least one chunk");
+
+  // the first chunk shows how much memory a chunk needs
+  MatrixWorkspace_sptr chunk = loadChunk(0);
+  const size_t chunkSize = chunk ? chunk->getMemorySize() : 0;
+  std::unique_ptr<ChunkLoader> loader;
+  if (numChunks > 1) {
+    const size_t maxAhead = chunksAhead(memoryBudget, chunkSize, 0);
+    if (maxAhead > 0)
+      loader = std::make_unique<ChunkLoader>(
+          this, [this](const size_t rowIndex) { return loadChunk(rowIndex); }, 1, numChunks, maxAhead);
+  }
+
+  MatrixWorkspace_sptr accumulated;
+  for (size_t rowIndex = 0; rowIndex < numChunks; ++rowIndex) {
+    if (rowIndex > 0) {
+      if (loader) {
+        auto loaded = loader->take();
+        if (loaded.error)
+          std::rethrow_exception(loaded.error);
+        if (this->isRecordingHistoryForChild() && Base::m_history) {
+          for (const auto &childHistory : loaded.history->getChildHistories())
+            Base::m_history->addChildHistory(childHistory);
+        }
+        chunk = std::move(loaded.workspace);
+      } else {
+        chunk = loadChunk(rowIndex);
+      }
+    }
+    this->interruption_point();
+
+    accumulated = accumulateChunk(accumulated, processChunk(chunk, rowIndex), rowIndex);
+    chunk.reset();
+    if (loader)
+      loader->setMaxLoaded(chunksAhead(memoryBudget, chunkSize, accumulated ? accumulated->getMemorySize() : 0));
+  }
+  return accumulated;
+}
+
 /**
  * Save a workspace as a nexus file, with check for which thread
  * we are executing in.
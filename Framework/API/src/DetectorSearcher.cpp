@@ -8,18 +8,24 @@
 #include "MantidGeometry/Instrument/ReferenceFrame.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Logger.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/NearestNeighbours.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
 #include <tuple>
 
-using Mantid::Geometry::InstrumentRayTracer;
 using Mantid::Kernel::V3D;
 using namespace Mantid;
 using namespace Mantid::API;
 
 namespace {
 Kernel::Logger g_log("DetectorSearcher");
-}
+/// Upper limit on the number of polar angle bins in the direction table
+constexpr size_t MAX_POLAR_BINS = 512;
+} // namespace
 
 double getQSign() {
   const auto convention = Kernel::ConfigService::Instance().getString("Q.convention");
@@ -36,23 +42,23 @@ double getQSign() {
  */
 DetectorSearcher::DetectorSearcher(const Geometry::Instrument_const_sptr &instrument,
                                    const Geometry::DetectorInfo &detInfo)
-    : m_usingFullRayTrace(instrument->containsRectDetectors() == Geometry::Instrument::ContainsState::Full),
+    : m_usingDirectionLookup(instrument->containsRectDetectors() == Geometry::Instrument::ContainsState::Full),
       m_crystallography_convention(getQSign()), m_detInfo(detInfo), m_instrument(instrument) {
 
   /* Choose the search strategy to use
    * If the instrument uses rectangular detectors (e.g. TOPAZ) then it is faster
-   * to run a full ray trace starting from the top of the instrument. This is
-   * due to the speed up of looking up a single pixel in the rectangular
-   * detector.
+   * to look up the few pixels lying in the direction of the scattered beam in
+   * a table of detector directions, built once, rather than ray tracing
+   * through the instrument for every search.
    *
    * If the instrument does not use rectangular detectors (e.g. WISH, CORELLI)
    * then it is faster to use a nearest neighbour search to find the closest
    * pixels, then check them for intersection.
    * */
-  if (!m_usingFullRayTrace) {
+  if (!m_usingDirectionLookup) {
     createDetectorCache();
   } else {
-    m_rayTracer = std::make_unique<InstrumentRayTracer>(instrument);
+    createDirectionLookup();
   }
 }
 
@@ -96,6 +102,114 @@ void DetectorSearcher::createDetectorCache() {
   m_detectorCacheSearch = std::make_unique<Kernel::NearestNeighbours<3>>(points);
 }
 
+/** Create a table of the detectors a direction from the sample could hit,
+ * binned by the polar and azimuthal angle of the direction about the beam.
+ *
+ * Each detector is represented by the sphere enclosing its bounding box and
+ * is listed in every bin that the sphere's angular extent overlaps, so only
+ * the detectors listed in a direction's bin need to be checked. The bins are
+ * about the angular size of a typical detector.
+ */
+void DetectorSearcher::createDirectionLookup() {
+  const auto &samplePos = m_detInfo.samplePosition();
+  const auto numDetectors = m_detInfo.size();
+
+  // centre direction and angular radius of each detector, the radius is
+  // negative for detectors without a shape
+  std::vector<double> polar(numDetectors, 0.);
+  std::vector<double> azimuth(numDetectors, 0.);
+  std::vector<double> radius(numDetectors, -1.);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < static_cast<int64_t>(numDetectors); ++i) {
+    const auto index = static_cast<size_t>(i);
+    Geometry::BoundingBox box;
+    m_detInfo.detector(index).getBoundingBox(box);
+    if (box.isNull())
+      continue;
+    const auto centre = box.centrePoint() - samplePos;
+    const auto distance = centre.norm();
+    const auto boxRadius = 0.5 * box.width().norm();
+    if (distance <= boxRadius) {
+      // the sample is inside the sphere, so every direction could hit it
+      radius[index] = M_PI;
+      continue;
+    }
+    std::tie(polar[index], azimuth[index]) = polarAndAzimuth(centre / distance);
+    radius[index] = std::asin(boxRadius / distance);
+  }
+
+  std::vector<double> binnedRadii;
+  for (size_t index = 0; index < numDetectors; ++index) {
+    if (radius[index] >= M_PI)
+      m_detectorsAroundSample.emplace_back(index);
+    else if (radius[index] >= 0.)
+      binnedRadii.emplace_back(radius[index]);
+  }
+  double polarWidth = M_PI;
+  if (!binnedRadii.empty()) {
+    const auto median = binnedRadii.begin() + binnedRadii.size() / 2;
+    std::nth_element(binnedRadii.begin(), median, binnedRadii.end());
+    polarWidth = std::max(2. * *median, M_PI / static_cast<double>(MAX_POLAR_BINS));
+  }
+  m_numPolarBins = std::clamp(static_cast<size_t>(std::ceil(M_PI / polarWidth)), size_t(1), MAX_POLAR_BINS);
+  m_numAzimuthalBins = 2 * m_numPolarBins;
+  polarWidth = M_PI / static_cast<double>(m_numPolarBins);
+  const double azimuthWidth = 2. * M_PI / static_cast<double>(m_numAzimuthalBins);
+
+  // calls addToBin for every bin the detector's sphere overlaps
+  const auto forEachBin = [&](const size_t index, const auto &addToBin) {
+    const double polarLow = polar[index] - radius[index];
+    const double polarHigh = polar[index] + radius[index];
+    int64_t firstAzimuth = 0;
+    auto numAzimuths = static_cast<int64_t>(m_numAzimuthalBins);
+    // unless the sphere covers a pole its azimuthal extent is limited
+    if (polarLow > 0. && polarHigh < M_PI) {
+      const double halfWidth = std::asin(std::min(1., std::sin(radius[index]) / std::sin(polar[index])));
+      firstAzimuth = static_cast<int64_t>(std::floor((azimuth[index] - halfWidth + M_PI) / azimuthWidth));
+      const auto lastAzimuth = static_cast<int64_t>(std::floor((azimuth[index] + halfWidth + M_PI) / azimuthWidth));
+      numAzimuths = std::min(numAzimuths, lastAzimuth - firstAzimuth + 1);
+    }
+    const auto lastPolar = std::min(m_numPolarBins - 1, static_cast<size_t>(std::min(polarHigh, M_PI) / polarWidth));
+    const auto firstPolar = std::min(lastPolar, static_cast<size_t>(std::max(polarLow, 0.) / polarWidth));
+    const auto numAzimuthalBins = static_cast<int64_t>(m_numAzimuthalBins);
+    for (size_t polarBin = firstPolar; polarBin <= lastPolar; ++polarBin) {
+      for (int64_t i = 0; i < numAzimuths; ++i) {
+        // wrap around at +/- pi
+        const auto azimuthBin = ((firstAzimuth + i) % numAzimuthalBins + numAzimuthalBins) % numAzimuthalBins;
+        addToBin(polarBin * m_numAzimuthalBins + static_cast<size_t>(azimuthBin));
+      }
+    }
+  };
+
+  // count the detectors in each bin, then list them
+  m_binOffsets.assign(m_numPolarBins * m_numAzimuthalBins + 1, 0);
+  for (size_t index = 0; index < numDetectors; ++index) {
+    if (radius[index] >= 0. && radius[index] < M_PI)
+      forEachBin(index, [this](const size_t bin) { ++m_binOffsets[bin + 1]; });
+  }
+  std::partial_sum(m_binOffsets.begin(), m_binOffsets.end(), m_binOffsets.begin());
+  m_binnedDetectors.resize(m_binOffsets.back());
+  auto nextInBin = m_binOffsets;
+  for (size_t index = 0; index < numDetectors; ++index) {
+    if (radius[index] >= 0. && radius[index] < M_PI)
+      forEachBin(index, [&](const size_t bin) { m_binnedDetectors[nextInBin[bin]++] = index; });
+  }
+}
+
+/** Get the angles of a unit vector about the beam direction
+ *
+ * @param direction :: a unit vector
+ * @return tuple of <polar angle from the beam in [0, pi], azimuthal angle in
+ * [-pi, pi]>
+ */
+std::tuple<double, double> DetectorSearcher::polarAndAzimuth(const V3D &direction) const {
+  const auto frame = m_instrument->getReferenceFrame();
+  const double cosPolar = std::clamp(direction.scalar_prod(frame->vecPointingAlongBeam()), -1., 1.);
+  const double azimuth =
+      std::atan2(direction.scalar_prod(frame->vecPointingUp()), direction.scalar_prod(frame->vecPointingHorizontal()));
+  return std::make_tuple(std::acos(cosPolar), azimuth);
+}
+
 /** Find the index of a detector given a vector in Qlab space
  *
  * If no detector is found the first parameter of the returned tuple is false
@@ -103,38 +217,62 @@ void DetectorSearcher::createDetectorCache() {
  * @param q :: the Qlab vector to find a detector for
  * @return tuple with data <detector found, detector index>
  */
-DetectorSearcher::DetectorSearchResult DetectorSearcher::findDetectorIndex(const V3D &q) {
+DetectorSearcher::DetectorSearchResult DetectorSearcher::findDetectorIndex(const V3D &q) const {
   // quick check to see if this Q is valid
   if (q.nullVector())
     return std::make_tuple(false, 0);
 
   // search using best strategy for current instrument
-  if (m_usingFullRayTrace) {
-    return searchUsingInstrumentRayTracing(q);
+  if (m_usingDirectionLookup) {
+    return searchUsingDirectionLookup(q);
   } else {
     return searchUsingNearestNeighbours(q);
   }
 }
 
-/** Find the index of a detector given a vector in Qlab space using a ray
- * tracing search strategy
+/** Find the index of a detector given a vector in Qlab space by checking the
+ * detectors listed in the direction table for the scattered beam's direction
  *
  * If no detector is found the first parameter of the returned tuple is false
  *
  * @param q :: the Qlab vector to find a detector for
  * @return tuple with data <detector found, detector index>
  */
-DetectorSearcher::DetectorSearchResult DetectorSearcher::searchUsingInstrumentRayTracing(const V3D &q) {
+DetectorSearcher::DetectorSearchResult DetectorSearcher::searchUsingDirectionLookup(const V3D &q) const {
   const auto direction = convertQtoDirection(q);
-  m_rayTracer->traceFromSample(direction);
-  const auto det = m_rayTracer->getDetectorResult();
-
-  if (!det)
+  if (!std::isfinite(direction.norm2()))
     return std::make_tuple(false, 0);
 
-  const auto detIndex = m_detInfo.indexOf(det->getID());
+  const auto [polar, azimuth] = polarAndAzimuth(direction);
+  const auto polarBin =
+      std::min(m_numPolarBins - 1, static_cast<size_t>(polar * static_cast<double>(m_numPolarBins) / M_PI));
+  const auto azimuthBin = std::min(m_numAzimuthalBins - 1, static_cast<size_t>((azimuth + M_PI) *
+                                                                                static_cast<double>(m_numAzimuthalBins) /
+                                                                                (2. * M_PI)));
+  const auto bin = polarBin * m_numAzimuthalBins + azimuthBin;
+
+  // as a ray trace would, take the first detector along the direction
+  const auto &samplePos = m_detInfo.samplePosition();
+  Geometry::Track track(samplePos, direction);
+  bool hitDetector = false;
+  size_t detIndex = 0;
+  double nearestDistance = std::numeric_limits<double>::max();
+  const auto checkDetector = [&](const size_t index) {
+    if (m_detInfo.detector(index).interceptSurface(track) > 0) {
+      const auto distance = track.front().entryPoint.distance(samplePos);
+      if (distance < nearestDistance) {
+        hitDetector = true;
+        detIndex = index;
+        nearestDistance = distance;
+      }
+    }
+    track.clearIntersectionResults();
+  };
+  for (size_t i = m_binOffsets[bin]; i < m_binOffsets[bin + 1]; ++i)
+    checkDetector(m_binnedDetectors[i]);
+  std::for_each(m_detectorsAroundSample.cbegin(), m_detectorsAroundSample.cend(), checkDetector);
 
-  if (m_detInfo.isMasked(detIndex) || m_detInfo.isMonitor(detIndex))
+  if (!hitDetector || m_detInfo.isMasked(detIndex) || m_detInfo.isMonitor(detIndex))
     return std::make_tuple(false, 0);
 
   return std::make_tuple(true, detIndex);
@@ -148,7 +286,7 @@ DetectorSearcher::DetectorSearchResult DetectorSearcher::searchUsingInstrumentRa
  * @param q :: the Qlab vector to find a detector for
  * @return tuple with data <detector found, detector index>
  */
-DetectorSearcher::DetectorSearchResult DetectorSearcher::searchUsingNearestNeighbours(const V3D &q) {
+DetectorSearcher::DetectorSearchResult DetectorSearcher::searchUsingNearestNeighbours(const V3D &q) const {
   const auto detectorDir = convertQtoDirection(q);
   // find where this Q vector should intersect with "extended" space
   // NOTE: increase the Neighbors from 11 to 21 to cover a wide extended space
@@ -185,7 +323,7 @@ DetectorSearcher::DetectorSearchResult DetectorSearcher::searchUsingNearestNeigh
  */
 DetectorSearcher::DetectorSearchResult
 DetectorSearcher::handleTubeGap(const V3D &detectorDir,
-                                const Kernel::NearestNeighbours<3>::NearestNeighbourResults &neighbours) {
+                                const Kernel::NearestNeighbours<3>::NearestNeighbourResults &neighbours) const {
   std::vector<double> gaps = m_instrument->getNumberParameter("tube-gap", true);
   if (!gaps.empty()) {
     const auto gap = static_cast<double>(gaps.front());
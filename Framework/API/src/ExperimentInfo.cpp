@@ -10,6 +10,7 @@
 #include "MantidAPI/ResizeRectangularDetectorHelper.h"
 #include "MantidAPI/Run.h"
 #include "MantidAPI/Sample.h"
+#include "MantidAPI/SpectrumGeometry.h"
 #include "MantidAPI/SpectrumInfo.h"
 
 #include "MantidGeometry/Crystal/OrientedLattice.h"
@@ -178,6 +179,7 @@ void checkDetectorInfoSize(const Instrument &instr, const Geometry::DetectorInfo
  */
 void ExperimentInfo::setInstrument(const Instrument_const_sptr &instr) {
   m_spectrumInfoWrapper = nullptr;
+  invalidateSpectrumGeometry();
 
   // Detector IDs that were previously dropped because they were not part of the
   // instrument may now suddenly be valid, so we have to reinitialize the
@@ -214,6 +216,7 @@ Instrument_const_sptr ExperimentInfo::getInstrument() const {
  */
 Geometry::ParameterMap &ExperimentInfo::instrumentParameters() {
   populateIfNotLoaded();
+  invalidateSpectrumGeometry();
   return *m_parmap;
 }
 
@@ -430,6 +433,7 @@ void ExperimentInfo::setNumberOfDetectorGroups(const size_t count) const {
   m_spectrumDefinitionNeedsUpdate.resize(count, 1);
   m_spectrumInfo = std::make_unique<Beamline::SpectrumInfo>(count);
   m_spectrumInfoWrapper = nullptr;
+  invalidateSpectrumGeometry();
 }
 
 /** Returns the number of detector groups.
@@ -454,6 +458,7 @@ void ExperimentInfo::setDetectorGrouping(const size_t index, const std::set<deti
   }
   m_spectrumInfo->setSpectrumDefinition(index, std::move(specDef));
   m_spectrumDefinitionNeedsUpdate.at(index) = 0;
+  invalidateSpectrumGeometry();
 }
 
 /** Update detector grouping for spectrum with given index.
@@ -779,6 +784,7 @@ const Geometry::DetectorInfo &ExperimentInfo::detectorInfo() const {
 /** Return a non-const reference to the DetectorInfo object. */
 Geometry::DetectorInfo &ExperimentInfo::mutableDetectorInfo() {
   populateIfNotLoaded();
+  invalidateSpectrumGeometry();
   return m_parmap->mutableDetectorInfo();
 }
 
@@ -833,12 +839,40 @@ const SpectrumInfo &ExperimentInfo::spectrumInfo() const {
 /** Return a non-const reference to the SpectrumInfo object. Not thread safe.
  */
 SpectrumInfo &ExperimentInfo::mutableSpectrumInfo() {
+  invalidateSpectrumGeometry();
   return const_cast<SpectrumInfo &>(static_cast<const ExperimentInfo &>(*this).spectrumInfo());
 }
 
 const Geometry::ComponentInfo &ExperimentInfo::componentInfo() const { return m_parmap->componentInfo(); }
 
-ComponentInfo &ExperimentInfo::mutableComponentInfo() { return m_parmap->mutableComponentInfo(); }
+ComponentInfo &ExperimentInfo::mutableComponentInfo() {
+  invalidateSpectrumGeometry();
+  return m_parmap->mutableComponentInfo();
+}
+
+/** Return the per-spectrum geometry arrays (L2, angles, diffractometer
+ * constants and optionally solid angles) of all spectra.
+ *
+ * The arrays are computed on first use and cached until the instrument, its
+ * parameters, DetectorInfo, ComponentInfo or the spectrum definitions change.
+ * The returned object is immutable and stays valid after such a change, it
+ * just no longer describes the workspace.
+ *
+ * @param withSolidAngles :: also compute the solid angle of every spectrum
+ */
+std::shared_ptr<const SpectrumGeometry> ExperimentInfo::spectrumGeometry(const bool withSolidAngles) const {
+  const auto &info = spectrumInfo();
+  std::lock_guard<std::mutex> lock{m_spectrumGeometryMutex};
+  if (!m_spectrumGeometryIsValid || !m_spectrumGeometry || (withSolidAngles && !m_spectrumGeometry->hasSolidAngles())) {
+    // Only mark the cache valid once the build succeeded, so a failure leaves no stale arrays behind
+    m_spectrumGeometry = std::make_shared<const SpectrumGeometry>(info, withSolidAngles ? &componentInfo() : nullptr);
+    m_spectrumGeometryIsValid = true;
+  }
+  return m_spectrumGeometry;
+}
+
+/// Marks the cached SpectrumGeometry as out of date. Thread-safe.
+void ExperimentInfo::invalidateSpectrumGeometry() const { m_spectrumGeometryIsValid = false; }
 
 /// Sets the SpectrumDefinition for all spectra.
 void ExperimentInfo::setSpectrumDefinitions(Kernel::cow_ptr<std::vector<SpectrumDefinition>> spectrumDefinitions) {
@@ -852,6 +886,7 @@ void ExperimentInfo::setSpectrumDefinitions(Kernel::cow_ptr<std::vector<Spectrum
     invalidateAllSpectrumDefinitions();
   }
   m_spectrumInfoWrapper = nullptr;
+  invalidateSpectrumGeometry();
 }
 
 /** Notifies the ExperimentInfo that a spectrum definition has changed.
@@ -863,6 +898,7 @@ void ExperimentInfo::invalidateSpectrumDefinition(const size_t index) {
   // This uses a vector of char, such that flags for different indices can be
   // set from different threads (std::vector<bool> is not thread-safe).
   m_spectrumDefinitionNeedsUpdate.at(index) = 1;
+  invalidateSpectrumGeometry();
 }
 
 void ExperimentInfo::updateSpectrumDefinitionIfNecessary(const size_t index) const {
@@ -890,12 +926,14 @@ void ExperimentInfo::cacheDefaultDetectorGrouping() const {
     m_spectrumDefinitionNeedsUpdate.at(specIndex) = 0;
     specIndex++;
   }
+  invalidateSpectrumGeometry();
 }
 
 /// Sets flags for all spectrum definitions indicating that they need to be
 /// updated.
 void ExperimentInfo::invalidateAllSpectrumDefinitions() {
   std::fill(m_spectrumDefinitionNeedsUpdate.begin(), m_spectrumDefinitionNeedsUpdate.end(), 1);
+  invalidateSpectrumGeometry();
 }
 
 /** Save the object to an open NeXus file.
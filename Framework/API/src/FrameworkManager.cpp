@@ -8,6 +8,7 @@
 #include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/InstrumentDataService.h"
+#include "MantidAPI/NeighbourGraph.h"
 #include "MantidAPI/WorkspaceGroup.h"
 
 #include "MantidKernel/Exception.h"
@@ -202,9 +203,13 @@ void FrameworkManagerImpl::shutdown() {
 void FrameworkManagerImpl::clearAlgorithms() { AlgorithmManager::Instance().clear(); }
 
 /**
- * Clear memory associated with the ADS
+ * Clear memory associated with the ADS, and the neighbour graphs cached for
+ * its workspaces
  */
-void FrameworkManagerImpl::clearData() { AnalysisDataService::Instance().clear(); }
+void FrameworkManagerImpl::clearData() {
+  AnalysisDataService::Instance().clear();
+  NeighbourGraph::clearCache();
+}
 
 /**
  * Clear memory associated with the IDS
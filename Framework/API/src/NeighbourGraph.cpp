@@ -0,0 +1,227 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/NeighbourGraph.h"
+#include "MantidKernel/ANN/ANN.h"
+#include "MantidKernel/Exception.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+#include <limits>
+#include <list>
+#include <mutex>
+
+namespace Mantid::API {
+using Kernel::V3D;
+
+namespace {
+/// The most memory, in bytes, the graphs in the cache may use
+size_t cacheLimit = NeighbourGraph::DEFAULT_CACHE_LIMIT;
+
+struct CacheEntry {
+  std::shared_ptr<const NeighbourGraph::Points> points;
+  int nNeighbours;
+  /// The radius asked for in enclosing(), or 0 for nearest()
+  double radius;
+  std::shared_ptr<const NeighbourGraph> graph;
+};
+
+std::mutex cacheMutex;
+/// Most recently used first
+std::list<CacheEntry> cache;
+/// The memory used by the graphs in the cache, in bytes
+size_t cacheSize = 0;
+
+/// Drop the least recently used graphs until the cache fits in its limit
+void evictFromCache() {
+  while (cacheSize > cacheLimit) {
+    cacheSize -= cache.back().graph->getMemorySize();
+    cache.pop_back();
+  }
+}
+
+std::shared_ptr<const NeighbourGraph> findInCache(const std::shared_ptr<const NeighbourGraph::Points> &points,
+                                                  const int nNeighbours, const double radius) {
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  const auto entry = std::find_if(cache.begin(), cache.end(), [&](const CacheEntry &candidate) {
+    return candidate.nNeighbours == nNeighbours && candidate.radius == radius &&
+           (candidate.points == points || *candidate.points == *points);
+  });
+  if (entry == cache.end())
+    return nullptr;
+  cache.splice(cache.begin(), cache, entry);
+  return entry->graph;
+}
+
+void addToCache(CacheEntry entry) {
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  cacheSize += entry.graph->getMemorySize();
+  cache.emplace_front(std::move(entry));
+  evictFromCache();
+}
+
+bool sameCoordinates(const V3D &a, const V3D &b) { return a.X() == b.X() && a.Y() == b.Y() && a.Z() == b.Z(); }
+} // namespace
+
+/// Points are equal if every spectrum and position is exactly the same
+bool NeighbourGraph::Points::operator==(const Points &other) const {
+  return spectra == other.spectra && sameCoordinates(scale, other.scale) &&
+         std::equal(positions.cbegin(), positions.cend(), other.positions.cbegin(), other.positions.cend(),
+                    sameCoordinates);
+}
+
+/** Get the graph of the given number of nearest neighbours, from the cache
+ * if it has been built before.
+ * @param points :: the spectra and their positions
+ * @param nNeighbours :: the number of neighbours of each spectrum
+ * @return the graph
+ */
+std::shared_ptr<const NeighbourGraph> NeighbourGraph::nearest(const std::shared_ptr<const Points> &points,
+                                                              const int nNeighbours) {
+  if (auto graph = findInCache(points, nNeighbours, 0.))
+    return graph;
+  auto graph = std::make_shared<const NeighbourGraph>(points, nNeighbours);
+  addToCache({points, nNeighbours, 0., graph});
+  return graph;
+}
+
+/** Get a graph whose cutoff is larger than the radius, by searching for one
+ * more neighbour at a time. The search stops early if every other spectrum
+ * is a neighbour.
+ * @param points :: the spectra and their positions
+ * @param radius :: the distance the cutoff should exceed
+ * @param minNeighbours :: the number of neighbours to start from
+ * @return the graph, or nullptr if there are not enough spectra for
+ * minNeighbours
+ */
+std::shared_ptr<const NeighbourGraph> NeighbourGraph::enclosing(const std::shared_ptr<const Points> &points,
+                                                                const double radius, const int minNeighbours) {
+  if (auto graph = findInCache(points, minNeighbours, radius))
+    return graph;
+  std::shared_ptr<const NeighbourGraph> graph;
+  for (int nNeighbours = minNeighbours;; ++nNeighbours) {
+    try {
+      graph = std::make_shared<const NeighbourGraph>(points, nNeighbours);
+    } catch (std::invalid_argument &) {
+      break;
+    }
+    if (radius < graph->cutoff())
+      break;
+  }
+  if (graph)
+    addToCache({points, minNeighbours, radius, graph});
+  return graph;
+}
+
+/// Empty the cache of graphs
+void NeighbourGraph::clearCache() {
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  cache.clear();
+  cacheSize = 0;
+}
+
+/** Set the most memory the cached graphs may use. Graphs larger than this
+ * are not kept at all.
+ * @param bytes :: the limit in bytes
+ */
+void NeighbourGraph::setCacheLimit(const size_t bytes) {
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  cacheLimit = bytes;
+  evictFromCache();
+}
+
+/**
+ * Search for the nearest neighbours of every spectrum
+ * @param points :: the spectra and their positions
+ * @param nNeighbours :: the number of neighbours of each spectrum
+ * @throw runtime_error if there are no spectra
+ * @throw invalid_argument if there are not more spectra than nNeighbours
+ */
+NeighbourGraph::NeighbourGraph(std::shared_ptr<const Points> points, const int nNeighbours)
+    : m_points(std::move(points)), m_nNeighbours(nNeighbours), m_cutoff(std::numeric_limits<double>::lowest()) {
+  const auto &positions = m_points->positions;
+  if (positions.empty()) {
+    throw std::runtime_error("NearestNeighbours::build - Cannot find any spectra");
+  }
+  const auto nspectra = static_cast<int>(positions.size()); // ANN only deals with integers
+  if (nNeighbours >= nspectra) {
+    throw std::invalid_argument("NearestNeighbours::build - Invalid number of neighbours");
+  }
+
+  const V3D &scale = m_points->scale;
+  ANNpointArray dataPoints = annAllocPts(nspectra, 3);
+  for (int pointNo = 0; pointNo < nspectra; ++pointNo) {
+    const V3D pos = positions[pointNo] / scale;
+    dataPoints[pointNo][0] = pos.X();
+    dataPoints[pointNo][1] = pos.Y();
+    dataPoints[pointNo][2] = pos.Z();
+    m_rowOfSpectrum[m_points->spectra[pointNo]] = static_cast<size_t>(pointNo);
+  }
+  auto annTree = std::make_unique<ANNkd_tree>(dataPoints, nspectra, 3);
+
+  // Every row has the same length
+  const auto rowLength = static_cast<size_t>(nNeighbours);
+  m_offsets.resize(positions.size() + 1);
+  for (size_t row = 0; row < m_offsets.size(); ++row)
+    m_offsets[row] = row * rowLength;
+  m_neighbours.resize(m_offsets.back());
+  m_displacements.resize(m_offsets.back());
+
+  // The searches are independent, each thread reuses its own result arrays
+  PRAGMA_OMP(parallel) {
+    std::vector<ANNidx> nnIndexList(rowLength);
+    std::vector<ANNdist> nnDistList(rowLength);
+    PRAGMA_OMP(for)
+    for (int pointNo = 0; pointNo < nspectra; ++pointNo) {
+      ANNpoint scaledPos = dataPoints[pointNo];
+      annTree->annkSearch(scaledPos, nNeighbours, nnIndexList.data(), nnDistList.data(), 0.0);
+      // The distances that are returned are in our scaled coordinate
+      // system. We store the real space ones.
+      const V3D realPos = V3D(scaledPos[0], scaledPos[1], scaledPos[2]) * scale;
+      const size_t start = m_offsets[pointNo];
+      for (size_t i = 0; i < rowLength; ++i) {
+        const ANNidx index = nnIndexList[i];
+        const V3D neighbour = V3D(dataPoints[index][0], dataPoints[index][1], dataPoints[index][2]) * scale;
+        m_neighbours[start + i] = static_cast<size_t>(index);
+        m_displacements[start + i] = neighbour - realPos;
+      }
+    }
+  }
+  annDeallocPts(dataPoints);
+  annClose();
+
+  for (const auto &displacement : m_displacements)
+    m_cutoff = std::max(m_cutoff, displacement.norm());
+}
+
+/// @return an estimate of the memory used by the graph and its points, in bytes
+size_t NeighbourGraph::getMemorySize() const {
+  // each node of the map also holds a pointer to the next node and the hash
+  const size_t mapNodeSize = sizeof(std::pair<const specnum_t, size_t>) + 2 * sizeof(void *);
+  return m_points->spectra.size() * sizeof(specnum_t) + m_points->positions.size() * sizeof(V3D) +
+         (m_offsets.size() + m_neighbours.size()) * sizeof(size_t) + m_displacements.size() * sizeof(V3D) +
+         m_rowOfSpectrum.size() * mapNodeSize + m_rowOfSpectrum.bucket_count() * sizeof(void *);
+}
+
+/**
+ * Returns a map of the spectrum numbers of the neighbours of a spectrum to
+ * their position relative to it.
+ * @param spectrum :: The spectrum number
+ * @return map of spectrum number to displacement
+ * @throw NotFoundError if the spectrum is not in the graph
+ */
+std::map<specnum_t, V3D> NeighbourGraph::neighbours(const specnum_t spectrum) const {
+  const auto row = m_rowOfSpectrum.find(spectrum);
+  if (row == m_rowOfSpectrum.end()) {
+    throw Kernel::Exception::NotFoundError("NearestNeighbours: Unable to find spectrum in vertex map", spectrum);
+  }
+  std::map<specnum_t, V3D> result;
+  for (size_t i = m_offsets[row->second]; i < m_offsets[row->second + 1]; ++i)
+    result.emplace(m_points->spectra[m_neighbours[i]], m_displacements[i]);
+  return result;
+}
+
+} // namespace Mantid::API
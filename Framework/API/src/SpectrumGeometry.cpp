@@ -0,0 +1,125 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/SpectrumGeometry.h"
+#include "MantidAPI/SpectrumInfo.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/SolidAngleParams.h"
+#include "MantidKernel/Logger.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidTypes/SpectrumDefinition.h"
+
+#include <exception>
+#include <limits>
+#include <stdexcept>
+
+namespace Mantid::API {
+namespace {
+/// static logger object
+Kernel::Logger g_log("SpectrumGeometry");
+
+constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+} // namespace
+
+/** Compute the arrays for all spectra.
+ *
+ * @param spectrumInfo :: the spectra to compute the arrays for
+ * @param componentInfo :: if given, also compute the solid angle of each
+ * spectrum as seen from the sample, i.e. the sum over its detectors that have
+ * a shape. This is by far the most expensive value, so it is optional.
+ */
+SpectrumGeometry::SpectrumGeometry(const SpectrumInfo &spectrumInfo, const Geometry::ComponentInfo *componentInfo)
+    : m_l1(spectrumInfo.l1()), m_l2(spectrumInfo.size(), NaN), m_twoTheta(m_l2), m_signedTwoTheta(m_l2),
+      m_azimuthal(m_l2), m_difa(m_l2), m_difc(m_l2), m_tzero(m_l2), m_hasDetectors(m_l2.size(), 0),
+      m_isMonitor(m_l2.size(), 0) {
+  if (componentInfo)
+    m_solidAngle.resize(m_l2.size(), NaN);
+  const Kernel::V3D samplePosition = spectrumInfo.samplePosition();
+
+  int partiallyCalibrated(0);
+  int withoutAngles(0);
+  // The first exception thrown by any thread, rethrown once the loop is done
+  std::exception_ptr error;
+  const auto numberOfSpectra = static_cast<int64_t>(m_l2.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numberOfSpectra; ++i) {
+    const auto index = static_cast<size_t>(i);
+    try {
+      if (!spectrumInfo.hasDetectors(index))
+        continue;
+      m_hasDetectors[index] = 1;
+      m_l2[index] = spectrumInfo.l2(index);
+      m_isMonitor[index] = spectrumInfo.isMonitor(index);
+
+      if (componentInfo) {
+        try {
+          const Geometry::SolidAngleParams params(samplePosition);
+          double solidAngle(0.0);
+          for (const auto &detIndex : spectrumInfo.spectrumDefinition(index))
+            if (componentInfo->hasValidShape(detIndex.first))
+              solidAngle += componentInfo->solidAngle(detIndex.first, params);
+          m_solidAngle[index] = solidAngle;
+        } catch (const std::runtime_error &) {
+          // e.g. scanning detectors, for which ComponentInfo has no single position
+        }
+      }
+      if (m_isMonitor[index])
+        continue;
+
+      // A spectrum grouping monitors with other detectors has no angles
+      try {
+        m_twoTheta[index] = spectrumInfo.twoTheta(index);
+        m_signedTwoTheta[index] = spectrumInfo.signedTwoTheta(index);
+        m_azimuthal[index] = spectrumInfo.azimuthal(index);
+      } catch (const std::exception &e) {
+        g_log.debug() << "No angles for spectrum " << index << ": " << e.what() << '\n';
+        PARALLEL_ATOMIC
+        ++withoutAngles;
+        continue;
+      }
+      try {
+        std::vector<detid_t> uncalibratedDets;
+        const auto constants = spectrumInfo.diffractometerConstants(index, uncalibratedDets);
+        const auto difa = constants.find(Kernel::UnitParams::difa);
+        const auto tzero = constants.find(Kernel::UnitParams::tzero);
+        m_difc[index] = constants.at(Kernel::UnitParams::difc);
+        m_difa[index] = difa == constants.end() ? 0.0 : difa->second;
+        m_tzero[index] = tzero == constants.end() ? 0.0 : tzero->second;
+        if (!uncalibratedDets.empty()) {
+          PARALLEL_ATOMIC
+          ++partiallyCalibrated;
+        }
+      } catch (const std::exception &) {
+        // Diffractometer constants are not available for scanning instruments
+      }
+    } catch (...) {
+      PARALLEL_CRITICAL(SpectrumGeometry_error)
+      if (!error)
+        error = std::current_exception();
+    }
+  }
+  if (error)
+    std::rethrow_exception(error);
+  if (withoutAngles > 0)
+    g_log.warning() << withoutAngles
+                    << " spectra have no scattering angles, for example because they group monitors with other "
+                       "detectors. Their angles and diffractometer constants are NaN.\n";
+  if (partiallyCalibrated > 0)
+    g_log.warning() << partiallyCalibrated
+                    << " spectra mix calibrated and uncalibrated detectors. Uncalibrated values were used for "
+                       "the diffractometer constants of those detectors.\n";
+}
+
+/** @return the solid angle of each spectrum
+ * @throw std::runtime_error if the object was built without solid angles
+ */
+const std::vector<double> &SpectrumGeometry::solidAngle() const {
+  if (!hasSolidAngles())
+    throw std::runtime_error("SpectrumGeometry: solid angles were not computed");
+  return m_solidAngle;
+}
+
+} // namespace Mantid::API
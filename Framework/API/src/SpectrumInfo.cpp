@@ -53,14 +53,14 @@ const Kernel::cow_ptr<std::vector<SpectrumDefinition>> &SpectrumInfo::sharedSpec
 
 /// Returns true if the detector(s) associated with the spectrum are monitors.
 bool SpectrumInfo::isMonitor(const size_t index) const {
-  const auto spectrumDef = checkAndGetSpectrumDefinition(index);
+  const auto &spectrumDef = checkAndGetSpectrumDefinition(index);
   return std::all_of(spectrumDef.cbegin(), spectrumDef.cend(),
                      [this](const std::pair<size_t, size_t> &detIndex) { return m_detectorInfo.isMonitor(detIndex); });
 }
 
 /// Returns true if the detector(s) associated with the spectrum are masked.
 bool SpectrumInfo::isMasked(const size_t index) const {
-  const auto spectrumDef = checkAndGetSpectrumDefinition(index);
+  const auto &spectrumDef = checkAndGetSpectrumDefinition(index);
   return std::all_of(spectrumDef.cbegin(), spectrumDef.cend(),
                      [this](const std::pair<size_t, size_t> &detIndex) { return m_detectorInfo.isMasked(detIndex); });
 }
@@ -71,7 +71,7 @@ bool SpectrumInfo::isMasked(const size_t index) const {
  * i.e., for a monitor in the beamline between source and sample L2 is negative.
  */
 double SpectrumInfo::l2(const size_t index) const {
-  const auto spectrumDef = checkAndGetSpectrumDefinition(index);
+  const auto &spectrumDef = checkAndGetSpectrumDefinition(index);
   auto l2 = std::accumulate(
       spectrumDef.cbegin(), spectrumDef.cend(), 0.0,
       [this](double x, const std::pair<size_t, size_t> &detIndex) { return x + m_detectorInfo.l2(detIndex); });
@@ -84,7 +84,7 @@ double SpectrumInfo::l2(const size_t index) const {
  * Throws an exception if the spectrum is a monitor.
  */
 double SpectrumInfo::twoTheta(const size_t index) const {
-  const auto spectrumDef = checkAndGetSpectrumDefinition(index);
+  const auto &spectrumDef = checkAndGetSpectrumDefinition(index);
   auto twoTheta = std::accumulate(
       spectrumDef.cbegin(), spectrumDef.cend(), 0.0,
       [this](double x, const std::pair<size_t, size_t> &detIndex) { return x + m_detectorInfo.twoTheta(detIndex); });
@@ -97,7 +97,7 @@ double SpectrumInfo::twoTheta(const size_t index) const {
  * Throws an exception if the spectrum is a monitor.
  */
 double SpectrumInfo::signedTwoTheta(const size_t index) const {
-  const auto spectrumDef = checkAndGetSpectrumDefinition(index);
+  const auto &spectrumDef = checkAndGetSpectrumDefinition(index);
   auto signedTwoTheta = std::accumulate(spectrumDef.cbegin(), spectrumDef.cend(), 0.0,
                                         [this](double x, const std::pair<size_t, size_t> &detIndex) {
                                           return x + m_detectorInfo.signedTwoTheta(detIndex);
@@ -111,7 +111,7 @@ double SpectrumInfo::signedTwoTheta(const size_t index) const {
  * Throws an exception if the spectrum is a monitor.
  */
 double SpectrumInfo::azimuthal(const size_t index) const {
-  const auto spectrumDef = checkAndGetSpectrumDefinition(index);
+  const auto &spectrumDef = checkAndGetSpectrumDefinition(index);
   auto phi = std::accumulate(
       spectrumDef.cbegin(), spectrumDef.cend(), 0.0,
       [this](double x, const std::pair<size_t, size_t> &detIndex) { return x + m_detectorInfo.azimuthal(detIndex); });
@@ -135,7 +135,7 @@ std::pair<double, double> SpectrumInfo::geographicalAngles(const size_t index) c
 
 /// Returns the position of the spectrum with given index.
 Kernel::V3D SpectrumInfo::position(const size_t index) const {
-  const auto spectrumDef = checkAndGetSpectrumDefinition(index);
+  const auto &spectrumDef = checkAndGetSpectrumDefinition(index);
   auto newPos = std::accumulate(spectrumDef.cbegin(), spectrumDef.cend(), Kernel::V3D(),
                                 [this](const auto &x, const std::pair<size_t, size_t> &detIndex) {
                                   return x + m_detectorInfo.position(detIndex);
@@ -9,11 +9,12 @@
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/DetectorGroup.h"
 #include "MantidGeometry/Objects/BoundingBox.h"
-// Nearest neighbours library
-#include "MantidKernel/ANN/ANN.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Timer.h"
 
+#include <algorithm>
+#include <limits>
+
 namespace Mantid {
 using namespace Geometry;
 namespace API {
@@ -75,18 +76,13 @@ std::map<specnum_t, V3D> WorkspaceNearestNeighbours::neighboursInRadius(const sp
     }
     result = defaultNeighbours(spectrum);
   } else if (radius > m_cutoff && m_radius != radius) {
-    // We might have to see how efficient this ends up being.
-    int numberOfNeighbours = m_noNeighbours + 1;
-    while (true) {
-      try {
-        const_cast<WorkspaceNearestNeighbours *>(this)->build(numberOfNeighbours);
-      } catch (std::invalid_argument &) {
-        break;
-      }
-      if (radius < m_cutoff)
-        break;
-      else
-        numberOfNeighbours += 1;
+    // Look for more neighbours until some are outside the radius. The
+    // result is cached, so this is only slow the first time.
+    auto *self = const_cast<WorkspaceNearestNeighbours *>(this);
+    if (auto graph = NeighbourGraph::enclosing(self->spectraPoints(), radius, m_noNeighbours + 1)) {
+      self->m_graph = graph;
+      self->m_noNeighbours = graph->numberOfNeighbours();
+      self->m_cutoff = std::max(m_cutoff, graph->cutoff());
     }
   }
   m_radius = radius;
@@ -109,80 +105,36 @@ std::map<specnum_t, V3D> WorkspaceNearestNeighbours::neighboursInRadius(const sp
  * the graph
  */
 void WorkspaceNearestNeighbours::build(const int noNeighbours) {
+  m_graph = NeighbourGraph::nearest(spectraPoints(), noNeighbours);
+  m_noNeighbours = noNeighbours;
+  m_cutoff = std::max(m_cutoff, m_graph->cutoff());
+}
+
+/**
+ * Collects the spectra to include in the graph, and the scaling applied to
+ * their positions for the search.
+ * @return the spectra and their detector positions
+ */
+std::shared_ptr<const NeighbourGraph::Points> WorkspaceNearestNeighbours::spectraPoints() {
   const auto indices = getSpectraDetectors();
   if (indices.empty()) {
     throw std::runtime_error("NearestNeighbours::build - Cannot find any spectra");
   }
-  const auto nspectra = static_cast<int>(indices.size()); // ANN only deals with integers
-  if (noNeighbours >= nspectra) {
-    throw std::invalid_argument("NearestNeighbours::build - Invalid number of neighbours");
-  }
-
-  // Clear current
-  m_graph.clear();
-  m_specToVertex.clear();
-  m_noNeighbours = noNeighbours;
 
+  auto points = std::make_shared<NeighbourGraph::Points>();
   BoundingBox bbox;
   // Base the scaling on the first detector, should be adequate but we can look
   // at this
   const auto &firstDet = m_spectrumInfo.detector(indices.front());
   firstDet.getBoundingBox(bbox);
-  m_scale = V3D(bbox.width());
-  ANNpointArray dataPoints = annAllocPts(nspectra, 3);
-  MapIV pointNoToVertex;
-
-  int pointNo = 0;
+  points->scale = V3D(bbox.width());
+  points->spectra.reserve(indices.size());
+  points->positions.reserve(indices.size());
   for (const auto i : indices) {
-    const specnum_t spectrum = m_spectrumNumbers[i];
-    V3D pos = m_spectrumInfo.position(i) / m_scale;
-    dataPoints[pointNo][0] = pos.X();
-    dataPoints[pointNo][1] = pos.Y();
-    dataPoints[pointNo][2] = pos.Z();
-    Vertex vertex = boost::add_vertex(spectrum, m_graph);
-    pointNoToVertex[pointNo] = vertex;
-    m_specToVertex[spectrum] = vertex;
-    ++pointNo;
-  }
-
-  auto annTree = std::make_unique<ANNkd_tree>(dataPoints, nspectra, 3);
-  pointNo = 0;
-  // Run the nearest neighbour search on each detector, reusing the arrays
-  // Set size initially to avoid array index error when testing in debug mode
-  std::vector<ANNidx> nnIndexList(m_noNeighbours);
-  std::vector<ANNdist> nnDistList(m_noNeighbours);
-
-  for (const auto idx : indices) {
-    ANNpoint scaledPos = dataPoints[pointNo];
-    annTree->annkSearch(scaledPos,          // Point to search nearest neighbours of
-                        m_noNeighbours,     // Number of neighbours to find (8)
-                        nnIndexList.data(), // Index list of results
-                        nnDistList.data(),  // List of distances to each of these
-                        0.0                 // Error bound (?) is this the radius to search in?
-    );
-    // The distances that are returned are in our scaled coordinate
-    // system. We store the real space ones.
-    const V3D realPos = V3D(scaledPos[0], scaledPos[1], scaledPos[2]) * m_scale;
-    for (int i = 0; i < m_noNeighbours; i++) {
-      ANNidx index = nnIndexList[i];
-      V3D neighbour = V3D(dataPoints[index][0], dataPoints[index][1], dataPoints[index][2]) * m_scale;
-      V3D distance = neighbour - realPos;
-      double separation = distance.norm();
-      boost::add_edge(m_specToVertex[m_spectrumNumbers[idx]], // from
-                      pointNoToVertex[index],                 // to
-                      distance, m_graph);
-      if (separation > m_cutoff) {
-        m_cutoff = separation;
-      }
-    }
-    pointNo++;
+    points->spectra.emplace_back(m_spectrumNumbers[i]);
+    points->positions.emplace_back(m_spectrumInfo.position(i));
   }
-  annDeallocPts(dataPoints);
-  annClose();
-  pointNoToVertex.clear();
-
-  m_vertexID = get(boost::vertex_name, m_graph);
-  m_edgeLength = get(boost::edge_name, m_graph);
+  return points;
 }
 
 /**
@@ -193,27 +145,9 @@ void WorkspaceNearestNeighbours::build(const int noNeighbours) {
  * @throw NotFoundError if detector ID is not recognised
  */
 std::map<specnum_t, V3D> WorkspaceNearestNeighbours::defaultNeighbours(const specnum_t spectrum) const {
-  auto vertex = m_specToVertex.find(spectrum);
-
-  if (vertex != m_specToVertex.end()) {
-    std::map<specnum_t, V3D> result;
-    std::pair<Graph::adjacency_iterator, Graph::adjacency_iterator> adjacent =
-        boost::adjacent_vertices(vertex->second, m_graph);
-    Graph::adjacency_iterator adjIt;
-    for (adjIt = adjacent.first; adjIt != adjacent.second; adjIt++) {
-      Vertex nearest = (*adjIt);
-      auto nrSpec = specnum_t(m_vertexID[nearest]);
-      std::pair<Graph::edge_descriptor, bool> nrEd = boost::edge(vertex->second, nearest, m_graph);
-      result[nrSpec] = m_edgeLength[nrEd.first];
-    }
-    return result;
-  } else {
-    throw Mantid::Kernel::Exception::NotFoundError("NearestNeighbours: Unable to find spectrum in vertex map",
-                                                   spectrum);
-  }
+  return m_graph->neighbours(spectrum);
 }
 
-/// Returns the list of valid spectrum indices
 std::vector<size_t> WorkspaceNearestNeighbours::getSpectraDetectors() {
   std::vector<size_t> indices;
   const auto nSpec = m_spectrumNumbers.size();
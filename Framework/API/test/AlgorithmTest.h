@@ -20,6 +20,7 @@
 #include "MantidAPI/WorkspaceProperty.h"
 #include "MantidFrameworkTestHelpers/FakeObjects.h"
 #include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Property.h"
 #include "MantidKernel/ReadLock.h"
 #include "MantidKernel/RebinParamsValidator.h"
@@ -151,6 +152,21 @@ const std::string FailingAlgorithm::FAIL_MSG("Algorithm failed as requested");
 
 DECLARE_ALGORITHM(FailingAlgorithm)
 
+/// Declares that members of WorkspaceGroups can be processed at the same time
+class IndependentMembersAlgorithm : public StubbedWorkspaceAlgorithm {
+public:
+  const std::string name() const override { return "IndependentMembersAlgorithm"; }
+  bool groupMembersAreIndependent() const override { return true; }
+};
+DECLARE_ALGORITHM(IndependentMembersAlgorithm)
+
+class IndependentMembersFailingAlgorithm : public FailingAlgorithm {
+public:
+  const std::string name() const override { return "IndependentMembersFailingAlgorithm"; }
+  bool groupMembersAreIndependent() const override { return true; }
+};
+DECLARE_ALGORITHM(IndependentMembersFailingAlgorithm)
+
 class IndexingAlgorithm : public Algorithm {
 public:
   const std::string name() const override { return "IndexingAlgorithm"; }
@@ -813,6 +829,59 @@ public:
     TS_ASSERT_EQUALS(ws3->getTitle(), "A3+D3+D3");
   }
 
+  void test_processGroups_concurrently() {
+    auto &config = ConfigService::Instance();
+    const std::string maxMembers = config.getString("MultiThreaded.MaxConcurrentGroupMembers");
+    config.setString("MultiThreaded.MaxConcurrentGroupMembers", "3");
+    makeWorkspaceGroup("A", "A_1,A_2,A_3,A_4,A_5");
+    makeWorkspaceGroup("B", "");
+
+    IndependentMembersAlgorithm alg;
+    alg.initialize();
+    alg.setPropertyValue("InputWorkspace1", "A");
+    alg.setPropertyValue("InputWorkspace2", "B");
+    alg.setPropertyValue("Number", "234");
+    alg.setPropertyValue("OutputWorkspace1", "D");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+    config.setString("MultiThreaded.MaxConcurrentGroupMembers", maxMembers);
+
+    // the members are in the same order as the input
+    auto group = AnalysisDataService::Instance().retrieveWS<WorkspaceGroup>("D");
+    TS_ASSERT_EQUALS(group->getNumberOfEntries(), 5);
+    for (int i = 0; i < group->getNumberOfEntries(); ++i) {
+      auto ws = std::dynamic_pointer_cast<MatrixWorkspace>(group->getItem(i));
+      const std::string member = std::to_string(i + 1);
+      TS_ASSERT_EQUALS(ws->getName(), "D_" + member);
+      TS_ASSERT_EQUALS(ws->getTitle(), "A_" + member + "+B+");
+      TS_ASSERT_EQUALS(ws->readY(0)[0], 234);
+    }
+  }
+
+  void test_processGroups_concurrently_failOnFirstFailedMember() {
+    auto &config = ConfigService::Instance();
+    const std::string maxMembers = config.getString("MultiThreaded.MaxConcurrentGroupMembers");
+    config.setString("MultiThreaded.MaxConcurrentGroupMembers", "4");
+    makeWorkspaceGroup("A", "A_1,A_2,A_3,A_4");
+
+    IndependentMembersFailingAlgorithm alg;
+    alg.initialize();
+    alg.setRethrows(true);
+    alg.setLogging(false);
+    alg.setPropertyValue("InputWorkspace", "A");
+    alg.setPropertyValue("WsNameToFail", "A_3");
+
+    try {
+      alg.execute();
+      TS_FAIL("Exception wasn't thrown");
+    } catch (std::runtime_error &e) {
+      std::string msg(e.what());
+      TS_ASSERT(msg.find("group entry 3") != std::string::npos);
+      TS_ASSERT(msg.find(FailingAlgorithm::FAIL_MSG) != std::string::npos);
+    }
+    config.setString("MultiThreaded.MaxConcurrentGroupMembers", maxMembers);
+  }
+
   void doHistoryCopyTest(const std::string &inputWSName, const std::string &outputWSName) {
     auto inputWS = std::make_shared<WorkspaceTester>();
     inputWS->history().addHistory(
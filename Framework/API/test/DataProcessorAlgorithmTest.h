@@ -14,6 +14,8 @@
 #include "MantidKernel/Timer.h"
 #include <cxxtest/TestSuite.h>
 
+#include <atomic>
+
 using namespace Mantid;
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
@@ -125,6 +127,78 @@ class DataProcessorAlgorithmTest : public CxxTest::TestSuite {
     }
   };
 
+  // loads chunks holding their index plus one and adds them up
+  class ChunkedAlgorithm : public DataProcessorAlgorithm {
+  public:
+    const std::string name() const override { return "ChunkedAlgorithm"; }
+    int version() const override { return 1; }
+    const std::string category() const override { return "Cat;Leopard;Mink"; }
+    const std::string summary() const override { return "ChunkedAlgorithm"; }
+
+    void init() override {
+      declareProperty("NumberOfChunks", 5);
+      declareProperty("MemoryBudget", 0);
+      declareProperty("FailingChunk", -1);
+      declareProperty("NestedLoad", false);
+      declareProperty(std::make_unique<WorkspaceProperty<MatrixWorkspace>>("OutputWorkspace", "", Direction::Output));
+    }
+    void exec() override {
+      const int numChunks = getProperty("NumberOfChunks");
+      const int memoryBudget = getProperty("MemoryBudget");
+      m_failingChunk = getProperty("FailingChunk");
+      m_nestedLoad = getProperty("NestedLoad");
+      setProperty("OutputWorkspace",
+                  processChunks(static_cast<size_t>(numChunks), static_cast<size_t>(memoryBudget)));
+    }
+
+    MatrixWorkspace_sptr loadChunk(const size_t rowIndex) override {
+      if (static_cast<int>(rowIndex) == m_failingChunk)
+        throw std::runtime_error("Cannot load chunk");
+      auto alg = createChildAlgorithm("BasicAlgorithm");
+      alg->execute();
+      if (m_nestedLoad) {
+        // loads its own chunks on the thread loading this one
+        ChunkedAlgorithm nested;
+        nested.initialize();
+        nested.setChild(true);
+        nested.setProperty("NumberOfChunks", 2);
+        nested.setPropertyValue("OutputWorkspace", "nested_output");
+        nested.execute();
+      }
+      auto chunk = makeChunk();
+      chunk->mutableY(0)[0] = static_cast<double>(rowIndex + 1);
+      ++m_numLoaded;
+      return chunk;
+    }
+    MatrixWorkspace_sptr processChunk(const MatrixWorkspace_sptr &chunk, const size_t rowIndex) override {
+      processed.emplace_back(rowIndex);
+      loadedAhead.emplace_back(m_numLoaded - rowIndex - 1);
+      return chunk;
+    }
+    MatrixWorkspace_sptr accumulateChunk(const MatrixWorkspace_sptr &accumulated, const MatrixWorkspace_sptr &chunk,
+                                         const size_t) override {
+      if (!accumulated)
+        return chunk;
+      accumulated->mutableY(0)[0] += chunk->y(0)[0];
+      return accumulated;
+    }
+
+    static std::shared_ptr<WorkspaceTester> makeChunk() {
+      auto chunk = std::make_shared<WorkspaceTester>();
+      chunk->initialize(1, 2, 1);
+      return chunk;
+    }
+
+    std::vector<size_t> processed;
+    /// the number of chunks loaded ahead of each one when it was processed
+    std::vector<size_t> loadedAhead;
+
+  private:
+    int m_failingChunk{-1};
+    bool m_nestedLoad{false};
+    std::atomic<size_t> m_numLoaded{0};
+  };
+
 public:
   // This pair of boilerplate methods prevent the suite being created statically
   // This means the constructor isn't called when running other tests
@@ -145,6 +219,62 @@ public:
     Mantid::API::AlgorithmFactory::Instance().unsubscribe("SubAlgorithm", 1);
   }
 
+  void test_processChunks_one_at_a_time() { checkProcessChunks(0); }
+
+  void test_processChunks_loading_ahead() { checkProcessChunks(1 << 30); }
+
+  void test_processChunks_stops_loading_ahead_when_output_fills_budget() {
+    // a second chunk fits besides the first, but not besides the output and the chunk being processed
+    const auto chunkSize = ChunkedAlgorithm::makeChunk()->getMemorySize();
+    ChunkedAlgorithm alg;
+    alg.initialize();
+    alg.setRethrows(true);
+    alg.setProperty("MemoryBudget", static_cast<int>(2 * chunkSize));
+    alg.setPropertyValue("OutputWorkspace", "test_output_workspace");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+
+    auto ws = AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>("test_output_workspace");
+    TS_ASSERT_EQUALS(ws->y(0)[0], 15.);
+    // once the first chunk is accumulated, each chunk is only loaded when it is needed
+    TS_ASSERT_EQUALS(alg.loadedAhead.size(), 5);
+    TS_ASSERT_LESS_THAN_EQUALS(alg.loadedAhead[0], 1);
+    for (size_t i = 1; i < alg.loadedAhead.size(); ++i)
+      TS_ASSERT_EQUALS(alg.loadedAhead[i], 0);
+
+    AnalysisDataService::Instance().remove("test_output_workspace");
+  }
+
+  void test_processChunks_rethrows_load_error() {
+    ChunkedAlgorithm alg;
+    alg.initialize();
+    alg.setRethrows(true);
+    alg.setProperty("MemoryBudget", 1 << 30);
+    alg.setProperty("FailingChunk", 3);
+    alg.setPropertyValue("OutputWorkspace", "test_output_workspace");
+    TS_ASSERT_THROWS_EQUALS(alg.execute(), const std::runtime_error &e, std::string(e.what()), "Cannot load chunk");
+    const std::vector<size_t> expected{0, 1, 2};
+    TS_ASSERT_EQUALS(alg.processed, expected);
+  }
+
+  void test_processChunks_keeps_history_of_nested_algorithm_out_of_chunk() {
+    ChunkedAlgorithm alg;
+    alg.initialize();
+    alg.setRethrows(true);
+    alg.setProperty("MemoryBudget", 1 << 30);
+    alg.setProperty("NestedLoad", true);
+    alg.setPropertyValue("OutputWorkspace", "test_output_workspace");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+
+    // only the algorithms created by the loads of this algorithm are its children
+    auto ws = AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>("test_output_workspace");
+    auto algHist = ws->getHistory().getAlgorithmHistory(0);
+    TS_ASSERT_EQUALS(algHist->childHistorySize(), 5);
+    for (size_t i = 0; i < algHist->childHistorySize(); ++i)
+      TS_ASSERT_EQUALS(algHist->getChildAlgorithmHistory(i)->name(), "BasicAlgorithm");
+
+    AnalysisDataService::Instance().remove("test_output_workspace");
+  }
+
   void test_Nested_History() {
     std::shared_ptr<WorkspaceTester> input = std::make_shared<WorkspaceTester>();
     AnalysisDataService::Instance().addOrReplace("test_input_workspace", input);
@@ -214,4 +344,27 @@ public:
     AnalysisDataService::Instance().remove("test_output_workspace");
     AnalysisDataService::Instance().remove("test_input_workspace");
   }
+
+private:
+  void checkProcessChunks(const int memoryBudget) {
+    ChunkedAlgorithm alg;
+    alg.initialize();
+    alg.setRethrows(true);
+    alg.setProperty("MemoryBudget", memoryBudget);
+    alg.setPropertyValue("OutputWorkspace", "test_output_workspace");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+
+    const std::vector<size_t> expected{0, 1, 2, 3, 4};
+    TS_ASSERT_EQUALS(alg.processed, expected);
+    auto ws = AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>("test_output_workspace");
+    TS_ASSERT_EQUALS(ws->y(0)[0], 15.);
+
+    // the history of the algorithms run by every load is kept
+    auto algHist = ws->getHistory().getAlgorithmHistory(0);
+    TS_ASSERT_EQUALS(algHist->childHistorySize(), 5);
+    for (size_t i = 0; i < algHist->childHistorySize(); ++i)
+      TS_ASSERT_EQUALS(algHist->getChildAlgorithmHistory(i)->name(), "BasicAlgorithm");
+
+    AnalysisDataService::Instance().remove("test_output_workspace");
+  }
 };
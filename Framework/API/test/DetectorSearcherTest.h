@@ -10,6 +10,7 @@
 #include "MantidAPI/ExperimentInfo.h"
 #include "MantidFrameworkTestHelpers/ComponentCreationHelper.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/V3D.h"
 
 #include <cmath>
@@ -126,6 +127,29 @@ public:
     }
   }
 
+  void test_search_rectangular_from_several_threads() {
+    auto inst = ComponentCreationHelper::createTestInstrumentRectangular2(1, 100);
+    ExperimentInfo expInfo;
+    expInfo.setInstrument(inst);
+    const auto &info = expInfo.detectorInfo();
+
+    const DetectorSearcher searcher(inst, info);
+    std::vector<V3D> qs;
+    for (size_t pointNo = 0; pointNo < info.size(); ++pointNo)
+      qs.emplace_back(convertDetectorPositionToQ(info.detector(pointNo)));
+
+    std::vector<size_t> found(qs.size(), qs.size());
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < static_cast<int>(qs.size()); ++i) {
+      const auto result = searcher.findDetectorIndex(qs[i]);
+      if (std::get<0>(result))
+        found[i] = std::get<1>(result);
+    }
+
+    for (size_t pointNo = 0; pointNo < found.size(); ++pointNo)
+      TS_ASSERT_EQUALS(found[pointNo], pointNo)
+  }
+
   V3D convertDetectorPositionToQ(const IDetector &det) {
     const auto tt1 = det.getTwoTheta(V3D(0, 0, 0), V3D(0, 0, 1)); // two theta
     const auto ph1 = det.getPhi();                                // phi
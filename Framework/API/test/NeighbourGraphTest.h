@@ -0,0 +1,111 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/NeighbourGraph.h"
+#include "MantidKernel/Exception.h"
+#include <cxxtest/TestSuite.h>
+
+using Mantid::specnum_t;
+using Mantid::API::NeighbourGraph;
+using Mantid::Kernel::V3D;
+
+namespace {
+/// Spectra 1 to n, one metre apart along x
+std::shared_ptr<const NeighbourGraph::Points> pointsInALine(const int n) {
+  auto points = std::make_shared<NeighbourGraph::Points>();
+  points->scale = V3D(1., 1., 1.);
+  for (int i = 0; i < n; ++i) {
+    points->spectra.emplace_back(i + 1);
+    points->positions.emplace_back(static_cast<double>(i), 0., 0.);
+  }
+  return points;
+}
+} // namespace
+
+class NeighbourGraphTest : public CxxTest::TestSuite {
+public:
+  static NeighbourGraphTest *createSuite() { return new NeighbourGraphTest(); }
+  static void destroySuite(NeighbourGraphTest *suite) { delete suite; }
+
+  void setUp() override { NeighbourGraph::clearCache(); }
+
+  void tearDown() override { NeighbourGraph::setCacheLimit(NeighbourGraph::DEFAULT_CACHE_LIMIT); }
+
+  void test_nearest_neighbours() {
+    NeighbourGraph graph(pointsInALine(10), 2);
+    const auto neighbours = graph.neighbours(5);
+    TS_ASSERT_EQUALS(neighbours.size(), 2);
+    TS_ASSERT_EQUALS(neighbours.at(4), V3D(-1., 0., 0.));
+    TS_ASSERT_EQUALS(neighbours.at(6), V3D(1., 0., 0.));
+    // The first spectrum's nearest neighbours are both on one side
+    TS_ASSERT_EQUALS(graph.neighbours(1).at(3), V3D(2., 0., 0.));
+    TS_ASSERT_DELTA(graph.cutoff(), 2., 1e-12);
+  }
+
+  void test_unknown_spectrum_throws() {
+    NeighbourGraph graph(pointsInALine(10), 3);
+    TS_ASSERT_THROWS(graph.neighbours(11), const Mantid::Kernel::Exception::NotFoundError &);
+  }
+
+  void test_too_many_neighbours_throws() {
+    TS_ASSERT_THROWS(NeighbourGraph(pointsInALine(3), 3), const std::invalid_argument &);
+    TS_ASSERT_THROWS(NeighbourGraph(pointsInALine(0), 1), const std::runtime_error &);
+  }
+
+  void test_graphs_for_the_same_points_are_shared() {
+    const auto graph = NeighbourGraph::nearest(pointsInALine(10), 3);
+    // Equal points in a different object
+    TS_ASSERT_EQUALS(NeighbourGraph::nearest(pointsInALine(10), 3), graph);
+    TS_ASSERT_DIFFERS(NeighbourGraph::nearest(pointsInALine(10), 4), graph);
+    TS_ASSERT_DIFFERS(NeighbourGraph::nearest(pointsInALine(11), 3), graph);
+
+    NeighbourGraph::clearCache();
+    TS_ASSERT_DIFFERS(NeighbourGraph::nearest(pointsInALine(10), 3), graph);
+  }
+
+  void test_enclosing_searches_until_the_cutoff_exceeds_the_radius() {
+    const auto points = pointsInALine(10);
+    const auto graph = NeighbourGraph::enclosing(points, 2.5, 2);
+    TS_ASSERT(graph);
+    TS_ASSERT_EQUALS(graph->numberOfNeighbours(), 3);
+    TS_ASSERT_DELTA(graph->cutoff(), 3., 1e-12);
+    TS_ASSERT_EQUALS(NeighbourGraph::enclosing(points, 2.5, 2), graph);
+
+    // Stops when every spectrum is a neighbour
+    TS_ASSERT_EQUALS(NeighbourGraph::enclosing(points, 100., 2)->numberOfNeighbours(), 9);
+    TS_ASSERT(!NeighbourGraph::enclosing(points, 100., 10));
+  }
+
+  void test_memory_size_grows_with_the_graph() {
+    const NeighbourGraph small(pointsInALine(10), 2);
+    TS_ASSERT_LESS_THAN(10 * 2 * sizeof(V3D), small.getMemorySize());
+    TS_ASSERT_LESS_THAN(small.getMemorySize(), NeighbourGraph(pointsInALine(10), 4).getMemorySize());
+    TS_ASSERT_LESS_THAN(small.getMemorySize(), NeighbourGraph(pointsInALine(20), 2).getMemorySize());
+  }
+
+  void test_least_recently_used_graphs_are_dropped_beyond_the_memory_limit() {
+    const auto points = pointsInALine(10);
+    const auto first = NeighbourGraph::nearest(points, 2);
+    // room for two graphs of this size
+    NeighbourGraph::setCacheLimit(2 * first->getMemorySize() + first->getMemorySize() / 2);
+    const auto second = NeighbourGraph::nearest(points, 2);
+    TS_ASSERT_EQUALS(second, first);
+    const auto other = NeighbourGraph::nearest(pointsInALine(10), 3);
+    // uses the first graph, so the other one is dropped next
+    TS_ASSERT_EQUALS(NeighbourGraph::nearest(points, 2), first);
+    NeighbourGraph::nearest(pointsInALine(10), 1);
+    TS_ASSERT_EQUALS(NeighbourGraph::nearest(points, 2), first);
+    TS_ASSERT_DIFFERS(NeighbourGraph::nearest(pointsInALine(10), 3), other);
+  }
+
+  void test_graphs_larger_than_the_limit_are_not_kept() {
+    const auto graph = NeighbourGraph::nearest(pointsInALine(10), 2);
+    NeighbourGraph::setCacheLimit(graph->getMemorySize() - 1);
+    TS_ASSERT_DIFFERS(NeighbourGraph::nearest(pointsInALine(10), 2), graph);
+  }
+};
@@ -0,0 +1,156 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/ExperimentInfo.h"
+#include "MantidAPI/SpectrumGeometry.h"
+#include "MantidAPI/SpectrumInfo.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/SolidAngleParams.h"
+
+#include "MantidFrameworkTestHelpers/FakeObjects.h"
+#include "MantidFrameworkTestHelpers/InstrumentCreationHelper.h"
+
+#include <cmath>
+
+using namespace Mantid;
+using namespace Mantid::API;
+using namespace Mantid::Kernel;
+
+class SpectrumGeometryTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static SpectrumGeometryTest *createSuite() { return new SpectrumGeometryTest(); }
+  static void destroySuite(SpectrumGeometryTest *suite) { delete suite; }
+
+  void test_values_match_SpectrumInfo() {
+    auto ws = makeWorkspace();
+    const auto &spectrumInfo = ws.spectrumInfo();
+    const SpectrumGeometry geometry(spectrumInfo);
+    TS_ASSERT_EQUALS(geometry.size(), 5);
+    TS_ASSERT_EQUALS(geometry.l1(), spectrumInfo.l1());
+    TS_ASSERT(!geometry.hasSolidAngles());
+    TS_ASSERT_THROWS(geometry.solidAngle(), const std::runtime_error &);
+    for (size_t i = 0; i < 3; ++i) {
+      TS_ASSERT(geometry.hasDetectors(i));
+      TS_ASSERT(!geometry.isMonitor(i));
+      TS_ASSERT_EQUALS(geometry.l2()[i], spectrumInfo.l2(i));
+      TS_ASSERT_EQUALS(geometry.twoTheta()[i], spectrumInfo.twoTheta(i));
+      TS_ASSERT_EQUALS(geometry.signedTwoTheta()[i], spectrumInfo.signedTwoTheta(i));
+      TS_ASSERT_EQUALS(geometry.azimuthal()[i], spectrumInfo.azimuthal(i));
+      TS_ASSERT_EQUALS(geometry.difc()[i], spectrumInfo.difcUncalibrated(i));
+      TS_ASSERT_EQUALS(geometry.difa()[i], 0.0);
+      TS_ASSERT_EQUALS(geometry.tzero()[i], 0.0);
+    }
+  }
+
+  void test_monitors_have_no_angles() {
+    auto ws = makeWorkspace();
+    const SpectrumGeometry geometry(ws.spectrumInfo());
+    for (size_t i = 3; i < 5; ++i) {
+      TS_ASSERT(geometry.isMonitor(i));
+      TS_ASSERT_EQUALS(geometry.l2()[i], ws.spectrumInfo().l2(i));
+      TS_ASSERT(std::isnan(geometry.twoTheta()[i]));
+      TS_ASSERT(std::isnan(geometry.difc()[i]));
+    }
+  }
+
+  void test_spectrum_without_detectors() {
+    auto ws = makeWorkspace();
+    ws.getSpectrum(1).clearDetectorIDs();
+    const auto geometry = ws.spectrumGeometry();
+    TS_ASSERT(!geometry->hasDetectors(1));
+    TS_ASSERT(std::isnan(geometry->l2()[1]));
+    TS_ASSERT(std::isnan(geometry->twoTheta()[1]));
+    TS_ASSERT(geometry->hasDetectors(0));
+  }
+
+  void test_spectrum_grouping_a_monitor_with_a_detector_has_no_angles() {
+    auto ws = makeWorkspace();
+    ws.getSpectrum(0).setDetectorIDs({1, 4});
+    std::shared_ptr<const SpectrumGeometry> geometry;
+    TS_ASSERT_THROWS_NOTHING(geometry = ws.spectrumGeometry());
+    TS_ASSERT(geometry->hasDetectors(0));
+    TS_ASSERT(!geometry->isMonitor(0));
+    TS_ASSERT(std::isnan(geometry->twoTheta()[0]));
+    TS_ASSERT(std::isnan(geometry->difc()[0]));
+    TS_ASSERT_EQUALS(geometry->twoTheta()[1], ws.spectrumInfo().twoTheta(1));
+  }
+
+  void test_solid_angles() {
+    auto ws = makeWorkspace();
+    const auto geometry = ws.spectrumGeometry(true);
+    TS_ASSERT(geometry->hasSolidAngles());
+    const auto &componentInfo = ws.componentInfo();
+    const Geometry::SolidAngleParams params(ws.spectrumInfo().samplePosition());
+    for (size_t i = 0; i < 3; ++i)
+      TS_ASSERT_EQUALS(geometry->solidAngle()[i], componentInfo.solidAngle(i, params));
+    // The monitors have no shape
+    TS_ASSERT_EQUALS(geometry->solidAngle()[3], 0.0);
+  }
+
+  void test_ExperimentInfo_caches_until_geometry_changes() {
+    auto ws = makeWorkspace();
+    const auto geometry = ws.spectrumGeometry();
+    TS_ASSERT_EQUALS(ws.spectrumGeometry(), geometry);
+    // Masking does not change the arrays, but may be done through DetectorInfo
+    static_cast<void>(ws.detectorInfo());
+    TS_ASSERT_EQUALS(ws.spectrumGeometry(), geometry);
+
+    ws.mutableDetectorInfo().setPosition(0, V3D(0.0, 1.0, 5.0));
+    const auto moved = ws.spectrumGeometry();
+    TS_ASSERT_DIFFERS(moved, geometry);
+    TS_ASSERT_EQUALS(moved->l2()[0], ws.spectrumInfo().l2(0));
+    // The old arrays are left untouched
+    TS_ASSERT_DIFFERS(geometry->l2()[0], moved->l2()[0]);
+
+    ws.getSpectrum(0).setDetectorIDs({2, 3});
+    const auto regrouped = ws.spectrumGeometry();
+    TS_ASSERT_DIFFERS(regrouped, moved);
+    TS_ASSERT_EQUALS(regrouped->l2()[0], ws.spectrumInfo().l2(0));
+
+    // Requesting solid angles rebuilds once, after which both requests share it
+    const auto withSolidAngles = ws.spectrumGeometry(true);
+    TS_ASSERT_DIFFERS(withSolidAngles, regrouped);
+    TS_ASSERT_EQUALS(ws.spectrumGeometry(), withSolidAngles);
+  }
+
+  void test_ExperimentInfo_rebuilds_after_caching_detector_groupings() {
+    // The path MD workspaces use, through the const grouping setters
+    ExperimentInfo info;
+    info.setInstrument(makeWorkspace().getInstrument());
+    info.setNumberOfDetectorGroups(2);
+    info.setDetectorGrouping(0, {1});
+    info.setDetectorGrouping(1, {2});
+    const auto geometry = info.spectrumGeometry();
+    TS_ASSERT_EQUALS(geometry->size(), 2);
+
+    info.setNumberOfDetectorGroups(3);
+    for (size_t i = 0; i < 3; ++i)
+      info.setDetectorGrouping(i, {static_cast<detid_t>(i + 1)});
+    const auto resized = info.spectrumGeometry();
+    TS_ASSERT_EQUALS(resized->size(), 3);
+    TS_ASSERT_EQUALS(resized->l2()[2], info.spectrumInfo().l2(2));
+
+    info.setDetectorGrouping(2, {1});
+    const auto regrouped = info.spectrumGeometry();
+    TS_ASSERT_DIFFERS(regrouped, resized);
+    TS_ASSERT_EQUALS(regrouped->l2()[2], resized->l2()[0]);
+  }
+
+private:
+  WorkspaceTester makeWorkspace() {
+    WorkspaceTester ws;
+    ws.initialize(5, 2, 1);
+    InstrumentCreationHelper::addFullInstrumentToWorkspace(ws, true, true, "SimpleFakeInstrument");
+    return ws;
+  }
+};
@@ -37,6 +37,8 @@ public:
   int version() const override;
   const std::vector<std::string> seeAlso() const override { return {"ConvertUnits"}; }
   const std::string category() const override;
+  /// The formula may be anything
+  bool isChunkMergeable() const override { return false; }
 
 protected:
   const std::string workspaceMethodName() const override { return ""; }
@@ -13,10 +13,12 @@
 namespace Mantid {
 namespace Geometry {
 class DetectorInfo;
-}
+class ReferenceFrame;
+} // namespace Geometry
 namespace API {
 class MatrixWorkspace;
-}
+class SpectrumInfo;
+} // namespace API
 namespace Algorithms {
 /** Converts the representation of the vertical axis (the one up the side of
     a matrix) of a Workspace2D from its default of holding the
@@ -60,9 +62,11 @@ private:
   /// Converting to theta.
   void createThetaMap(API::Progress &progress, const std::string &targetUnit, API::MatrixWorkspace_sptr &inputWS);
   /// Compute inPlaneTwoTheta
-  double inPlaneTwoTheta(const size_t index, const API::MatrixWorkspace_sptr &inputWS) const;
+  double inPlaneTwoTheta(const size_t index, const API::SpectrumInfo &spectrumInfo,
+                         const Geometry::ReferenceFrame &refFrame) const;
   /// Compute signed in plane two theta
-  double signedInPlaneTwoTheta(const size_t index, const API::MatrixWorkspace_sptr &inputWS) const;
+  double signedInPlaneTwoTheta(const size_t index, const API::SpectrumInfo &spectrumInfo,
+                               const Geometry::ReferenceFrame &refFrame) const;
   /// Converting to Q and QSquared
   void createElasticQMap(API::Progress &progress, const std::string &targetUnit, API::MatrixWorkspace_sptr &inputWS);
   /// Creates an output workspace.
@@ -81,9 +85,10 @@ private:
   /// Emplaces to value and the index pair into the map.
   void emplaceIndexMap(double value, size_t wsIndex);
 
-  /// Getting Efixed
-  double getEfixed(const size_t detectorIndex, const Mantid::Geometry::DetectorInfo &detectorInfo,
-                   const API::MatrixWorkspace &inputWS, const int emode) const;
+  /// Getting the Efixed shared by every detector
+  double getCommonEfixed(const API::MatrixWorkspace &inputWS, const int emode) const;
+  /// Getting the Efixed of a detector
+  double getDetectorEfixed(const size_t detectorIndex, const Mantid::Geometry::DetectorInfo &detectorInfo) const;
 };
 
 } // namespace Algorithms
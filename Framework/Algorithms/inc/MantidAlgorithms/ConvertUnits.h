@@ -32,6 +32,8 @@ public:
   }
   /// Algorithm's category for identification overriding a virtual method
   const std::string category() const override { return "Transforms\\Units"; }
+  bool isChunkMergeable() const override;
+  bool groupMembersAreIndependent() const override { return true; }
 
 protected:
   /// Reverses the workspace if X values are in descending order
@@ -79,6 +79,7 @@ public:
   }
   /// Algorithm's category for identification overriding a virtual method
   const std::string category() const override { return "Diffraction\\Focussing"; }
+  bool isChunkMergeable() const override;
 
 private:
   // Overridden Algorithm methods
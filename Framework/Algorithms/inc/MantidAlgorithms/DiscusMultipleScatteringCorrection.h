@@ -16,6 +16,7 @@
 #include "MantidAlgorithms/SampleCorrections/SparseWorkspace.h"
 #include "MantidGeometry/IComponent.h"
 #include "MantidGeometry/Instrument/SampleEnvironment.h"
+#include "MantidGeometry/Objects/Track.h"
 #include "MantidKernel/PseudoRandomNumberGenerator.h"
 
 #include <boost/container/small_vector.hpp>
@@ -128,6 +129,7 @@ private:
                                                 const double kinc, const std::vector<double> &wValues,
                                                 const Kernel::V3D &detPos, bool specialSingleScatterCalc);
   Geometry::Track start_point(Kernel::PseudoRandomNumberGenerator &rng);
+  void cacheInitialTracks(const size_t nTracks, const int seed);
   Geometry::Track generateInitialTrack(Kernel::PseudoRandomNumberGenerator &rng);
   void inc_xyz(Geometry::Track &track, double vl);
   const Geometry::IObject *updateWeightAndPosition(Geometry::Track &track, double &weight, const double k,
@@ -177,6 +179,8 @@ private:
   bool m_NormalizeSQ{};
   Geometry::BoundingBox m_activeRegion;
   std::unique_ptr<IBeamProfile> m_beamProfile;
+  // tracks into the sample\environment shared by all paths, empty if each path traces its own
+  std::vector<Geometry::Track> m_initialTrackCache;
 };
 } // namespace Algorithms
 } // namespace Mantid
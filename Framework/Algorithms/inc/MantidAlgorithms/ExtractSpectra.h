@@ -33,10 +33,10 @@ private:
   void execHistogram();
   void execEvent();
 
-  void propagateBinMasking(API::MatrixWorkspace &workspace, const int i) const;
+  void propagateBinMasking(API::MatrixWorkspace &workspace) const;
   void checkProperties();
-  std::size_t getXMinIndex(const size_t wsIndex = 0);
-  std::size_t getXMaxIndex(const size_t wsIndex = 0);
+  std::size_t getXMinIndex(const size_t wsIndex = 0) const;
+  std::size_t getXMaxIndex(const size_t wsIndex = 0) const;
   std::size_t histXMaxIndex() const;
   const Kernel::cow_ptr<Mantid::HistogramData::HistogramX> getCroppedXHistogram(const API::MatrixWorkspace &workspace);
   void cropCommon(API::MatrixWorkspace &workspace, Kernel::cow_ptr<Mantid::HistogramData::HistogramX> XHistogram,
@@ -46,6 +46,10 @@ private:
   /// The input workspace
   API::MatrixWorkspace_sptr m_inputWorkspace;
   DataObjects::EventWorkspace_sptr eventW;
+  /// The XMin property, read once as it is needed for every spectrum
+  double m_minX = 0.0;
+  /// The XMax property
+  double m_maxX = 0.0;
   /// The bin index to start the cropped workspace from
   std::size_t m_minXIndex = 0;
   /// The bin index to end the cropped workspace at
@@ -71,6 +71,8 @@ public:
   const std::string category() const override { return "Transforms\\Rebin"; }
   /// Alias for the algorithm. Must override so it doesn't get parent class's
   const std::string alias() const override { return ""; }
+  /// The interpolated errors are not additive
+  bool isChunkMergeable() const override { return false; }
 
 protected:
   const std::string workspaceMethodName() const override { return ""; }
@@ -88,6 +88,7 @@ private:
   void exec() override;
   void execEvent();
   void execHistogram(const std::vector<std::string> &inputs);
+  void sumHistograms(API::MatrixWorkspace &outWS, const std::vector<API::MatrixWorkspace_sptr> &addees);
   void buildAdditionTables();
   // Overriden MultiPeriodGroupAlgorithm method.
   std::string fetchInputPropertyName() const override;
@@ -10,6 +10,7 @@
 #include "MantidAPI/ITableWorkspace_fwd.h"
 #include "MantidAPI/MatrixWorkspace_fwd.h"
 #include "MantidAlgorithms/DllConfig.h"
+#include "MantidDataObjects/EventWorkspace_fwd.h"
 #include "MantidDataObjects/TableWorkspace.h"
 #include "MantidGeometry/IDTypes.h"
 #include <map>
@@ -38,6 +39,8 @@ private:
   void exec() override;
   API::MatrixWorkspace_sptr loadAndBin();
   API::MatrixWorkspace_sptr rebin(API::MatrixWorkspace_sptr wksp);
+  API::MatrixWorkspace_sptr histogramPeakWindows(const DataObjects::EventWorkspace &eventWS,
+                                                 const API::MatrixWorkspace &peakWindowWS);
   API::MatrixWorkspace_sptr load(const std::string &filename);
   std::set<detid_t> detIdsForTable();
   void createCalTableHeader();
@@ -0,0 +1,106 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/MultiThreaded.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <utility>
+#include <vector>
+
+namespace Mantid {
+namespace Algorithms {
+
+/** ParallelBinning2D : deposits the contributions of a loop over input items
+  (usually spectra) into the cells of a 2D output grid from several threads,
+  without locks or atomics.
+
+  The items are split into one contiguous block per thread and each thread
+  deposits into its own copy of the grid. The copies are then combined in
+  block order, so the result does not depend on the timing of the threads and
+  order-dependent updates give the same answer as a serial loop.
+
+  Cell is what is accumulated in each grid cell. A default constructed Cell
+  must be empty, and
+    void Cell::combine(const Cell &later)
+  must fold in the deposits that a serial loop would have made after those
+  already in the cell.
+*/
+template <typename Cell> class ParallelBinning2D {
+public:
+  /// The cells of a grid, stored row by row
+  class Grid {
+  public:
+    Grid() = default;
+    Grid(const size_t numRows, const size_t numColumns)
+        : m_numColumns(numColumns), m_cells(numRows * numColumns) {}
+    Cell &operator()(const size_t row, const size_t column) { return m_cells[row * m_numColumns + column]; }
+    const Cell &operator()(const size_t row, const size_t column) const {
+      return m_cells[row * m_numColumns + column];
+    }
+
+  private:
+    size_t m_numColumns{0};
+    std::vector<Cell> m_cells;
+  };
+
+  ParallelBinning2D(const size_t numRows, const size_t numColumns) : m_numRows(numRows), m_numColumns(numColumns) {}
+
+  /** Run depositItem(item, grid) for every item from 0 to numItems - 1, where
+   * grid is a Grid the item's contributions should be added to.
+   * @param numItems :: the number of items
+   * @param depositItem :: deposits one item into a grid
+   * @param parallel :: whether the items may be deposited by several threads
+   * @return the combined grid
+   * @throw the exception from the first block to fail, if any
+   */
+  template <typename Func> Grid run(const size_t numItems, const Func &depositItem, const bool parallel = true) {
+    const Kernel::ThreadBlocks blocks(numItems, parallel ? static_cast<size_t>(PARALLEL_GET_MAX_THREADS) : 1);
+    const size_t numBlocks = blocks.size();
+    std::vector<Grid> grids(numBlocks);
+    std::vector<std::exception_ptr> errors(numBlocks);
+
+    PRAGMA_OMP(parallel for num_threads(static_cast<int>(numBlocks)) schedule(static, 1) if (numBlocks > 1))
+    for (int64_t i = 0; i < static_cast<int64_t>(numBlocks); ++i) {
+      const auto block = static_cast<size_t>(i);
+      try {
+        // allocated by the thread that fills it
+        auto &grid = grids[block];
+        grid = Grid(m_numRows, m_numColumns);
+        for (size_t item = blocks.begin(block); item < blocks.end(block); ++item)
+          depositItem(item, grid);
+      } catch (...) {
+        errors[block] = std::current_exception();
+      }
+    }
+    for (const auto &error : errors) {
+      if (error)
+        std::rethrow_exception(error);
+    }
+
+    // Each thread combines whole rows, so no two write to the same cell
+    auto &result = grids.front();
+    PRAGMA_OMP(parallel for if (numBlocks > 1))
+    for (int64_t i = 0; i < static_cast<int64_t>(m_numRows); ++i) {
+      const auto row = static_cast<size_t>(i);
+      for (size_t block = 1; block < numBlocks; ++block) {
+        for (size_t column = 0; column < m_numColumns; ++column)
+          result(row, column).combine(grids[block](row, column));
+      }
+    }
+    return std::move(result);
+  }
+
+private:
+  size_t m_numRows;
+  size_t m_numColumns;
+};
+
+} // namespace Algorithms
+} // namespace Mantid
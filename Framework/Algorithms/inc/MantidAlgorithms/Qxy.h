@@ -11,6 +11,20 @@
 
 namespace Mantid {
 namespace Algorithms {
+/// The sums for one Qx-Qy cell, which Qxy deposits into from several threads
+struct MANTID_ALGORITHMS_DLL QxyCell {
+  double signal{0.};
+  double errorSq{0.};
+  double weight{0.};
+  double weightErrorSq{0.};
+  bool hasData{false};
+  /// A deposit found a NaN signal and dropped everything deposited before it
+  bool wasReset{false};
+
+  void deposit(const double y, const double e);
+  void combine(const QxyCell &later);
+};
+
 /** This algorithm rebins a 2D workspace in units of wavelength into 2D Q.
     The result is stored in a 2D workspace with units of Q on both axes.
     @todo Doesn't (yet) calculate the errors.
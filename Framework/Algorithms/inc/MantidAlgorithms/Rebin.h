@@ -58,6 +58,8 @@ public:
     return {"RebinToWorkspace", "Rebin2D", "Rebunch", "Regroup", "RebinByPulseTimes", "RebinByTimeAtSample"};
   }
   std::map<std::string, std::string> validateInputs() override;
+  bool isChunkMergeable() const override;
+  bool groupMembersAreIndependent() const override { return true; }
 
   static std::vector<double> rebinParamsFromInput(const std::vector<double> &inParams,
                                                   const API::MatrixWorkspace &inputWS, Kernel::Logger &logger,
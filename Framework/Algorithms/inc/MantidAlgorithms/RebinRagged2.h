@@ -22,6 +22,8 @@ public:
   const std::vector<std::string> seeAlso() const override { return {"Rebin", "ResampleX"}; }
   /// Alias for the algorithm. Must override so it doesn't get parent class's
   const std::string alias() const override { return ""; }
+  /// The binning of each spectrum may come from the data
+  bool isChunkMergeable() const override { return false; }
 
 private:
   void init() override;
@@ -49,7 +49,8 @@ private:
   template <typename T> void createBinnedOutput(const Kernel::TimeSeriesProperty<T> *log);
 
   void filterEventList(const API::IEventList &eventList, const int minVal, const int maxVal,
-                       const Kernel::TimeSeriesProperty<int> *log, std::vector<int> &Y);
+                       const std::vector<Types::Core::DateAndTime> &logTimes, const std::vector<int> &logValues,
+                       std::vector<int> &Y);
   void addMonitorCounts(const API::ITableWorkspace_sptr &outputWorkspace, const Kernel::TimeSeriesProperty<int> *log,
                         const int minVal, const int maxVal);
   std::vector<std::pair<std::string, const Kernel::ITimeSeriesProperty *>> getNumberSeriesLogs();
@@ -12,6 +12,9 @@
 #include <set>
 
 namespace Mantid {
+namespace DataObjects {
+class EventWorkspace;
+}
 namespace Algorithms {
 /** Takes a workspace as input and sums all of the spectra within it maintaining
    the existing bin structure and units.
@@ -31,8 +34,13 @@ namespace Algorithms {
     <LI> EndSpectrum - Workspace index number to integrate to (default max)</LI>
     <LI> IncludeMonitors - Whether to include monitor spectra in the sum
    (default yes)
+    <LI> UseKahanSummation - Whether to use compensated summation for
+   histograms (default no)
     </UL>
 
+    The spectra are summed in parallel: each thread adds a contiguous block of
+   spectra into its own partial sums, which are then added together pairwise.
+
     @author Nick Draper, Tessella Support Services plc
     @date 22/01/2009
  */
@@ -55,6 +63,7 @@ public:
   const std::string category() const override { return "Transforms\\Grouping"; }
   /// Cross-input validation
   std::map<std::string, std::string> validateInputs() override;
+  bool isChunkMergeable() const override;
 
 private:
   /// Handle logic for RebinnedOutput workspaces
@@ -70,6 +79,12 @@ private:
   void execEvent(const API::MatrixWorkspace_sptr &outputWorkspace, API::Progress &progress, size_t &numSpectra,
                  size_t &numMasked, size_t &numZeros);
   specnum_t getOutputSpecNo(const API::MatrixWorkspace_const_sptr &localworkspace);
+  template <typename Partial, typename AddSpectrum>
+  Partial sumInParallel(const std::vector<size_t> &indices, const Partial &empty, bool threadSafe,
+                        API::Progress &progress, const AddSpectrum &addSpectrum);
+  template <typename Event>
+  void copyEvents(const DataObjects::EventWorkspace &inputWorkspace, const std::vector<size_t> &indices,
+                  const std::vector<size_t> &offsets, std::vector<Event> &events, API::Progress &progress);
 
   API::MatrixWorkspace_sptr replaceSpecialValues();
   void determineIndices(const size_t numberOfSpectra);
@@ -91,6 +106,8 @@ private:
   // necessary
   bool m_calculateWeightedSum{false};
   bool m_multiplyByNumSpec{true};
+  /// Set true to use compensated summation of the histograms
+  bool m_useKahanSummation{false};
 };
 
 } // namespace Algorithms
@@ -26,6 +26,7 @@
 #include "MantidTypes/SpectrumDefinition.h"
 
 #include <cfloat>
+#include <exception>
 
 constexpr double rad2deg = 180.0 / M_PI;
 
@@ -127,9 +128,45 @@ void ConvertSpectrumAxis2::createThetaMap(API::Progress &progress, const std::st
   } else if (targetUnit == "SignedInPlaneTwoTheta") {
     thetaType = signedInPlaneTheta;
   }
-  bool warningGiven = false;
-
   const auto &spectrumInfo = inputWS->spectrumInfo();
+  const auto &refFrame = *inputWS->getInstrument()->getReferenceFrame();
+
+  // The angles are independent, the index map is filled in order afterwards
+  const auto nHist = static_cast<int64_t>(spectrumInfo.size());
+  std::vector<double> angles(spectrumInfo.size(), 0.0);
+  // The first exception thrown by any thread, rethrown unchanged once the loop is done
+  std::exception_ptr error;
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < nHist; ++i) {
+    try {
+      if (spectrumInfo.hasDetectors(i) && !spectrumInfo.isMonitor(i)) {
+        switch (thetaType) {
+        case signedTheta:
+          angles[i] = spectrumInfo.signedTwoTheta(i) * rad2deg;
+          break;
+        case theta:
+          angles[i] = spectrumInfo.twoTheta(i) * rad2deg;
+          break;
+        case inPlaneTheta:
+          angles[i] = inPlaneTwoTheta(i, spectrumInfo, refFrame) * rad2deg;
+          break;
+        case signedInPlaneTheta:
+          angles[i] = signedInPlaneTwoTheta(i, spectrumInfo, refFrame) * rad2deg;
+          break;
+        }
+      }
+      progress.report("Converting to theta...");
+    } catch (...) {
+      PARALLEL_CRITICAL(ConvertSpectrumAxis2_theta_error)
+      if (!error)
+        error = std::current_exception();
+    }
+  }
+  if (error)
+    std::rethrow_exception(error);
+  interruption_point();
+
+  bool warningGiven = false;
   for (size_t i = 0; i < spectrumInfo.size(); ++i) {
     if (!spectrumInfo.hasDetectors(i)) {
       if (!warningGiven)
@@ -138,26 +175,7 @@ void ConvertSpectrumAxis2::createThetaMap(API::Progress &progress, const std::st
       warningGiven = true;
       continue;
     }
-    if (!spectrumInfo.isMonitor(i)) {
-      switch (thetaType) {
-      case signedTheta:
-        emplaceIndexMap(spectrumInfo.signedTwoTheta(i) * rad2deg, i);
-        break;
-      case theta:
-        emplaceIndexMap(spectrumInfo.twoTheta(i) * rad2deg, i);
-        break;
-      case inPlaneTheta:
-        emplaceIndexMap(inPlaneTwoTheta(i, inputWS) * rad2deg, i);
-        break;
-      case signedInPlaneTheta:
-        emplaceIndexMap(signedInPlaneTwoTheta(i, inputWS) * rad2deg, i);
-        break;
-      }
-    } else {
-      emplaceIndexMap(0.0, i);
-    }
-
-    progress.report("Converting to theta...");
+    emplaceIndexMap(angles[i], i);
   }
 }
 
@@ -166,15 +184,14 @@ void ConvertSpectrumAxis2::createThetaMap(API::Progress &progress, const std::st
  *
  * Throws an exception if the spectrum is a monitor.
  * @param index :: the index of the spectrum
- * @param inputWS :: input workspace
+ * @param spectrumInfo :: spectrum info of the input workspace
+ * @param refFrame :: reference frame of the instrument
  */
-double ConvertSpectrumAxis2::inPlaneTwoTheta(const size_t index, const API::MatrixWorkspace_sptr &inputWS) const {
-  const auto spectrumInfo = inputWS->spectrumInfo();
-  const auto refFrame = inputWS->getInstrument()->getReferenceFrame();
+double ConvertSpectrumAxis2::inPlaneTwoTheta(const size_t index, const API::SpectrumInfo &spectrumInfo,
+                                             const Geometry::ReferenceFrame &refFrame) const {
   const V3D position = spectrumInfo.position(index) - spectrumInfo.samplePosition();
 
-  double angle =
-      std::atan2(std::abs(position[refFrame->pointingHorizontal()]), position[refFrame->pointingAlongBeam()]);
+  double angle = std::atan2(std::abs(position[refFrame.pointingHorizontal()]), position[refFrame.pointingAlongBeam()]);
   return angle;
 }
 
@@ -183,12 +200,11 @@ double ConvertSpectrumAxis2::inPlaneTwoTheta(const size_t index, const API::Matr
  *
  * Throws an exception if the spectrum is a monitor.
  * @param index :: the index of the spectrum
- * @param inputWS :: input workspace
+ * @param spectrumInfo :: spectrum info of the input workspace
+ * @param refFrame :: reference frame of the instrument
  */
-double ConvertSpectrumAxis2::signedInPlaneTwoTheta(const size_t index, const API::MatrixWorkspace_sptr &inputWS) const {
-  const auto spectrumInfo = inputWS->spectrumInfo();
-  const auto refFrame = inputWS->getInstrument()->getReferenceFrame();
-
+double ConvertSpectrumAxis2::signedInPlaneTwoTheta(const size_t index, const API::SpectrumInfo &spectrumInfo,
+                                                   const Geometry::ReferenceFrame &refFrame) const {
   const auto samplePos = spectrumInfo.samplePosition();
   const auto beamLine = samplePos - spectrumInfo.sourcePosition();
 
@@ -198,7 +214,7 @@ double ConvertSpectrumAxis2::signedInPlaneTwoTheta(const size_t index, const API
 
   const V3D sampleDetVec = spectrumInfo.position(index) - samplePos;
 
-  return std::atan2(sampleDetVec[refFrame->pointingHorizontal()], sampleDetVec[refFrame->pointingAlongBeam()]);
+  return std::atan2(sampleDetVec[refFrame.pointingHorizontal()], sampleDetVec[refFrame.pointingAlongBeam()]);
 }
 
 /** Convert X axis to Elastic Q representation
@@ -218,44 +234,62 @@ void ConvertSpectrumAxis2::createElasticQMap(API::Progress &progress, const std:
 
   const auto &spectrumInfo = inputWS->spectrumInfo();
   const auto &detectorInfo = inputWS->detectorInfo();
-  const size_t nHist = spectrumInfo.size();
-  for (size_t i = 0; i < nHist; i++) {
-    double theta(0.0), efixed(0.0);
-    if (!spectrumInfo.isMonitor(i)) {
-      theta = 0.5 * spectrumInfo.twoTheta(i);
-      /*
-       * Two assumptions made in the following code.
-       * 1. Getting the detector index of the first detector in the spectrum
-       * definition is enough (this should be completely safe).
-       * 2. That the time index is not important (first element of pair only
-       * accessed). i.e we are not performing scanning. Step scanning is not
-       * supported at the time of writing.
-       */
-      const auto detectorIndex = spectrumInfo.spectrumDefinition(i)[0].first;
-      efixed = getEfixed(detectorIndex, detectorInfo, *inputWS,
-                         emode); // get efixed
-    } else {
-      theta = DBL_MIN;
-      efixed = DBL_MIN;
-    }
+  // Only an indirect geometry without the Efixed property looks it up for each detector
+  const double commonEfixed = getCommonEfixed(*inputWS, emode);
+  const auto nHist = static_cast<int64_t>(spectrumInfo.size());
+  std::vector<double> values(spectrumInfo.size());
+  // The first exception thrown by any thread, rethrown unchanged once the loop is done
+  std::exception_ptr error;
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < nHist; i++) {
+    try {
+      double theta(0.0), efixed(0.0);
+      if (!spectrumInfo.isMonitor(i)) {
+        theta = 0.5 * spectrumInfo.twoTheta(i);
+        if (commonEfixed != EMPTY_DBL()) {
+          efixed = commonEfixed;
+        } else {
+          /*
+           * Two assumptions made in the following code.
+           * 1. Getting the detector index of the first detector in the spectrum
+           * definition is enough (this should be completely safe).
+           * 2. That the time index is not important (first element of pair only
+           * accessed). i.e we are not performing scanning. Step scanning is not
+           * supported at the time of writing.
+           */
+          const auto detectorIndex = spectrumInfo.spectrumDefinition(i)[0].first;
+          efixed = getDetectorEfixed(detectorIndex, detectorInfo);
+        }
+      } else {
+        theta = DBL_MIN;
+        efixed = DBL_MIN;
+      }
 
-    // Convert to MomentumTransfer
-    double elasticQInAngstroms = Kernel::UnitConversion::convertToElasticQ(theta, efixed);
+      // Convert to MomentumTransfer
+      double elasticQInAngstroms = Kernel::UnitConversion::convertToElasticQ(theta, efixed);
 
-    if (targetUnit == "ElasticQ") {
-      emplaceIndexMap(elasticQInAngstroms, i);
-    } else if (targetUnit == "ElasticQSquared") {
-      // The QSquared value.
-      double elasticQSquaredInAngstroms = elasticQInAngstroms * elasticQInAngstroms;
+      if (targetUnit == "ElasticQ") {
+        values[i] = elasticQInAngstroms;
+      } else if (targetUnit == "ElasticQSquared") {
+        // The QSquared value.
+        values[i] = elasticQInAngstroms * elasticQInAngstroms;
+      } else if (targetUnit == "ElasticDSpacing") {
+        values[i] = 2 * M_PI / elasticQInAngstroms;
+      }
 
-      emplaceIndexMap(elasticQSquaredInAngstroms, i);
-    } else if (targetUnit == "ElasticDSpacing") {
-      double elasticDSpacing = 2 * M_PI / elasticQInAngstroms;
-      emplaceIndexMap(elasticDSpacing, i);
+      progress.report("Converting to " + targetUnit);
+    } catch (...) {
+      PARALLEL_CRITICAL(ConvertSpectrumAxis2_elasticQ_error)
+      if (!error)
+        error = std::current_exception();
     }
-
-    progress.report("Converting to " + targetUnit);
   }
+  if (error)
+    std::rethrow_exception(error);
+  interruption_point();
+
+  for (size_t i = 0; i < values.size(); i++)
+    emplaceIndexMap(values[i], i);
 }
 
 /** Create the final output workspace after converting the X axis
@@ -301,54 +335,70 @@ MatrixWorkspace_sptr ConvertSpectrumAxis2::createOutputWorkspace(API::Progress &
   outputWorkspace->replaceAxis(1, std::move(newAxis));
   // Note that this is needed only for ordered case
   if (m_toOrder) {
-    size_t currentIndex = 0;
-    std::multimap<double, size_t>::const_iterator it;
-    for (it = m_indexMap.begin(); it != m_indexMap.end(); ++it) {
+    std::vector<size_t> inputIndices;
+    inputIndices.reserve(m_indexMap.size());
+    std::transform(m_indexMap.cbegin(), m_indexMap.cend(), std::back_inserter(inputIndices),
+                   [](const auto &it) { return it.second; });
+    const MatrixWorkspace &input = *inputWS;
+    PARALLEL_FOR_IF(Kernel::threadSafe(input, *outputWorkspace))
+    for (int64_t currentIndex = 0; currentIndex < static_cast<int64_t>(inputIndices.size()); ++currentIndex) {
+      PARALLEL_START_INTERRUPT_REGION
+      auto &spectrum = outputWorkspace->getSpectrum(currentIndex);
       // Copy over the data.
-      outputWorkspace->getSpectrum(currentIndex).copyDataFrom(inputWS->getSpectrum(it->second));
+      spectrum.copyDataFrom(input.getSpectrum(inputIndices[currentIndex]));
       // We can keep the spectrum numbers etc.
-      outputWorkspace->getSpectrum(currentIndex).copyInfoFrom(inputWS->getSpectrum(it->second));
-      ++currentIndex;
-      progress.report("Setting output spectrum #" + std::to_string(currentIndex));
+      spectrum.copyInfoFrom(input.getSpectrum(inputIndices[currentIndex]));
+      progress.report("Setting output spectrum #" + std::to_string(currentIndex + 1));
+      PARALLEL_END_INTERRUPT_REGION
     }
+    PARALLEL_CHECK_INTERRUPT_REGION
   }
 
   return outputWorkspace;
 }
 
-double ConvertSpectrumAxis2::getEfixed(const size_t detectorIndex, const Geometry::DetectorInfo &detectorInfo,
-                                       const Mantid::API::MatrixWorkspace &inputWS, const int emode) const {
-  double efixed(0);
-  double efixedProp = getProperty("Efixed");
-  Mantid::detid_t detectorID = detectorInfo.detectorIDs()[detectorIndex];
+/** Get the Efixed that is the same for every detector: the Efixed property
+ * if it is set, otherwise the incident energy of a direct geometry.
+ * @param inputWS :: the input workspace
+ * @param emode :: the energy mode, 1 for direct and 2 for indirect
+ * @return the Efixed, or EMPTY_DBL() if it has to be found for each detector
+ * @throw std::invalid_argument if a direct geometry workspace has no Ei log
+ */
+double ConvertSpectrumAxis2::getCommonEfixed(const API::MatrixWorkspace &inputWS, const int emode) const {
+  const double efixedProp = getProperty("Efixed");
   if (efixedProp != EMPTY_DBL()) {
-    efixed = efixedProp;
-    g_log.debug() << "Detector: " << detectorID << " Efixed: " << efixed << "\n";
-  } else {
-    if (emode == 1) {
-      if (inputWS.run().hasProperty("Ei")) {
-        efixed = inputWS.run().getLogAsSingleValue("Ei");
-      } else {
-        throw std::invalid_argument("Could not retrieve Efixed from the "
-                                    "workspace. Please provide a value.");
-      }
-    } else if (emode == 2) {
-
-      const auto &detectorSingle = detectorInfo.detector(detectorIndex);
-
-      std::vector<double> efixedVec = detectorSingle.getNumberParameter("Efixed");
-
-      if (!efixedVec.empty()) {
-        efixed = efixedVec.at(0);
-        g_log.debug() << "Detector: " << detectorID << " EFixed: " << efixed << "\n";
-      } else {
-        g_log.warning() << "Efixed could not be found for detector " << detectorID << ", please provide a value\n";
-        throw std::invalid_argument("Could not retrieve Efixed from the "
-                                    "detector. Please provide a value.");
-      }
+    g_log.debug() << "Efixed: " << efixedProp << "\n";
+    return efixedProp;
+  }
+  if (emode == 1) {
+    if (inputWS.run().hasProperty("Ei")) {
+      return inputWS.run().getLogAsSingleValue("Ei");
     }
+    throw std::invalid_argument("Could not retrieve Efixed from the "
+                                "workspace. Please provide a value.");
+  }
+  if (emode == 2)
+    return EMPTY_DBL();
+  return 0.;
+}
+
+/** Get the Efixed parameter of a detector in an indirect geometry.
+ * @param detectorIndex :: the index of the detector
+ * @param detectorInfo :: detector info of the input workspace
+ * @return the Efixed of the detector
+ * @throw std::invalid_argument if the detector has no Efixed parameter
+ */
+double ConvertSpectrumAxis2::getDetectorEfixed(const size_t detectorIndex,
+                                               const Geometry::DetectorInfo &detectorInfo) const {
+  const Mantid::detid_t detectorID = detectorInfo.detectorIDs()[detectorIndex];
+  const std::vector<double> efixedVec = detectorInfo.detector(detectorIndex).getNumberParameter("Efixed");
+  if (efixedVec.empty()) {
+    g_log.warning() << "Efixed could not be found for detector " << detectorID << ", please provide a value\n";
+    throw std::invalid_argument("Could not retrieve Efixed from the "
+                                "detector. Please provide a value.");
   }
-  return efixed;
+  g_log.debug() << "Detector: " << detectorID << " EFixed: " << efixedVec.at(0) << "\n";
+  return efixedVec.at(0);
 }
 
 /** Emplaces inside the ordered or unordered index registry
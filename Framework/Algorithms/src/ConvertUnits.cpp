@@ -72,6 +72,13 @@ void ConvertUnits::init() {
                   "the Points to Bins. The Output Workspace will contains Bins.");
 }
 
+/// Each bin is converted on its own unless AlignBins rebins onto a range
+/// taken from the data.
+bool ConvertUnits::isChunkMergeable() const {
+  const bool alignBins = getProperty("AlignBins");
+  return !alignBins;
+}
+
 /** Executes the algorithm
  *  @throw std::runtime_error :: Thrown in the following cases:
  *   - If the input workspace has not had its unit set
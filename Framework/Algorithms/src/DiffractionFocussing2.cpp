@@ -95,6 +95,17 @@ std::map<std::string, std::string> DiffractionFocussing2::validateInputs() {
   return issues;
 }
 
+/** Focussing sums spectra onto a binning per group that is derived from the
+ * input X values. Histograms with the same binning can be added, which the
+ * binary operations check, but focussed events would silently keep the binning
+ * of the first input.
+ */
+bool DiffractionFocussing2::isChunkMergeable() const {
+  const bool preserveEvents = getProperty("PreserveEvents");
+  MatrixWorkspace_const_sptr inputWS = getProperty("InputWorkspace");
+  return !(preserveEvents && std::dynamic_pointer_cast<const EventWorkspace>(inputWS));
+}
+
 //=============================================================================
 /** Perform clean-up of memory after execution but before destructor.
  * Private method
@@ -182,6 +182,14 @@ void DiscusMultipleScatteringCorrection::init() {
                   "Enable normalization of supplied structure factor(s). May be required when running a calculation "
                   "involving more than one material where the normalization of the default S(Q)=1 structure factor "
                   "doesn't match the normalization of a supplied non-isotropic structure factor");
+  auto nonNegativeInt = std::make_shared<Kernel::BoundedValidator<int>>();
+  nonNegativeInt->setLower(0);
+  declareProperty("NumberOfCachedInitialTracks", 0, nonNegativeInt,
+                  "The number of tracks from the source into the sample and environment that are traced once, "
+                  "before the simulation starts, and then picked at random for every path instead of tracing a new "
+                  "one. The tracks are shared by all spectra and simulation points, so this should be large "
+                  "compared to the number of distinct entry paths through the shapes. Zero traces a new track for "
+                  "every path");
 }
 
 /**
@@ -579,6 +587,9 @@ void DiscusMultipleScatteringCorrection::exec() {
 
   const auto &spectrumInfo = instrumentWS.spectrumInfo();
 
+  const int nCachedInitialTracks = getProperty("NumberOfCachedInitialTracks");
+  cacheInitialTracks(static_cast<size_t>(nCachedInitialTracks), seed);
+
   PARALLEL_FOR_IF(enableParallelFor)
   for (int64_t i = 0; i < static_cast<int64_t>(nhists); ++i) { // signed int for openMP loop
     PARALLEL_START_INTERRUPT_REGION
@@ -1418,7 +1429,9 @@ DiscusMultipleScatteringCorrection::scatter(const int nScatters, Kernel::PseudoR
                                             bool specialSingleScatterCalc) {
   double weight = 1;
 
-  auto track = start_point(rng);
+  auto track = m_initialTrackCache.empty()
+                   ? start_point(rng)
+                   : m_initialTrackCache[rng.nextInt(0, static_cast<int>(m_initialTrackCache.size()) - 1)];
   auto shapeObjectWithScatter =
       updateWeightAndPosition(track, weight, kinc, rng, specialSingleScatterCalc, componentWorkspaces);
   double scatteringXSection;
@@ -1732,6 +1745,24 @@ Geometry::Track DiscusMultipleScatteringCorrection::start_point(Kernel::PseudoRa
       std::to_string(m_maxScatterPtAttempts) + " attempts. Try increasing MaxScatterPtAttempts");
 }
 
+/**
+ * Trace tracks from the source into the sample and environment up front so that paths can start from a copy of
+ * one instead of intersecting a new track with every shape. The tracks are generated exactly as start_point does,
+ * so picking one uniformly at random samples the same distribution of entry paths
+ * @param nTracks The number of tracks to cache, or zero to generate a new track for every path
+ * @param seed The seed for the random number generator used to generate the tracks
+ */
+void DiscusMultipleScatteringCorrection::cacheInitialTracks(const size_t nTracks, const int seed) {
+  m_initialTrackCache.clear();
+  if (nTracks == 0)
+    return;
+  m_initialTrackCache.reserve(nTracks);
+  MersenneTwister rng(seed);
+  for (size_t i = 0; i < nTracks; i++)
+    m_initialTrackCache.emplace_back(start_point(rng));
+  g_log.information() << "Cached " << nTracks << " initial tracks\n";
+}
+
 /** update track start point and weight. The weight is based on a change of variables from length to t1
  * as described in Mancinelli paper
  * @param track A track defining the current trajectory
@@ -15,6 +15,7 @@
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
+#include "MantidKernel/make_cow.h"
 
 #include <algorithm>
 
@@ -126,6 +127,8 @@ void ExtractSpectra::init() {
  */
 void ExtractSpectra::exec() {
   m_inputWorkspace = getProperty("InputWorkspace");
+  m_minX = getProperty("XMin");
+  m_maxX = getProperty("XMax");
   m_isHistogramData = m_inputWorkspace->isHistogramData();
   m_commonBoundaries = m_inputWorkspace->isCommonBins();
   this->checkProperties();
@@ -162,15 +165,19 @@ void ExtractSpectra::execHistogram() {
   auto size = static_cast<int>(m_inputWorkspace->getNumberHistograms());
   auto croppedCommonXHistogram = getCroppedXHistogram(*m_inputWorkspace);
   Progress prog(this, 0.0, 1.0, size);
+  PARALLEL_FOR_IF(Kernel::threadSafe(*m_inputWorkspace))
   for (int i = 0; i < size; ++i) {
+    PARALLEL_START_INTERRUPT_REGION
     if (m_commonBoundaries) {
       this->cropCommon(*m_inputWorkspace, croppedCommonXHistogram, i);
     } else {
       this->cropRagged(*m_inputWorkspace, i);
     }
-    propagateBinMasking(*m_inputWorkspace, i);
     prog.report();
+    PARALLEL_END_INTERRUPT_REGION
   }
+  PARALLEL_CHECK_INTERRUPT_REGION
+  propagateBinMasking(*m_inputWorkspace);
 }
 
 /** Returns a pointer to a cropped X Histogram to be used as the X Histogram
@@ -203,17 +210,22 @@ void ExtractSpectra::cropCommon(API::MatrixWorkspace &workspace,
   auto begin = m_minXIndex;
   auto end = histXMaxIndex();
 
+  // Drop the data before resizing so that only the X values are copied by resize
   auto cropped(hist);
+  if (cropped.sharedY())
+    cropped.setSharedY(nullptr);
+  cropped.setSharedE(nullptr);
+  cropped.setSharedDx(nullptr);
   cropped.resize(end - begin);
 
   cropped.setSharedX(XHistogram);
 
-  if (cropped.sharedY())
-    cropped.mutableY().assign(hist.y().begin() + begin, hist.y().begin() + end);
-  if (cropped.sharedE())
-    cropped.mutableE().assign(hist.e().begin() + begin, hist.e().begin() + end);
-  if (cropped.sharedDx())
-    cropped.mutableDx().assign(hist.dx().begin() + begin, hist.dx().begin() + end);
+  if (hist.sharedY())
+    cropped.setSharedY(Kernel::make_cow<HistogramY>(hist.y().begin() + begin, hist.y().begin() + end));
+  if (hist.sharedE())
+    cropped.setSharedE(Kernel::make_cow<HistogramE>(hist.e().begin() + begin, hist.e().begin() + end));
+  if (hist.sharedDx())
+    cropped.setSharedDx(Kernel::make_cow<HistogramDx>(hist.dx().begin() + begin, hist.dx().begin() + end));
 
   workspace.setHistogram(index, cropped);
 }
@@ -308,17 +320,21 @@ void ExtractSpectra::execEvent() {
         el.setPointStandardDeviations(oldDx.begin() + m_minXIndex, oldDx.begin() + end);
       }
     }
-    propagateBinMasking(*eventW, i);
     prog.report();
     PARALLEL_END_INTERRUPT_REGION
   }
   PARALLEL_CHECK_INTERRUPT_REGION
+  propagateBinMasking(*eventW);
 }
 
-/// Propagate bin masking if there is any.
-void ExtractSpectra::propagateBinMasking(MatrixWorkspace &workspace, const int i) const {
+/// Propagate bin masking if there is any. This is not thread safe.
+void ExtractSpectra::propagateBinMasking(MatrixWorkspace &workspace) const {
+  if (!workspace.hasAnyMaskedBins())
+    return;
   auto end = histXMaxIndex();
-  if (workspace.hasMaskedBins(i)) {
+  for (size_t i = 0; i < workspace.getNumberHistograms(); ++i) {
+    if (!workspace.hasMaskedBins(i))
+      continue;
     MatrixWorkspace::MaskList filteredMask;
     for (const auto &mask : workspace.maskedBins(i)) {
       const size_t maskIndex = mask.first;
@@ -396,8 +412,8 @@ void ExtractSpectra::checkProperties() {
  *  @param  wsIndex The workspace index to check (default 0).
  *  @return The X index corresponding to the XMin value.
  */
-size_t ExtractSpectra::getXMinIndex(const size_t wsIndex) {
-  double minX_val = getProperty("XMin");
+size_t ExtractSpectra::getXMinIndex(const size_t wsIndex) const {
+  double minX_val = m_minX;
   size_t xIndex = 0;
   if (!isEmpty(minX_val)) { // A value has been passed to the algorithm, check
                             // it and maybe store it
@@ -421,11 +437,11 @@ size_t ExtractSpectra::getXMinIndex(const size_t wsIndex) {
  *  @param  wsIndex The workspace index to check (default 0).
  *  @return The X index corresponding to the XMax value.
  */
-size_t ExtractSpectra::getXMaxIndex(const size_t wsIndex) {
+size_t ExtractSpectra::getXMaxIndex(const size_t wsIndex) const {
   const auto &X = m_inputWorkspace->x(wsIndex);
   size_t xIndex = X.size();
   // get the value that the user entered if they entered one at all
-  double maxX_val = getProperty("XMax");
+  double maxX_val = m_maxX;
   if (!isEmpty(maxX_val)) { // we have a user value, check it and maybe store it
     if (m_commonBoundaries && maxX_val < X.front()) {
       std::stringstream msg;
@@ -72,12 +72,15 @@ void ExtractSpectra2::exec() {
     }
   }
 
+  const MatrixWorkspace &input = *inputWS;
   Progress prog(this, 0.0, 1.0, indexSet.size());
-  for (size_t j = 0; j < indexSet.size(); ++j) {
+  PARALLEL_FOR_IF(Kernel::threadSafe(input, *outputWS))
+  for (int64_t j = 0; j < static_cast<int64_t>(indexSet.size()); ++j) {
+    PARALLEL_START_INTERRUPT_REGION
     // Rely on Indexing::IndexSet preserving index order.
     const size_t i = indexSet[j];
     // Copy spectrum data, automatically setting up sharing for histogram.
-    outputWS->getSpectrum(j).copyDataFrom(inputWS->getSpectrum(i));
+    outputWS->getSpectrum(j).copyDataFrom(input.getSpectrum(i));
 
     // Copy axis entry, SpectraAxis is implicit in workspace creation
     if (outTxtAxis)
@@ -85,11 +88,18 @@ void ExtractSpectra2::exec() {
     else if (outNumAxis)
       outNumAxis->setValue(j, inAxis1->operator()(i));
 
-    // Copy bin masking if it exists.
-    if (inputWS->hasMaskedBins(i))
-      outputWS->setMaskedBins(j, inputWS->maskedBins(i));
-
     prog.report();
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
+  // Copy bin masking if it exists, which is not thread safe.
+  if (input.hasAnyMaskedBins()) {
+    for (size_t j = 0; j < indexSet.size(); ++j) {
+      const size_t i = indexSet[j];
+      if (input.hasMaskedBins(i))
+        outputWS->setMaskedBins(j, input.maskedBins(i));
+    }
   }
 
   if (isBinEdgeAxis) {
@@ -10,6 +10,7 @@
 #include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/Axis.h"
 #include "MantidAPI/Run.h"
+#include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidAlgorithms/RunCombinationHelpers/RunCombinationHelper.h"
 #include "MantidAlgorithms/RunCombinationHelpers/SampleLogsBehaviour.h"
@@ -20,7 +21,9 @@
 #include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/KahanSum.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/PropertyWithValue.h"
 #include "MantidKernel/Unit.h"
 #include "MantidKernel/VectorHelper.h"
@@ -40,6 +43,34 @@ using namespace Geometry;
 using namespace DataObjects;
 using namespace RunCombinationOptions;
 
+namespace {
+/** Add a spectrum of each of the addees to the same spectrum of the output:
+ * the Y values are summed and the errors added in quadrature, as Plus does.
+ * Sum is either double or Kernel::KahanSum.
+ */
+template <typename Sum>
+void addSpectrum(MatrixWorkspace &outWS, const std::vector<MatrixWorkspace_sptr> &addees, const size_t index) {
+  auto &y = outWS.mutableY(index);
+  auto &e = outWS.mutableE(index);
+  std::vector<Sum> ySum(y.cbegin(), y.cend());
+  std::vector<Sum> eSquared(e.size());
+  for (size_t i = 0; i < e.size(); ++i)
+    eSquared[i] += e[i] * e[i];
+  for (const auto &addee : addees) {
+    const auto &addeeY = addee->y(index);
+    const auto &addeeE = addee->e(index);
+    for (size_t i = 0; i < y.size(); ++i) {
+      ySum[i] += addeeY[i];
+      eSquared[i] += addeeE[i] * addeeE[i];
+    }
+  }
+  for (size_t i = 0; i < y.size(); ++i) {
+    y[i] = static_cast<double>(ySum[i]);
+    e[i] = std::sqrt(static_cast<double>(eSquared[i]));
+  }
+}
+} // namespace
+
 /// Initialisation method
 void MergeRuns::init() {
   // declare arbitrary number of input workspaces as a list of strings at the
@@ -65,6 +96,9 @@ void MergeRuns::init() {
   declareProperty("FailBehaviour", SKIP_BEHAVIOUR, std::make_shared<StringListValidator>(failBehaviourOptions),
                   "Choose whether to skip the file and continue, or stop and "
                   "throw and error, when encountering a failure.");
+  declareProperty("UseKahanSummation", false,
+                  "Accumulate the sums with compensated (Kahan) summation. "
+                  "Only used when adding histogram workspaces that need no rebinning.");
 }
 
 // @return the name of the property used to supply in input workspace(s).
@@ -276,35 +310,57 @@ void MergeRuns::execEvent() {
   EventWorkspace_sptr inputWS = m_inEventWS[0];
   auto outWS = create<EventWorkspace>(*inputWS, m_outputSize, inputWS->binEdges(0));
   const auto inputSize = inputWS->getNumberHistograms();
-  for (size_t i = 0; i < inputSize; ++i)
-    outWS->getSpectrum(i) = inputWS->getSpectrum(i);
-
-  int64_t n = m_inEventWS.size() - 1;
-  m_progress = std::make_unique<Progress>(this, 0.0, 1.0, n);
 
+  // Invert the addition tables: collect the event lists that go into each
+  // output spectrum, in the order of the input workspaces
+  std::vector<std::vector<const EventList *>> sources(m_outputSize);
+  const EventWorkspace &firstWS = *inputWS;
+  for (size_t i = 0; i < inputSize; ++i)
+    sources[i].emplace_back(&firstWS.getSpectrum(i));
   // Note that we start at 1, since we already have the 0th workspace
   auto current = inputSize;
   for (size_t workspaceNum = 1; workspaceNum < m_inEventWS.size(); workspaceNum++) {
     const auto &addee = *m_inEventWS[workspaceNum];
-    const auto &table = m_tables[workspaceNum - 1];
-
-    // Add all the event lists together as the table says to do
-    for (auto &WI : table) {
-      int64_t inWI = WI.first;
-      int64_t outWI = WI.second;
-      if (outWI >= 0) {
-        outWS->getSpectrum(outWI) += addee.getSpectrum(inWI);
-      } else {
-        outWS->getSpectrum(current) = addee.getSpectrum(inWI);
-        ++current;
-      }
+    for (const auto &WI : m_tables[workspaceNum - 1]) {
+      const auto outWI = WI.second >= 0 ? static_cast<size_t>(WI.second) : current++;
+      sources[outWI].emplace_back(&addee.getSpectrum(WI.first));
     }
+  }
 
-    // Now we add up the runs
-    outWS->mutableRun() += addee.run();
-
+  m_progress = std::make_unique<Progress>(this, 0.0, 1.0, m_outputSize);
+
+  // The output spectra are independent, so they are filled in parallel. Each
+  // one is allocated once for all of its events rather than growing with
+  // every workspace added.
+  const auto outputSize = static_cast<int64_t>(m_outputSize);
+  PARALLEL_FOR_IF(Kernel::threadSafe(*outWS))
+  for (int64_t i = 0; i < outputSize; ++i) {
+    PARALLEL_START_INTERRUPT_REGION
+    const auto &lists = sources[i];
+    auto &outputEL = outWS->getSpectrum(i);
+    outputEL = *lists.front();
+    if (lists.size() > 1) {
+      // Appending a list converts the output to the more general event type
+      size_t numberOfEvents = 0;
+      auto eventType = outputEL.getEventType();
+      for (const auto *eventList : lists) {
+        numberOfEvents += eventList->getNumberEvents();
+        if (!eventList->empty())
+          eventType = std::max(eventType, eventList->getEventType());
+      }
+      outputEL.switchTo(eventType);
+      outputEL.reserve(numberOfEvents);
+      for (auto eventList = std::next(lists.cbegin()); eventList != lists.cend(); ++eventList)
+        outputEL += **eventList;
+    }
     m_progress->report();
+    PARALLEL_END_INTERRUPT_REGION
   }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
+  // Now we add up the runs
+  for (size_t workspaceNum = 1; workspaceNum < m_inEventWS.size(); workspaceNum++)
+    outWS->mutableRun() += m_inEventWS[workspaceNum]->run();
 
   // Set the final workspace to the output property
   setProperty("OutputWorkspace", std::move(outWS));
@@ -343,8 +399,17 @@ void MergeRuns::execHistogram(const std::vector<std::string> &inputs) {
 
   auto isScanning = outWS->detectorInfo().isScanning();
 
+  // Workspace2Ds that need no rebinning are added together in a single
+  // parallel pass over the spectra once the sample logs have been merged,
+  // rather than with one Plus per run
+  const bool sumAtEnd = !rebinParams && !isScanning &&
+                        std::all_of(m_inMatrixWS.cbegin(), m_inMatrixWS.cend(),
+                                    [](const MatrixWorkspace_sptr &ws) { return ws->id() == "Workspace2D"; });
+  std::vector<MatrixWorkspace_sptr> addees;
+
   const size_t numberOfWSs = m_inMatrixWS.size();
-  m_progress = std::make_unique<Progress>(this, 0.0, 1.0, numberOfWSs - 1);
+  m_progress = std::make_unique<Progress>(this, 0.0, 1.0,
+                                          numberOfWSs - 1 + (sumAtEnd ? outWS->getNumberHistograms() : 0));
   // Note that the iterator is incremented before first pass so that 1st
   // workspace isn't added to itself
   auto it = m_inMatrixWS.begin();
@@ -361,10 +426,15 @@ void MergeRuns::execHistogram(const std::vector<std::string> &inputs) {
     try {
       sampleLogsBehaviour.mergeSampleLogs(*it, outWS);
       sampleLogsBehaviour.removeSampleLogsFromWorkspace(addee);
-      if (isScanning)
+      if (isScanning) {
         outWS = buildScanningOutputWorkspace(outWS, addee);
-      else
+      } else if (sumAtEnd) {
+        // Merge the runs as Plus would, the data is added below
+        outWS->mutableRun() += addee->run();
+        addees.emplace_back(addee);
+      } else {
         outWS = outWS + addee;
+      }
       sampleLogsBehaviour.setUpdatedSampleLogs(outWS);
       sampleLogsBehaviour.readdSampleLogToWorkspace(addee);
     } catch (std::invalid_argument &e) {
@@ -378,11 +448,61 @@ void MergeRuns::execHistogram(const std::vector<std::string> &inputs) {
     }
     m_progress->report();
   }
+  if (!addees.empty())
+    sumHistograms(*outWS, addees);
 
   // Set the final workspace to the output property
   setProperty("OutputWorkspace", outWS);
 }
 
+/** Add the data of workspaces with the same spectra and binning to the output.
+ * This gives the same result as adding them one at a time with Plus, but the
+ * spectra are independent and so are summed in parallel, each over all of the
+ * workspaces at once. A spectrum masked in any of the workspaces is masked
+ * and zeroed in the output.
+ * @param outWS :: the workspace to add to
+ * @param addees :: the workspaces to add
+ */
+void MergeRuns::sumHistograms(MatrixWorkspace &outWS, const std::vector<MatrixWorkspace_sptr> &addees) {
+  const bool useKahanSummation = getProperty("UseKahanSummation");
+  std::vector<const SpectrumInfo *> spectrumInfos{&outWS.spectrumInfo()};
+  for (const auto &addee : addees)
+    spectrumInfos.emplace_back(&addee->spectrumInfo());
+
+  const auto numberOfHistograms = outWS.getNumberHistograms();
+  std::vector<char> masked(numberOfHistograms, 0);
+  PARALLEL_FOR_IF(Kernel::threadSafe(outWS))
+  for (int64_t i = 0; i < static_cast<int64_t>(numberOfHistograms); ++i) {
+    PARALLEL_START_INTERRUPT_REGION
+    const auto index = static_cast<size_t>(i);
+    masked[index] = std::any_of(spectrumInfos.cbegin(), spectrumInfos.cend(), [index](const SpectrumInfo *info) {
+      return info->hasDetectors(index) && info->isMasked(index);
+    });
+    if (masked[index])
+      outWS.getSpectrum(index).clearData();
+    else if (useKahanSummation)
+      addSpectrum<KahanSum>(outWS, addees, index);
+    else
+      addSpectrum<double>(outWS, addees, index);
+    m_progress->report();
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
+  // Masking is not thread-safe, so it is done afterwards
+  auto &outSpectrumInfo = outWS.mutableSpectrumInfo();
+  for (size_t i = 0; i < numberOfHistograms; ++i) {
+    if (masked[i])
+      outSpectrumInfo.setMasked(i, true);
+    for (const auto &addee : addees) {
+      if (addee->hasMaskedBins(i)) {
+        for (const auto &mask : addee->maskedBins(i))
+          outWS.flagMasked(i, mask.first, mask.second);
+      }
+    }
+  }
+}
+
 //------------------------------------------------------------------------------------------------
 /** Validate the input event workspaces
  *
@@ -34,6 +34,7 @@
 #include "MantidKernel/MandatoryValidator.h"
 #include "MantidKernel/RebinParamsValidator.h"
 #include "MantidKernel/Unit.h"
+#include "MantidKernel/VectorHelper.h"
 
 #include <algorithm>
 #include <gsl/gsl_multifit_nlin.h>
@@ -71,21 +72,15 @@ using std::vector;
 // Register the algorithm into the AlgorithmFactory
 DECLARE_ALGORITHM(PDCalibration)
 
-namespace { // anonymous
-const auto isNonZero = [](const double value) { return value != 0.; };
-}
-
 /// private inner class
 class PDCalibration::FittedPeaks {
 public:
   /**
-   * Find the bins with non-zero counts and with minimum and maximum TOF
+   * Find the detectors of a spectrum. The counts are not read, so event
+   * lists are not histogrammed.
    *
    * @param wksp :: Input signal workspace
    * @param wkspIndex :: workspace index
-   *
-   * @throws runtime_error :: more than one detector is associated to the
-   * workspace index
    */
   FittedPeaks(const API::MatrixWorkspace_const_sptr &wksp, const std::size_t wkspIndex) {
     this->wkspIndex = wkspIndex;
@@ -93,29 +88,6 @@ public:
     // convert workspace index into detector id
     const auto &spectrum = wksp->getSpectrum(wkspIndex);
     this->detid = spectrum.getDetectorIDs();
-
-    const auto &X = spectrum.x();
-    const auto &Y = spectrum.y();
-    tofMin = X.front();
-    tofMax = X.back();
-
-    // determine tof min supported by the workspace (non-zero counts)
-    size_t minIndex = 0; // want to store value
-    for (; minIndex < Y.size(); ++minIndex) {
-      if (isNonZero(Y[minIndex])) {
-        tofMin = X[minIndex];
-        break; // we found the first bin with non-zero counts
-      }
-    }
-
-    // determine tof max supported by the workspace (non-zero counts)
-    size_t maxIndex = Y.size() - 1;
-    for (; maxIndex > minIndex; --maxIndex) {
-      if (isNonZero(Y[maxIndex])) {
-        tofMax = X[maxIndex];
-        break; // we found the last bin with non-zero counts
-      }
-    }
   }
 
   /**
@@ -153,8 +125,6 @@ public:
 
   std::size_t wkspIndex;
   std::set<detid_t> detid;
-  double tofMin;                // TOF of bin with minimum TOF and non-zero counts
-  double tofMax;                // TOF of bin with maximum TOF and non-zero counts
   std::vector<double> inTofPos; // peak centers, in TOF
   // left and right fit ranges for each peak center, in TOF
   std::vector<double> inTofWindows;
@@ -207,6 +177,10 @@ void PDCalibration::init() {
       "Min, Step, and Max of TOF bins. "
       "Logarithmic binning is used if Step is negative. Chosen binning should ensure sufficient datapoints across "
       "the peaks to be fitted, considering the number of parameters required by PeakFunction and BackgroundType.");
+  declareProperty("HistogramPeakWindowsOnly", false,
+                  "For event workspaces, only histogram the events that fall inside the peak fit windows of each "
+                  "spectrum rather than the whole TofBinning range. The memory used then scales with the number and "
+                  "width of the peak windows. The InputWorkspace is left unbinned.");
 
   const std::vector<std::string> exts2{".h5", ".cal"};
   declareProperty(std::make_unique<FileProperty>("PreviousCalibrationFile", "", FileProperty::OptionalLoad, exts2),
@@ -321,6 +295,7 @@ void PDCalibration::init() {
   setPropertyGroup("StartWorkspaceIndex", inputGroup);
   setPropertyGroup("StopWorkspaceIndex", inputGroup);
   setPropertyGroup("TofBinning", inputGroup);
+  setPropertyGroup("HistogramPeakWindowsOnly", inputGroup);
   setPropertyGroup("PreviousCalibrationFile", inputGroup);
   setPropertyGroup("PreviousCalibrationTable", inputGroup);
 
@@ -501,8 +476,19 @@ void PDCalibration::exec() {
   else
     throw std::runtime_error("Encountered impossible CalibrationParameters value");
 
-  m_uncalibratedWS = loadAndBin();
-  setProperty("InputWorkspace", m_uncalibratedWS);
+  // Only event workspaces can be histogrammed later over the peak windows alone
+  const MatrixWorkspace_sptr inputWS = getProperty("InputWorkspace");
+  const bool windowsOnlyRequested = getProperty("HistogramPeakWindowsOnly");
+  const bool histogramPeakWindowsOnly =
+      windowsOnlyRequested && bool(std::dynamic_pointer_cast<const EventWorkspace>(inputWS));
+  if (windowsOnlyRequested && !histogramPeakWindowsOnly)
+    g_log.warning("HistogramPeakWindowsOnly requires an EventWorkspace. Rebinning the whole input instead.");
+  if (histogramPeakWindowsOnly) {
+    m_uncalibratedWS = inputWS;
+  } else {
+    m_uncalibratedWS = loadAndBin();
+    setProperty("InputWorkspace", m_uncalibratedWS);
+  }
 
   m_startWorkspaceIndex = getProperty("StartWorkspaceIndex");
   m_stopWorkspaceIndex = isDefault("StopWorkspaceIndex") ? static_cast<int>(m_uncalibratedWS->getNumberHistograms() - 1)
@@ -551,6 +537,11 @@ void PDCalibration::exec() {
   API::MatrixWorkspace_sptr tof_peak_center_ws = matrix_pair.first;
   API::MatrixWorkspace_sptr tof_peak_window_ws = matrix_pair.second;
 
+  // the workspace the peaks are fitted in
+  API::MatrixWorkspace_sptr fitWS = m_uncalibratedWS;
+  if (histogramPeakWindowsOnly)
+    fitWS = histogramPeakWindows(*uncalibratedEWS, *tof_peak_window_ws);
+
   double peak_width_percent = getProperty("PeakWidthPercent");
 
   const std::string diagnostic_prefix = getPropertyValue("DiagnosticWorkspaces");
@@ -560,7 +551,7 @@ void PDCalibration::exec() {
   auto algFitPeaks = createChildAlgorithm("FitPeaks", .2, .7);
   algFitPeaks->setLoggingOffset(3);
 
-  algFitPeaks->setProperty("InputWorkspace", m_uncalibratedWS);
+  algFitPeaks->setProperty("InputWorkspace", fitWS);
 
   // limit the spectra to fit
   algFitPeaks->setProperty("StartWorkspaceIndex", static_cast<int>(m_startWorkspaceIndex));
@@ -1233,6 +1224,82 @@ API::MatrixWorkspace_sptr PDCalibration::rebin(API::MatrixWorkspace_sptr wksp) {
   return wksp;
 }
 
+/**
+ * Histogram the events of each spectrum over its peak fit windows only.
+ *
+ * Inside the windows the bins are those of TofBinning, so the counts match a
+ * full rebin. Each gap between windows is covered by a single empty bin, so
+ * the memory used scales with the width of the windows rather than with the
+ * whole TOF range.
+ *
+ * @param eventWS :: the unbinned input signal workspace
+ * @param peakWindowWS :: left and right TOF edges of the peak windows of each
+ * spectrum, as from createTOFPeakCenterFitWindowWorkspaces
+ * @return a histogram workspace whose spectra have different bin edges
+ */
+API::MatrixWorkspace_sptr PDCalibration::histogramPeakWindows(const EventWorkspace &eventWS,
+                                                              const API::MatrixWorkspace &peakWindowWS) {
+  g_log.information("Binning data in time-of-flight over the peak windows");
+  const std::vector<double> tofBinningParams = getProperty("TofBinning");
+  std::vector<double> fullAxis;
+  Kernel::VectorHelper::createAxisFromRebinParams(tofBinningParams, fullAxis);
+
+  // spectra that are not fitted get a single empty bin
+  API::MatrixWorkspace_sptr outputWS = create<Workspace2D>(eventWS, BinEdges{fullAxis.front(), fullAxis.back()});
+
+  PRAGMA_OMP(parallel for schedule(dynamic, 1))
+  for (int64_t iiws = m_startWorkspaceIndex; iiws <= static_cast<int64_t>(m_stopWorkspaceIndex); iiws++) {
+    PARALLEL_START_INTERRUPT_REGION
+    const auto iws = static_cast<std::size_t>(iiws);
+
+    // left and right edges of each window, in increasing order of left edge
+    const auto &windowEdges = peakWindowWS.x(iws);
+    std::vector<std::pair<double, double>> windows;
+    for (std::size_t i = 0; i + 1 < windowEdges.size(); i += 2) {
+      if (windowEdges[i] < windowEdges[i + 1])
+        windows.emplace_back(windowEdges[i], windowEdges[i + 1]);
+    }
+    std::sort(windows.begin(), windows.end());
+
+    MantidVec edges;
+    std::vector<std::size_t> gapBins;
+    std::size_t lastIndex = 0; // index in fullAxis of edges.back()
+    for (const auto &[left, right] : windows) {
+      // the first bin edge at or below the window and the last at or above it
+      const auto upper = std::upper_bound(fullAxis.cbegin(), fullAxis.cend(), left);
+      auto first = static_cast<std::size_t>(std::distance(fullAxis.cbegin(), upper));
+      first = first > 0 ? first - 1 : 0;
+      auto last = static_cast<std::size_t>(
+          std::distance(fullAxis.cbegin(), std::lower_bound(fullAxis.cbegin(), fullAxis.cend(), right)));
+      last = std::min(last, fullAxis.size() - 1);
+      if (!edges.empty()) {
+        if (last <= lastIndex)
+          continue; // inside the previous window
+        if (first > lastIndex + 1)
+          gapBins.emplace_back(edges.size() - 1);
+        first = std::max(first, lastIndex + 1);
+      }
+      edges.insert(edges.end(), fullAxis.cbegin() + first, fullAxis.cbegin() + last + 1);
+      lastIndex = last;
+    }
+    if (edges.size() < 2)
+      continue; // no window inside TofBinning
+
+    MantidVec counts, errors;
+    eventWS.getSpectrum(iws).generateHistogram(edges, counts, errors);
+    for (const auto gapBin : gapBins) {
+      counts[gapBin] = 0.;
+      errors[gapBin] = 0.;
+    }
+    outputWS->setHistogram(
+        iws, Histogram(BinEdges(std::move(edges)), Counts(std::move(counts)), CountStandardDeviations(std::move(errors))));
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
+  return outputWS;
+}
+
 std::set<detid_t> PDCalibration::detIdsForTable() {
   std::set<detid_t> detids;
 
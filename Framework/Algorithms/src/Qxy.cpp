@@ -13,6 +13,7 @@
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidAPI/WorkspaceUnitValidator.h"
 #include "MantidAlgorithms/GravitySANSHelper.h"
+#include "MantidAlgorithms/ParallelBinning2D.h"
 #include "MantidAlgorithms/Qhelper.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
@@ -34,6 +35,43 @@ using namespace Kernel;
 using namespace API;
 using namespace Geometry;
 
+/** Add the value of an input bin. As the serial loop always did, a NaN signal
+ * is reset by the next deposit.
+ * @param y :: the signal of the bin
+ * @param e :: the error of the bin
+ */
+void QxyCell::deposit(const double y, const double e) {
+  if (std::isnan(signal)) {
+    signal = errorSq = 0;
+    wasReset = true;
+  }
+  hasData = true;
+  signal += y;
+  errorSq += e * e;
+}
+
+/** Fold in the deposits a serial loop would have made after those in this cell
+ * @param later :: the cell of the next block of spectra
+ */
+void QxyCell::combine(const QxyCell &later) {
+  if (!later.hasData)
+    return;
+  // A NaN signal is dropped by the next deposit along with everything deposited
+  // before it. That deposit may have been the first of the later cell, or one
+  // made inside it.
+  if (later.wasReset || std::isnan(signal)) {
+    signal = later.signal;
+    errorSq = later.errorSq;
+    wasReset = true;
+  } else {
+    signal += later.signal;
+    errorSq += later.errorSq;
+  }
+  weight += later.weight;
+  weightErrorSq += later.weightErrorSq;
+  hasData = true;
+}
+
 void Qxy::init() {
   auto wsValidator = std::make_shared<CompositeValidator>();
   wsValidator->add<WorkspaceUnitValidator>("Wavelength");
@@ -123,23 +161,29 @@ void Qxy::exec() {
   // moved to account for the beam centre
   const V3D samplePos = spectrumInfo.samplePosition();
 
-  for (int64_t i = 0; i < int64_t(numSpec); ++i) {
+  const double radiusCut = getProperty("RadiusCut");
+  const double waveCut = getProperty("WaveCut");
+  const double extraLength = getProperty("ExtraLength");
+  const auto &axis = outputWorkspace->x(0);
+
+  // Spectra are deposited into the Qx-Qy grid on several threads
+  ParallelBinning2D<QxyCell> binning(outputWorkspace->getNumberHistograms(), outputWorkspace->blocksize());
+  auto depositSpectrum = [&](const size_t i, ParallelBinning2D<QxyCell>::Grid &cells) {
     if (!spectrumInfo.hasDetectors(i)) {
       g_log.warning() << "Workspace index " << i << " has no detector assigned to it - discarding\n";
-      continue;
+      return;
     }
     // If no detector found or if it's masked or a monitor, skip onto the next
     // spectrum
     if (spectrumInfo.isMonitor(i) || spectrumInfo.isMasked(i))
-      continue;
+      return;
 
     // get the bins that are included inside the RadiusCut/WaveCutcut off, those
     // to calculate for
-    const size_t wavStart =
-        helper.waveLengthCutOff(inputWorkspace, spectrumInfo, getProperty("RadiusCut"), getProperty("WaveCut"), i);
+    const size_t wavStart = helper.waveLengthCutOff(inputWorkspace, spectrumInfo, radiusCut, waveCut, i);
     if (wavStart >= inputWorkspace->y(i).size()) {
       // all the spectra in this detector are out of range
-      continue;
+      return;
     }
 
     V3D detPos = spectrumInfo.position(i) - samplePos;
@@ -156,8 +200,6 @@ void Qxy::exec() {
     const auto &Y = inputWorkspace->y(i);
     const auto &E = inputWorkspace->e(i);
 
-    const auto &axis = outputWorkspace->x(0);
-
     // the solid angle of the detector as seen by the sample is used for
     // normalisation later on
     double angle = 0.0;
@@ -187,7 +229,7 @@ void Qxy::exec() {
     // constructed once per spectrum
     GravitySANSHelper grav;
     if (doGravity) {
-      grav = GravitySANSHelper(spectrumInfo, i, getProperty("ExtraLength"));
+      grav = GravitySANSHelper(spectrumInfo, i, extraLength);
     }
 
     for (int j = static_cast<int>(numBins) - 1; j >= static_cast<int>(wavStart); --j) {
@@ -217,82 +259,87 @@ void Qxy::exec() {
         break;
       // Find the indices pointing to the place in the 2D array where this bin's
       // contents should go
-      const auto xIndex = std::upper_bound(axis.begin(), axis.end(), Qx) - axis.begin() - 1;
-      const int yIndex = static_cast<int>(std::upper_bound(axis.begin(), axis.end(), Qy) - axis.begin() - 1);
-      //      PARALLEL_CRITICAL(qxy)    /* Write to shared memory - must protect
-      //      */
-      {
-        // the data will be copied to this bin in the output array
-        double &outputBinY = outputWorkspace->mutableY(yIndex)[xIndex];
-        double &outputBinE = outputWorkspace->mutableE(yIndex)[xIndex];
-
-        if (std::isnan(outputBinY)) {
-          outputBinY = outputBinE = 0;
-        }
-        // Add the contents of the current bin to the 2D array.
-        outputBinY += Y[j];
-        // add the errors in quadranture
-        outputBinE = std::sqrt((outputBinE * outputBinE) + (E[j] * E[j]));
-
-        // account for masked bins
-        if (!maskFractions.empty()) {
-          maskFraction = maskFractions[j];
-        }
-        // add the total weight for this bin in the weights workspace,
-        // in an equivalent bin to where the data was stored
-
-        // first take into account the product of contributions to the weight
-        // which have no errors
-        double weight = 0.0;
-        if (doSolidAngle)
-          weight = maskFraction * angle;
-        else
-          weight = maskFraction;
-
-        // then the product of contributions which have errors, i.e. optional
-        // pixelAdj and waveAdj contributions
-        auto &outWeightsY = weights->mutableY(yIndex);
-        auto &outWeightsE = weights->mutableE(yIndex);
-
-        if (pixelAdj && waveAdj) {
-          auto pixelY = pixelAdj->y(i)[0];
-          auto pixelE = pixelAdj->e(i)[0];
-
-          auto waveY = waveAdj->y(0)[j];
-          auto waveE = waveAdj->e(0)[j];
-
-          outWeightsY[xIndex] += weight * pixelY * waveY;
-          const double pixelYSq = pixelY * pixelY;
-          const double pixelESq = pixelE * pixelE;
-          const double waveYSq = waveY * waveY;
-          const double waveESq = waveE * waveE;
-          // add product of errors from pixelAdj and waveAdj (note no error on
-          // weight is assumed)
-          outWeightsE[xIndex] += weight * weight * (waveESq * pixelYSq + pixelESq * waveYSq);
-        } else if (pixelAdj) {
-          auto pixelY = pixelAdj->y(i)[0];
-          auto pixelE = pixelAdj->e(i)[0];
-
-          outWeightsY[xIndex] += weight * pixelY;
-          const double pixelESq = weight * pixelE;
-          // add error from pixelAdj
-          outWeightsE[xIndex] += pixelESq * pixelESq;
-        } else if (waveAdj) {
-          auto waveY = waveAdj->y(0)[j];
-          auto waveE = waveAdj->e(0)[j];
-
-          outWeightsY[xIndex] += weight * waveY;
-          const double waveESq = weight * waveE;
-          // add error from waveAdj
-          outWeightsE[xIndex] += waveESq * waveESq;
-        } else
-          outWeightsY[xIndex] += weight;
+      const auto xIndex = static_cast<size_t>(std::upper_bound(axis.begin(), axis.end(), Qx) - axis.begin() - 1);
+      const auto yIndex = static_cast<size_t>(std::upper_bound(axis.begin(), axis.end(), Qy) - axis.begin() - 1);
+
+      // the data will be copied to this bin in the output array
+      auto &cell = cells(yIndex, xIndex);
+      // Add the contents of the current bin to the 2D array, with the errors
+      // in quadrature
+      cell.deposit(Y[j], E[j]);
+
+      // account for masked bins
+      if (!maskFractions.empty()) {
+        maskFraction = maskFractions[j];
       }
+      // add the total weight for this bin in the weights workspace,
+      // in an equivalent bin to where the data was stored
+
+      // first take into account the product of contributions to the weight
+      // which have no errors
+      double weight = 0.0;
+      if (doSolidAngle)
+        weight = maskFraction * angle;
+      else
+        weight = maskFraction;
+
+      // then the product of contributions which have errors, i.e. optional
+      // pixelAdj and waveAdj contributions
+      if (pixelAdj && waveAdj) {
+        auto pixelY = pixelAdj->y(i)[0];
+        auto pixelE = pixelAdj->e(i)[0];
+
+        auto waveY = waveAdj->y(0)[j];
+        auto waveE = waveAdj->e(0)[j];
+
+        cell.weight += weight * pixelY * waveY;
+        const double pixelYSq = pixelY * pixelY;
+        const double pixelESq = pixelE * pixelE;
+        const double waveYSq = waveY * waveY;
+        const double waveESq = waveE * waveE;
+        // add product of errors from pixelAdj and waveAdj (note no error on
+        // weight is assumed)
+        cell.weightErrorSq += weight * weight * (waveESq * pixelYSq + pixelESq * waveYSq);
+      } else if (pixelAdj) {
+        auto pixelY = pixelAdj->y(i)[0];
+        auto pixelE = pixelAdj->e(i)[0];
+
+        cell.weight += weight * pixelY;
+        const double pixelESq = weight * pixelE;
+        // add error from pixelAdj
+        cell.weightErrorSq += pixelESq * pixelESq;
+      } else if (waveAdj) {
+        auto waveY = waveAdj->y(0)[j];
+        auto waveE = waveAdj->e(0)[j];
+
+        cell.weight += weight * waveY;
+        const double waveESq = weight * waveE;
+        // add error from waveAdj
+        cell.weightErrorSq += waveESq * waveESq;
+      } else
+        cell.weight += weight;
     } // loop over single spectrum
 
     prog.report("Calculating Q");
-
-  } // loop over all spectra
+  };
+  const auto grid = binning.run(numSpec, depositSpectrum, threadSafe(*inputWorkspace));
+
+  // copy the sums into the output and weights workspaces
+  for (size_t yIndex = 0; yIndex < outputWorkspace->getNumberHistograms(); ++yIndex) {
+    auto &outputY = outputWorkspace->mutableY(yIndex);
+    auto &outputE = outputWorkspace->mutableE(yIndex);
+    auto &weightsY = weights->mutableY(yIndex);
+    auto &weightsE = weights->mutableE(yIndex);
+    for (size_t xIndex = 0; xIndex < outputY.size(); ++xIndex) {
+      const auto &cell = grid(yIndex, xIndex);
+      if (!cell.hasData)
+        continue;
+      outputY[xIndex] = cell.signal;
+      outputE[xIndex] = std::sqrt(cell.errorSq);
+      weightsY[xIndex] += cell.weight;
+      weightsE[xIndex] += cell.weightErrorSq;
+    }
+  }
 
   // take sqrt of error weight values
   // left to be executed here for computational efficiency
@@ -122,6 +122,13 @@ std::vector<double> Rebin::rebinParamsFromInput(const std::vector<double> &inPar
 // Public methods
 //---------------------------------------------------------------------------------------------
 
+/// Rebinning to fixed boundaries is additive. A single bin width takes the
+/// range from the data, which differs between inputs.
+bool Rebin::isChunkMergeable() const {
+  const std::vector<double> rbParams = getProperty(PropertyNames::PARAMS);
+  return rbParams.size() > 1;
+}
+
 /// Validate that the input properties are sane.
 std::map<std::string, std::string> Rebin::validateInputs() {
   std::map<std::string, std::string> helpMessages;
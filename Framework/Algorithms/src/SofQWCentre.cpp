@@ -7,6 +7,7 @@
 #include "MantidAlgorithms/SofQWCentre.h"
 #include "MantidAPI/SpectrumDetectorMapping.h"
 #include "MantidAPI/SpectrumInfo.h"
+#include "MantidAlgorithms/ParallelBinning2D.h"
 #include "MantidAlgorithms/SofQW.h"
 #include "MantidDataObjects/Histogram1D.h"
 #include "MantidDataObjects/Workspace2D.h"
@@ -22,6 +23,23 @@ DECLARE_ALGORITHM(SofQWCentre)
 using namespace Kernel;
 using namespace API;
 
+namespace {
+/// The sums for one Q-E cell
+struct SofQWCell {
+  double signal{0.};
+  /// Each deposit maps the squared error x to (x + e^2) / numDets, so all the
+  /// deposits in a cell map x to errorScale * x + errorSq
+  double errorScale{1.};
+  double errorSq{0.};
+
+  void combine(const SofQWCell &later) {
+    signal += later.signal;
+    errorSq = later.errorScale * errorSq + later.errorSq;
+    errorScale *= later.errorScale;
+  }
+};
+} // namespace
+
 /**
  * Create the input properties
  */
@@ -42,9 +60,8 @@ void SofQWCentre::exec() {
   setProperty("OutputWorkspace", outputWorkspace);
   const auto &xAxis = outputWorkspace->binEdges(0).rawData();
 
-  // Holds the spectrum-detector mapping
-  std::vector<specnum_t> specNumberMapping;
-  std::vector<detid_t> detIDMapping;
+  // The Q bin each detector of each spectrum contributes to
+  std::vector<std::vector<std::pair<size_t, detid_t>>> qBinDetectors(inputWorkspace->getNumberHistograms());
 
   const auto &detectorInfo = inputWorkspace->detectorInfo();
   const auto &spectrumInfo = inputWorkspace->spectrumInfo();
@@ -57,9 +74,10 @@ void SofQWCentre::exec() {
   const size_t numHists = inputWorkspace->getNumberHistograms();
   const size_t numBins = inputWorkspace->blocksize();
   Progress prog(this, 0.0, 1.0, numHists);
-  for (int64_t i = 0; i < int64_t(numHists); ++i) {
+  ParallelBinning2D<SofQWCell> binning(outputWorkspace->getNumberHistograms(), outputWorkspace->blocksize());
+  auto depositSpectrum = [&](const size_t i, ParallelBinning2D<SofQWCell>::Grid &cells) {
     if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i))
-      continue;
+      return;
 
     const auto &spectrumDet = spectrumInfo.detector(i);
     const double efixed = m_EmodeProperties.getEFixed(spectrumDet);
@@ -124,22 +142,24 @@ void SofQWCentre::exec() {
           if (q < verticalAxis.front() || q > verticalAxis.back())
             continue;
           // Find which q bin this point lies in
-          const MantidVec::difference_type qIndex =
-              std::upper_bound(verticalAxis.begin(), verticalAxis.end(), q) - verticalAxis.begin() - 1;
+          const auto qIndex = static_cast<size_t>(std::upper_bound(verticalAxis.begin(), verticalAxis.end(), q) -
+                                                  verticalAxis.begin() - 1);
           // Find which e bin this point lies in
-          const MantidVec::difference_type eIndex =
-              std::upper_bound(xAxis.begin(), xAxis.end(), deltaE) - xAxis.begin() - 1;
+          const auto eIndex =
+              static_cast<size_t>(std::upper_bound(xAxis.begin(), xAxis.end(), deltaE) - xAxis.begin() - 1);
 
           // Add this spectra-detector pair to the mapping
-          specNumberMapping.emplace_back(outputWorkspace->getSpectrum(qIndex).getSpectrumNo());
-          detIDMapping.emplace_back(detID);
+          auto &detectors = qBinDetectors[i];
+          if (detectors.empty() || detectors.back() != std::make_pair(qIndex, detID))
+            detectors.emplace_back(qIndex, detID);
 
           // And add the data and it's error to that bin, taking into account
           // the number of detectors contributing to this bin
-          outputWorkspace->mutableY(qIndex)[eIndex] += Y[j] / numDets_d;
+          auto &cell = cells(qIndex, eIndex);
+          cell.signal += Y[j] / numDets_d;
           // Standard error on the average
-          outputWorkspace->mutableE(qIndex)[eIndex] =
-              sqrt((pow(outputWorkspace->e(qIndex)[eIndex], 2) + pow(E[j], 2)) / numDets_d);
+          cell.errorSq = (cell.errorSq + E[j] * E[j]) / numDets_d;
+          cell.errorScale /= numDets_d;
         }
       } catch (std::out_of_range &) {
         // Skip invalid detector IDs
@@ -148,6 +168,27 @@ void SofQWCentre::exec() {
       }
     }
     prog.report();
+  };
+  const auto grid = binning.run(numHists, depositSpectrum, threadSafe(*inputWorkspace));
+
+  for (size_t qIndex = 0; qIndex < outputWorkspace->getNumberHistograms(); ++qIndex) {
+    auto &outputY = outputWorkspace->mutableY(qIndex);
+    auto &outputE = outputWorkspace->mutableE(qIndex);
+    for (size_t eIndex = 0; eIndex < outputY.size(); ++eIndex) {
+      const auto &cell = grid(qIndex, eIndex);
+      outputY[eIndex] += cell.signal;
+      outputE[eIndex] = std::sqrt(cell.errorScale * outputE[eIndex] * outputE[eIndex] + cell.errorSq);
+    }
+  }
+
+  // Holds the spectrum-detector mapping
+  std::vector<specnum_t> specNumberMapping;
+  std::vector<detid_t> detIDMapping;
+  for (const auto &detectors : qBinDetectors) {
+    for (const auto &[qIndex, detID] : detectors) {
+      specNumberMapping.emplace_back(outputWorkspace->getSpectrum(qIndex).getSpectrumNo());
+      detIDMapping.emplace_back(detID);
+    }
   }
 
   // If the input workspace was a distribution, need to divide by q bin width
@@ -16,10 +16,12 @@
 #include "MantidGeometry/IDetector.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/MandatoryValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/RebinParamsValidator.h"
 #include "MantidKernel/TimeROI.h"
 #include "MantidKernel/VectorHelper.h"
 
+#include <algorithm>
 #include <numeric>
 
 namespace Mantid::Algorithms {
@@ -31,6 +33,43 @@ using namespace API;
 using DataObjects::EventWorkspace;
 using DataObjects::EventWorkspace_const_sptr;
 using DataObjects::EventWorkspace_sptr;
+using Types::Core::DateAndTime;
+
+namespace {
+/** Walks through a log alongside a sequence of increasing times. valueAt()
+ * gives the same result as TimeSeriesProperty::getSingleValue(), but moves on
+ * from the previous position rather than searching the whole log each time.
+ */
+template <typename T> class LogCursor {
+public:
+  LogCursor(const std::vector<DateAndTime> &times, const std::vector<T> &values) : m_times(times), m_values(values) {}
+
+  /// @param time :: not earlier than the time of the previous call
+  T valueAt(const DateAndTime &time) {
+    if (time >= m_times.back())
+      return m_values.back();
+    if (time < m_times.front())
+      return m_values.front();
+    // Find the first entry not before the time, as findIndex() does
+    while (m_times[m_index] < time)
+      ++m_index;
+    return m_times[m_index] > time ? m_values[m_index - 1] : m_values[m_index];
+  }
+
+private:
+  const std::vector<DateAndTime> &m_times;
+  const std::vector<T> &m_values;
+  size_t m_index{0};
+};
+
+/// @return the pulse times of the events in ascending order
+std::vector<DateAndTime> sortedPulseTimes(const IEventList &eventList) {
+  auto pulseTimes = eventList.getPulseTimes();
+  if (!std::is_sorted(pulseTimes.cbegin(), pulseTimes.cend()))
+    std::sort(pulseTimes.begin(), pulseTimes.end());
+  return pulseTimes;
+}
+} // namespace
 
 void SumEventsByLogValue::init() {
   declareProperty(
@@ -141,19 +180,31 @@ void SumEventsByLogValue::createTableOutput(const Kernel::TimeSeriesProperty<int
     g_log.warning() << "Did you really want to create a " << xLength << " row table? This will take some time!\n";
   }
 
+  const auto logTimes = log->timesAsVector();
+  const auto logValues = log->valuesAsVector();
+
   // Accumulate things in a local vector before transferring to the table
-  std::vector<int> Y(xLength);
   const auto numSpec = static_cast<int>(m_inputWorkspace->getNumberHistograms());
+  // Each block of spectra is summed into its own counts so that threads never write to the same memory
+  const Kernel::ThreadBlocks blocks(static_cast<size_t>(numSpec), static_cast<size_t>(PARALLEL_GET_MAX_THREADS));
+  const auto numberOfBlocks = static_cast<int>(blocks.size());
+  std::vector<std::vector<int>> blockY(numberOfBlocks, std::vector<int>(xLength));
   Progress prog(this, 0.0, 1.0, std::size_t(numSpec) + xLength);
   PARALLEL_FOR_IF(Kernel::threadSafe(*m_inputWorkspace))
-  for (int spec = 0; spec < numSpec; ++spec) {
+  for (int block = 0; block < numberOfBlocks; ++block) {
     PARALLEL_START_INTERRUPT_REGION
-    const IEventList &eventList = m_inputWorkspace->getSpectrum(std::size_t(spec));
-    filterEventList(eventList, minVal, maxVal, log, Y);
-    prog.report();
+    const auto end = static_cast<int>(blocks.end(static_cast<size_t>(block)));
+    for (auto spec = static_cast<int>(blocks.begin(static_cast<size_t>(block))); spec < end; ++spec) {
+      const IEventList &eventList = m_inputWorkspace->getSpectrum(std::size_t(spec));
+      filterEventList(eventList, minVal, maxVal, logTimes, logValues, blockY[block]);
+      prog.report();
+    }
     PARALLEL_END_INTERRUPT_REGION
   }
   PARALLEL_CHECK_INTERRUPT_REGION
+  std::vector<int> Y(xLength);
+  for (const auto &counts : blockY)
+    std::transform(Y.cbegin(), Y.cend(), counts.cbegin(), Y.begin(), std::plus<int>());
 
   // Create a table workspace to hold the sum.
   ITableWorkspace_sptr outputWorkspace = WorkspaceFactory::Instance().createTable();
@@ -257,27 +308,30 @@ void SumEventsByLogValue::createTableOutput(const Kernel::TimeSeriesProperty<int
  *  @param eventList The event list to parse
  *  @param minVal    The minimum value of the log
  *  @param maxVal    The maximum value of the log
- *  @param log       The TimeSeriesProperty log
- *  @param Y         The output vector to be filled
+ *  @param logTimes  The sorted times of the log
+ *  @param logValues The values of the log at those times
+ *  @param Y         The output vector to be filled, which is not shared with
+ * other threads
  */
 void SumEventsByLogValue::filterEventList(const API::IEventList &eventList, const int minVal, const int maxVal,
-                                          const Kernel::TimeSeriesProperty<int> *log, std::vector<int> &Y) {
-  if (log->realSize() == 0)
+                                          const std::vector<DateAndTime> &logTimes, const std::vector<int> &logValues,
+                                          std::vector<int> &Y) {
+  if (logTimes.empty())
     return;
 
-  const auto pulseTimes = eventList.getPulseTimes();
-  for (const auto &pulseTime : pulseTimes) {
+  // Walk the sorted pulse times and the log together
+  LogCursor<int> cursor(logTimes, logValues);
+  for (const auto &pulseTime : sortedPulseTimes(eventList)) {
     // Find the value of the log at the time of this event
     // This algorithm is really concerned with 'slow' logs so we don't care
     // about
     // the time of the event within the pulse.
     // NB: If the pulse time is before the first log entry, we get the first
     // value.
-    const int logValue = log->getSingleValue(pulseTime);
+    const int logValue = cursor.valueAt(pulseTime);
 
     if (logValue >= minVal && logValue <= maxVal) {
       // In this scenario it's easy to know what bin to increment
-      PARALLEL_ATOMIC
       ++Y[logValue - minVal];
     }
   }
@@ -299,6 +353,8 @@ void SumEventsByLogValue::addMonitorCounts(const ITableWorkspace_sptr &outputWor
     return;
 
   const auto &spectrumInfo = monitorWorkspace->spectrumInfo();
+  const auto logTimes = log->timesAsVector();
+  const auto logValues = log->valuesAsVector();
 
   const auto xLength = std::size_t(maxVal - minVal + 1);
   // Loop over the spectra - there will be one per monitor
@@ -311,7 +367,7 @@ void SumEventsByLogValue::addMonitorCounts(const ITableWorkspace_sptr &outputWor
       // Accumulate things in a local vector before transferring to the table
       // workspace
       std::vector<int> Y(xLength);
-      filterEventList(eventList, minVal, maxVal, log, Y);
+      filterEventList(eventList, minVal, maxVal, logTimes, logValues, Y);
       // Transfer the results to the table
       for (std::size_t i = 0; i < xLength; ++i) {
         monitorCounts->cell<int>(i) = Y[i];
@@ -382,28 +438,53 @@ template <typename T> void SumEventsByLogValue::createBinnedOutput(const Kernel:
   outputWorkspace->getAxis(0)->title() = m_logName;
   outputWorkspace->setYUnit("Counts");
 
-  auto &Y = outputWorkspace->mutableY(0);
+  const auto logTimes = log->timesAsVector();
+  const auto logValues = log->valuesAsVector();
+
   const auto numSpec = static_cast<int>(m_inputWorkspace->getNumberHistograms());
+  // Each block of spectra is summed into its own counts so that threads never write to the same memory
+  const Kernel::ThreadBlocks blocks(static_cast<size_t>(numSpec), static_cast<size_t>(PARALLEL_GET_MAX_THREADS));
+  const auto numberOfBlocks = static_cast<int>(blocks.size());
+  std::vector<std::vector<double>> blockY(numberOfBlocks, std::vector<double>(XLength - 1));
   Progress prog(this, 0.0, 1.0, numSpec);
   PARALLEL_FOR_IF(Kernel::threadSafe(*m_inputWorkspace))
-  for (int spec = 0; spec < numSpec; ++spec) {
+  for (int block = 0; block < numberOfBlocks; ++block) {
     PARALLEL_START_INTERRUPT_REGION
-    const IEventList &eventList = m_inputWorkspace->getSpectrum(spec);
-    const auto pulseTimes = eventList.getPulseTimes();
-    for (const auto &pulseTime : pulseTimes) {
-      // Find the value of the log at the time of this event
-      const double logValue = log->getSingleValue(pulseTime);
-      if (logValue >= XValues.front() && logValue < XValues.back()) {
-        PARALLEL_ATOMIC
-        ++Y[VectorHelper::getBinIndex(XValues, logValue)];
+    auto &Y = blockY[block];
+    const auto end = static_cast<int>(blocks.end(static_cast<size_t>(block)));
+    for (auto spec = static_cast<int>(blocks.begin(static_cast<size_t>(block))); spec < end; ++spec) {
+      const IEventList &eventList = m_inputWorkspace->getSpectrum(spec);
+      // Walk the sorted pulse times and the log together. The log value only
+      // changes at a log entry, so the bin is looked up again only then.
+      LogCursor<T> cursor(logTimes, logValues);
+      T lastValue = logValues.front();
+      int bin = -1;
+      bool binKnown = false;
+      for (const auto &pulseTime : sortedPulseTimes(eventList)) {
+        // Find the value of the log at the time of this event
+        const T value = cursor.valueAt(pulseTime);
+        if (!binKnown || value != lastValue) {
+          const auto logValue = static_cast<double>(value);
+          bin = (logValue >= XValues.front() && logValue < XValues.back())
+                    ? static_cast<int>(VectorHelper::getBinIndex(XValues, logValue))
+                    : -1;
+          lastValue = value;
+          binKnown = true;
+        }
+        if (bin >= 0)
+          ++Y[bin];
       }
-    }
 
-    prog.report();
+      prog.report();
+    }
     PARALLEL_END_INTERRUPT_REGION
   }
   PARALLEL_CHECK_INTERRUPT_REGION
 
+  auto &Y = outputWorkspace->mutableY(0);
+  for (const auto &counts : blockY)
+    std::transform(Y.cbegin(), Y.cend(), counts.cbegin(), Y.begin(), std::plus<double>());
+
   // The errors are the sqrt of the counts so long as we don't deal with
   // weighted events.
   std::transform(Y.cbegin(), Y.cend(), outputWorkspace->mutableE(0).begin(), (double (*)(double))std::sqrt);
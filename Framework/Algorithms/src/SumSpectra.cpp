@@ -17,8 +17,11 @@
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/EnabledWhenProperty.h"
+#include "MantidKernel/KahanSum.h"
+#include "MantidKernel/MultiThreaded.h"
 
 #include <functional>
+#include <type_traits>
 
 namespace Mantid::Algorithms {
 
@@ -149,6 +152,12 @@ void SumSpectra::init() {
   declareProperty("UseFractionalArea", true,
                   "Normalize the output workspace to the fractional area for "
                   "RebinnedOutput workspaces.");
+
+  declareProperty("UseKahanSummation", false,
+                  "Accumulate the sums with compensated (Kahan) summation. This "
+                  "keeps full precision when summing a very large number of "
+                  "spectra, at a small cost in speed. "
+                  "This property is ignored for event workspace.");
 }
 
 /*
@@ -181,6 +190,14 @@ std::map<std::string, std::string> SumSpectra::validateInputs() {
   return validationOutput;
 }
 
+/// A plain sum is additive. Weighting by the errors and dropping special
+/// values both depend on the data being summed.
+bool SumSpectra::isChunkMergeable() const {
+  const bool weightedSum = getProperty("WeightedSum");
+  const bool removeSpecialValues = getProperty("RemoveSpecialValues");
+  return !weightedSum && !removeSpecialValues;
+}
+
 /** Executes the algorithm
  *
  */
@@ -201,6 +218,7 @@ void SumSpectra::exec() {
 
   m_calculateWeightedSum = getProperty("WeightedSum");
   m_multiplyByNumSpec = getProperty("MultiplyBySpectra");
+  m_useKahanSummation = getProperty("UseKahanSummation");
 
   // setup all of the outputs
   MatrixWorkspace_sptr outputWorkspace = nullptr;
@@ -384,8 +402,163 @@ bool useSpectrum(const SpectrumInfo &spectrumInfo, const size_t wsIndex, const b
   }
   return true;
 }
+
+/// @return the indices of the spectra to add, in increasing order
+std::vector<size_t> spectraToSum(const std::set<size_t> &indices, const SpectrumInfo &spectrumInfo,
+                                 const bool keepMonitors, size_t &numMasked) {
+  std::vector<size_t> used;
+  used.reserve(indices.size());
+  std::copy_if(indices.cbegin(), indices.cend(), std::back_inserter(used), [&](const size_t wsIndex) {
+    return useSpectrum(spectrumInfo, wsIndex, keepMonitors, numMasked);
+  });
+  return used;
+}
+
+/// @return the union of the detector IDs of the given spectra
+std::set<detid_t> detectorIDs(const MatrixWorkspace &workspace, const std::vector<size_t> &indices) {
+  std::vector<detid_t> ids;
+  for (const auto wsIndex : indices) {
+    const auto &spectrumIDs = workspace.getSpectrum(wsIndex).getDetectorIDs();
+    ids.insert(ids.end(), spectrumIDs.cbegin(), spectrumIDs.cend());
+  }
+  // Building the set from sorted IDs takes linear time
+  std::sort(ids.begin(), ids.end());
+  return std::set<detid_t>(ids.cbegin(), ids.cend());
+}
+
+/** Sums over a block of spectra for each bin. Sum is either double or
+ * Kernel::KahanSum. The weights and zero counts are only used for weighted
+ * sums, and the fractional areas only for RebinnedOutput workspaces.
+ */
+template <typename Sum> struct PartialSum {
+  PartialSum(const size_t numBins, const bool weighted, const bool fractional)
+      : y(numBins), eSquared(numBins), weight(weighted ? numBins : 0), nZeros(weighted ? numBins : 0),
+        fraction(fractional ? numBins : 0) {}
+
+  PartialSum &operator+=(const PartialSum &other) {
+    add(y, other.y);
+    add(eSquared, other.eSquared);
+    add(weight, other.weight);
+    add(nZeros, other.nZeros);
+    add(fraction, other.fraction);
+    return *this;
+  }
+
+  /// @return a copy of the sums rounded to doubles
+  PartialSum<double> values() const {
+    PartialSum<double> result(0, false, false);
+    result.y = toDouble(y);
+    result.eSquared = toDouble(eSquared);
+    result.weight = toDouble(weight);
+    result.nZeros = nZeros;
+    result.fraction = toDouble(fraction);
+    return result;
+  }
+
+  std::vector<Sum> y;
+  std::vector<Sum> eSquared;
+  std::vector<Sum> weight;
+  std::vector<size_t> nZeros;
+  std::vector<Sum> fraction;
+
+private:
+  template <typename T> static void add(std::vector<T> &total, const std::vector<T> &other) {
+    for (size_t i = 0; i < total.size(); ++i)
+      total[i] += other[i];
+  }
+
+  static std::vector<double> toDouble(const std::vector<Sum> &sums) {
+    std::vector<double> result(sums.size());
+    std::transform(sums.cbegin(), sums.cend(), result.begin(), [](const Sum &sum) { return static_cast<double>(sum); });
+    return result;
+  }
+};
+
+/** Copy the events of a list to an output of the same or a more general
+ * event type, as EventList::operator+= would convert them.
+ */
+template <typename Event> void appendEvents(const EventList &eventList, typename std::vector<Event>::iterator output) {
+  auto convert = [&output](const auto &events) {
+    std::transform(events.cbegin(), events.cend(), output, [](const auto &event) { return Event(event); });
+  };
+  switch (eventList.getEventType()) {
+  case TOF:
+    convert(eventList.getEvents());
+    break;
+  case WEIGHTED:
+    if constexpr (!std::is_same_v<Event, Types::Event::TofEvent>)
+      convert(eventList.getWeightedEvents());
+    break;
+  case WEIGHTED_NOTIME:
+    if constexpr (std::is_same_v<Event, WeightedEventNoTime>)
+      convert(eventList.getWeightedEventsNoTime());
+    break;
+  }
+}
 } // anonymous namespace
 
+/** Sum spectra in parallel. Each thread adds a contiguous block of the
+ * indices into its own partial sums, and the partial sums are then added
+ * together pairwise, so no two threads ever write to the same bins.
+ * @param indices The workspace indices to sum
+ * @param empty The initial value of the partial sums
+ * @param threadSafe Whether the input workspace can be read in parallel
+ * @param progress The progress indicator, reported once per spectrum
+ * @param addSpectrum Callable adding the spectrum with a given workspace index
+ * to a partial sum
+ * @return The total over all of the indices
+ */
+template <typename Partial, typename AddSpectrum>
+Partial SumSpectra::sumInParallel(const std::vector<size_t> &indices, const Partial &empty, const bool threadSafe,
+                                  Progress &progress, const AddSpectrum &addSpectrum) {
+  const Kernel::ThreadBlocks blocks(indices.size(), threadSafe ? static_cast<size_t>(PARALLEL_GET_MAX_THREADS) : 1);
+  const auto numBlocks = static_cast<int64_t>(blocks.size());
+  std::vector<Partial> partials(blocks.size(), empty);
+  PARALLEL_FOR_IF(threadSafe)
+  for (int64_t block = 0; block < numBlocks; ++block) {
+    PARALLEL_START_INTERRUPT_REGION
+    const auto b = static_cast<size_t>(block);
+    for (auto i = blocks.begin(b); i < blocks.end(b); ++i) {
+      addSpectrum(partials[block], indices[i]);
+      progress.report();
+    }
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
+  // Tree reduction: each pass adds the second half of the pairs into the first
+  for (int64_t stride = 1; stride < numBlocks; stride *= 2) {
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t block = 0; block < numBlocks - stride; block += 2 * stride) {
+      partials[block] += partials[block + stride];
+    }
+  }
+  return partials.front();
+}
+
+/** Copy the events of the given spectra into one vector in parallel
+ * @param inputWorkspace The workspace to copy events from
+ * @param indices The workspace indices of the spectra to copy
+ * @param offsets The position in the output of the first event of each
+ * spectrum, followed by the total number of events
+ * @param events The output
+ * @param progress The progress indicator, reported once per spectrum
+ */
+template <typename Event>
+void SumSpectra::copyEvents(const EventWorkspace &inputWorkspace, const std::vector<size_t> &indices,
+                            const std::vector<size_t> &offsets, std::vector<Event> &events, Progress &progress) {
+  events.resize(offsets.back());
+  const auto numIndices = static_cast<int64_t>(indices.size());
+  PARALLEL_FOR_IF(Kernel::threadSafe(inputWorkspace))
+  for (int64_t i = 0; i < numIndices; ++i) {
+    PARALLEL_START_INTERRUPT_REGION
+    appendEvents<Event>(inputWorkspace.getSpectrum(indices[i]), events.begin() + offsets[i]);
+    progress.report();
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
+}
+
 /**
  * This function deals with the logic necessary for summing a Workspace2D.
  * @param outputWorkspace the workspace to hold the summed input
@@ -401,55 +574,47 @@ void SumSpectra::doSimpleSum(const MatrixWorkspace_sptr &outputWorkspace, Progre
   // Clean workspace of any NANs or Inf values
   auto localworkspace = replaceSpecialValues();
 
-  // Get references to the output workspaces's data vectors
-  auto &outSpec = outputWorkspace->getSpectrum(0);
-  auto &YSum = outSpec.mutableY();
-  auto &YErrorSum = outSpec.mutableE();
+  const auto indices = spectraToSum(m_indices, localworkspace->spectrumInfo(), m_keepMonitors, numMasked);
+  numSpectra = indices.size();
 
-  std::vector<double> Weight;
-  std::vector<size_t> nZeros;
-  if (m_calculateWeightedSum) {
-    Weight.assign(YSum.size(), 0.);
-    nZeros.assign(YSum.size(), 0);
-  }
-
-  const auto &spectrumInfo = localworkspace->spectrumInfo();
-  // Loop over spectra
-  for (const auto wsIndex : m_indices) {
-    if (!useSpectrum(spectrumInfo, wsIndex, m_keepMonitors, numMasked))
-      continue;
-    numSpectra++;
-
-    const auto &YValues = localworkspace->y(wsIndex);
-    const auto &YErrors = localworkspace->e(wsIndex);
-
-    if (m_calculateWeightedSum) {
-      // Retrieve the spectrum into a vector
-      for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
-        const double yErrorsVal = YErrors[yIndex];
-        if (std::isnormal(yErrorsVal)) { // is non-zero, nan, or infinity
-          const double errsq = yErrorsVal * yErrorsVal;
-          YErrorSum[yIndex] += errsq;
-          Weight[yIndex] += 1. / errsq;
-          YSum[yIndex] += YValues[yIndex] / errsq;
-        } else {
-          nZeros[yIndex]++;
-        }
+  // Map all the detectors onto the spectrum of the output
+  auto &outSpec = outputWorkspace->getSpectrum(0);
+  outSpec.setDetectorIDs(detectorIDs(*localworkspace, indices));
+
+  const MatrixWorkspace &inputWS = *localworkspace;
+  const bool weightedSum = m_calculateWeightedSum;
+  auto addSpectrum = [&inputWS, weightedSum](auto &partial, const size_t wsIndex) {
+    const auto &YValues = inputWS.y(wsIndex);
+    const auto &YErrors = inputWS.e(wsIndex);
+    for (size_t yIndex = 0; yIndex < YValues.size(); ++yIndex) {
+      const double yErrorsVal = YErrors[yIndex];
+      if (!weightedSum) {
+        partial.y[yIndex] += YValues[yIndex];
+        partial.eSquared[yIndex] += yErrorsVal * yErrorsVal;
+      } else if (std::isnormal(yErrorsVal)) { // is non-zero, nan, or infinity
+        const double errsq = yErrorsVal * yErrorsVal;
+        partial.eSquared[yIndex] += errsq;
+        partial.weight[yIndex] += 1. / errsq;
+        partial.y[yIndex] += YValues[yIndex] / errsq;
+      } else {
+        partial.nZeros[yIndex]++;
       }
-    } else {
-      YSum += YValues;
-      std::transform(YErrorSum.begin(), YErrorSum.end(), YErrors.begin(), YErrorSum.begin(),
-                     [](const double accum, const double yerrorSpec) { return accum + yerrorSpec * yerrorSpec; });
     }
+  };
+  const bool threadSafe = Kernel::threadSafe(inputWS);
+  const auto sums = m_useKahanSummation ? sumInParallel(indices, PartialSum<KahanSum>(m_yLength, weightedSum, false),
+                                                        threadSafe, progress, addSpectrum)
+                                              .values()
+                                        : sumInParallel(indices, PartialSum<double>(m_yLength, weightedSum, false),
+                                                        threadSafe, progress, addSpectrum);
 
-    // Map all the detectors onto the spectrum of the output
-    outSpec.addDetectorIDs(localworkspace->getSpectrum(wsIndex).getDetectorIDs());
-
-    progress.report();
-  }
+  auto &YSum = outSpec.mutableY();
+  std::copy(sums.y.cbegin(), sums.y.cend(), YSum.begin());
+  std::copy(sums.eSquared.cbegin(), sums.eSquared.cend(), outSpec.mutableE().begin());
 
   if (m_calculateWeightedSum) {
-    numZeros = applyWeight(numSpectra, YSum, Weight, nZeros, m_multiplyByNumSpec);
+    auto Weight = sums.weight;
+    numZeros = applyWeight(numSpectra, YSum, Weight, sums.nZeros, m_multiplyByNumSpec);
   } else {
     numZeros = 0;
   }
@@ -480,62 +645,53 @@ void SumSpectra::doFractionalSum(const MatrixWorkspace_sptr &outputWorkspace, Pr
   // the output is unfinalized
   auto isFinalized = inWS->isFinalized();
 
-  // Get references to the output workspaces's data vectors
-  auto &outSpec = outputWorkspace->getSpectrum(0);
-  auto &YSum = outSpec.mutableY();
-  auto &YErrorSum = outSpec.mutableE();
-  auto &FracSum = outWS->dataF(0);
+  const auto indices = spectraToSum(m_indices, localworkspace->spectrumInfo(), m_keepMonitors, numMasked);
+  numSpectra = indices.size();
 
-  std::vector<double> Weight;
-  std::vector<size_t> nZeros;
-  if (m_calculateWeightedSum) {
-    Weight.assign(YSum.size(), 0);
-    nZeros.assign(YSum.size(), 0);
-  }
-
-  const auto &spectrumInfo = localworkspace->spectrumInfo();
-  // Loop over spectra
-  for (const auto wsIndex : m_indices) {
-    if (!useSpectrum(spectrumInfo, wsIndex, m_keepMonitors, numMasked))
-      continue;
-    numSpectra++;
-
-    // Retrieve the spectrum into a vector
-    const auto &YValues = localworkspace->y(wsIndex);
-    const auto &YErrors = localworkspace->e(wsIndex);
-    const auto &FracArea = inWS->readF(wsIndex);
-
-    if (m_calculateWeightedSum) {
-      for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
-        const double yErrorsVal = YErrors[yIndex];
-        const double fracVal = (isFinalized ? FracArea[yIndex] : 1.0);
-        if (std::isnormal(yErrorsVal)) { // is non-zero, nan, or infinity
-          const double errsq = yErrorsVal * yErrorsVal * fracVal * fracVal;
-          YErrorSum[yIndex] += errsq;
-          Weight[yIndex] += 1. / errsq;
-          YSum[yIndex] += YValues[yIndex] * fracVal / errsq;
-        } else {
-          nZeros[yIndex]++;
-        }
-      }
-    } else {
-      for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
-        const double fracVal = (isFinalized ? FracArea[yIndex] : 1.0);
-        YSum[yIndex] += YValues[yIndex] * fracVal;
-        YErrorSum[yIndex] += YErrors[yIndex] * YErrors[yIndex] * fracVal * fracVal;
+  // Map all the detectors onto the spectrum of the output
+  auto &outSpec = outputWorkspace->getSpectrum(0);
+  outSpec.setDetectorIDs(detectorIDs(*localworkspace, indices));
+
+  const RebinnedOutput &inputWS = *inWS;
+  const bool weightedSum = m_calculateWeightedSum;
+  auto addSpectrum = [&inputWS, weightedSum, isFinalized](auto &partial, const size_t wsIndex) {
+    const auto &YValues = inputWS.y(wsIndex);
+    const auto &YErrors = inputWS.e(wsIndex);
+    const auto &FracArea = inputWS.readF(wsIndex);
+    for (size_t yIndex = 0; yIndex < YValues.size(); ++yIndex) {
+      const double yErrorsVal = YErrors[yIndex];
+      const double fracVal = (isFinalized ? FracArea[yIndex] : 1.0);
+      if (!weightedSum) {
+        partial.y[yIndex] += YValues[yIndex] * fracVal;
+        partial.eSquared[yIndex] += yErrorsVal * yErrorsVal * fracVal * fracVal;
+      } else if (std::isnormal(yErrorsVal)) { // is non-zero, nan, or infinity
+        const double errsq = yErrorsVal * yErrorsVal * fracVal * fracVal;
+        partial.eSquared[yIndex] += errsq;
+        partial.weight[yIndex] += 1. / errsq;
+        partial.y[yIndex] += YValues[yIndex] * fracVal / errsq;
+      } else {
+        partial.nZeros[yIndex]++;
       }
+      // accumulation of fractional weight is the same
+      partial.fraction[yIndex] += FracArea[yIndex];
     }
-    // accumulation of fractional weight is the same
-    std::transform(FracSum.begin(), FracSum.end(), FracArea.begin(), FracSum.begin(), std::plus<double>());
+  };
+  const bool threadSafe = Kernel::threadSafe(inputWS);
+  const auto sums = m_useKahanSummation ? sumInParallel(indices, PartialSum<KahanSum>(m_yLength, weightedSum, true),
+                                                        threadSafe, progress, addSpectrum)
+                                              .values()
+                                        : sumInParallel(indices, PartialSum<double>(m_yLength, weightedSum, true),
+                                                        threadSafe, progress, addSpectrum);
 
-    // Map all the detectors onto the spectrum of the output
-    outSpec.addDetectorIDs(localworkspace->getSpectrum(wsIndex).getDetectorIDs());
-
-    progress.report();
-  }
+  auto &YSum = outSpec.mutableY();
+  std::copy(sums.y.cbegin(), sums.y.cend(), YSum.begin());
+  std::copy(sums.eSquared.cbegin(), sums.eSquared.cend(), outSpec.mutableE().begin());
+  auto &FracSum = outWS->dataF(0);
+  std::copy(sums.fraction.cbegin(), sums.fraction.cend(), FracSum.begin());
 
   if (m_calculateWeightedSum) {
-    numZeros = applyWeight(numSpectra, YSum, Weight, nZeros, m_multiplyByNumSpec);
+    auto Weight = sums.weight;
+    numZeros = applyWeight(numSpectra, YSum, Weight, sums.nZeros, m_multiplyByNumSpec);
   } else {
     numZeros = 0;
   }
@@ -567,30 +723,38 @@ void SumSpectra::execEvent(const MatrixWorkspace_sptr &outputWorkspace, Progress
   outputEL.setSpectrumNo(m_outSpecNum);
   outputEL.clearDetectorIDs();
 
-  const auto &spectrumInfo = inputWorkspace->spectrumInfo();
-  // Loop over spectra
-  for (const auto i : m_indices) {
-    if (spectrumInfo.hasDetectors(i)) {
-      // Skip monitors, if the property is set to do so
-      if (!m_keepMonitors && spectrumInfo.isMonitor(i))
-        continue;
-      // Skip masked detectors
-      if (spectrumInfo.isMasked(i)) {
-        numMasked++;
-        continue;
-      }
-    }
-    numSpectra++;
-
-    // Add the event lists with the operator
-    const EventList &inputEL = inputWorkspace->getSpectrum(i);
+  const auto indices = spectraToSum(m_indices, inputWorkspace->spectrumInfo(), m_keepMonitors, numMasked);
+  numSpectra = indices.size();
+  outputEL.setDetectorIDs(detectorIDs(*inputWorkspace, indices));
+
+  // The events of each spectrum go one after another in the output, which is
+  // allocated once and filled in parallel. Like appending the lists one by
+  // one, the output takes the most general event type of the lists.
+  std::vector<size_t> offsets(indices.size() + 1, 0);
+  EventType eventType = TOF;
+  for (size_t i = 0; i < indices.size(); ++i) {
+    const EventList &inputEL = inputWorkspace->getSpectrum(indices[i]);
     if (inputEL.empty()) {
       ++numZeros;
+    } else {
+      eventType = std::max(eventType, inputEL.getEventType());
     }
-    outputEL += inputEL;
+    offsets[i + 1] = offsets[i] + inputEL.getNumberEvents();
+  }
 
-    progress.report();
+  outputEL.switchTo(eventType);
+  switch (eventType) {
+  case TOF:
+    copyEvents(*inputWorkspace, indices, offsets, outputEL.getEvents(), progress);
+    break;
+  case WEIGHTED:
+    copyEvents(*inputWorkspace, indices, offsets, outputEL.getWeightedEvents(), progress);
+    break;
+  case WEIGHTED_NOTIME:
+    copyEvents(*inputWorkspace, indices, offsets, outputEL.getWeightedEventsNoTime(), progress);
+    break;
   }
+  outputEL.setSortOrder(UNSORTED);
 }
 
 } // namespace Mantid::Algorithms
@@ -473,6 +473,32 @@ public:
     clean_up_workspaces(inputWS, outputWS);
   }
 
+  void test_Target_ElasticQ_For_Indirect_Throws_When_A_Detector_Has_No_EFixed() {
+    std::string inputWS("inWS");
+    const std::string outputWS("outWS");
+
+    auto testWS = WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(3, 1, false);
+    AnalysisDataService::Instance().addOrReplace(inputWS, testWS);
+    auto &pmap = testWS->instrumentParameters();
+    const auto &spectrumInfo = testWS->spectrumInfo();
+    pmap.addDouble(&spectrumInfo.detector(0), "Efixed", 0.4);
+    pmap.addDouble(&spectrumInfo.detector(2), "Efixed", 0.025);
+
+    Mantid::Algorithms::ConvertSpectrumAxis2 conv;
+    conv.initialize();
+    conv.setRethrows(true);
+    TS_ASSERT_THROWS_NOTHING(conv.setPropertyValue("InputWorkspace", inputWS));
+    TS_ASSERT_THROWS_NOTHING(conv.setPropertyValue("OutputWorkspace", outputWS));
+    TS_ASSERT_THROWS_NOTHING(conv.setPropertyValue("Target", "ElasticQ"));
+    TS_ASSERT_THROWS_NOTHING(conv.setPropertyValue("EMode", "Indirect"));
+
+    // The error from the parallel loop reaches the caller unchanged
+    TS_ASSERT_THROWS(conv.execute(), const std::invalid_argument &);
+    TS_ASSERT(!conv.isExecuted());
+
+    clean_up_workspaces(inputWS, outputWS);
+  }
+
   void test_Unordered_Axis_With_Scanned_Workspace() {
     FrameworkManager::Instance();
 
@@ -193,6 +193,35 @@ public:
     }
   }
 
+  void test_flat_plate_sample_single_scatter_with_cached_initial_tracks() {
+    const double THICKNESS = 0.001; // metres
+    auto inputWorkspace = SetupFlatPlateWorkspace(46, 1, 1.0, 1, 0.5, 1.0, 10 * THICKNESS, 10 * THICKNESS, THICKNESS);
+
+    auto alg = createAlgorithm();
+    TS_ASSERT_THROWS_NOTHING(alg->setProperty("InputWorkspace", inputWorkspace));
+    const int NSCATTERINGS = 1;
+    TS_ASSERT_THROWS_NOTHING(alg->setProperty("NumberScatterings", NSCATTERINGS));
+    TS_ASSERT_THROWS_NOTHING(alg->setProperty("NeutronPathsSingle", 10000));
+    TS_ASSERT_THROWS_NOTHING(alg->setProperty("NumberOfCachedInitialTracks", 1000));
+    TS_ASSERT_THROWS_NOTHING(alg->execute(););
+    TS_ASSERT(alg->isExecuted());
+
+    if (alg->isExecuted()) {
+      auto output =
+          Mantid::API::AnalysisDataService::Instance().retrieveWS<Mantid::API::WorkspaceGroup>("MuscatResults");
+      auto wsPtr = output->getItem("MuscatResults_Scatter_1");
+      auto singleScatterResult = std::dynamic_pointer_cast<Mantid::API::MatrixWorkspace>(wsPtr);
+      // every track through a flat plate has the same length so reusing them shouldn't change the result
+      const int SPECTRUMINDEXTOTEST = 1;
+      const double analyticResult = calculateFlatPlateAnalyticalResult(
+          singleScatterResult->histogram(SPECTRUMINDEXTOTEST).points()[0], inputWorkspace->sample().getMaterial(),
+          inputWorkspace->spectrumInfo().twoTheta(SPECTRUMINDEXTOTEST), THICKNESS);
+      const double delta(1e-05);
+      TS_ASSERT_DELTA(singleScatterResult->y(SPECTRUMINDEXTOTEST)[0], analyticResult, delta);
+      Mantid::API::AnalysisDataService::Instance().deepRemoveGroup("MuscatResults");
+    }
+  }
+
   void run_flat_plate_sample_multiple_scatter(int nPaths, bool importanceSampling) {
     // same set up as previous test but increase nscatter to 2
     const double THICKNESS = 0.001; // metres
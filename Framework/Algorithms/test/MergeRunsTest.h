@@ -437,6 +437,43 @@ public:
     AnalysisDataService::Instance().remove("outWS");
   }
 
+  //-----------------------------------------------------------------------------------------------
+  void testExec_propagates_masking() {
+    auto &ads = AnalysisDataService::Instance();
+    for (const auto &name : {"masked1", "masked2", "masked3"})
+      ads.addOrReplace(name, WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(3, 10));
+    ads.retrieveWS<MatrixWorkspace>("masked2")->mutableSpectrumInfo().setMasked(1, true);
+    ads.retrieveWS<MatrixWorkspace>("masked3")->flagMasked(0, 2);
+
+    MergeRuns mrg;
+    mrg.initialize();
+    mrg.setChild(true);
+    TS_ASSERT_THROWS_NOTHING(mrg.setPropertyValue("InputWorkspaces", "masked1,masked2,masked3"));
+    TS_ASSERT_THROWS_NOTHING(mrg.setPropertyValue("OutputWorkspace", "unused"));
+    TS_ASSERT_THROWS_NOTHING(mrg.setProperty("UseKahanSummation", true));
+    TS_ASSERT_THROWS_NOTHING(mrg.execute());
+    Workspace_sptr out = mrg.getProperty("OutputWorkspace");
+    auto output = std::dynamic_pointer_cast<MatrixWorkspace>(out);
+    TS_ASSERT(output);
+
+    // A spectrum masked in any input is masked and zeroed
+    TS_ASSERT(output->spectrumInfo().isMasked(1));
+    TS_ASSERT_EQUALS(output->y(1)[0], 0.0);
+    TS_ASSERT(!output->spectrumInfo().isMasked(0));
+    TS_ASSERT(!output->spectrumInfo().isMasked(2));
+    for (const size_t i : {0, 2}) {
+      TS_ASSERT_DELTA(output->y(i)[5], 6.0, 1e-12);
+      TS_ASSERT_DELTA(output->e(i)[5], sqrt(6.0), 1e-12);
+    }
+    // Masked bins are flagged but keep their values
+    TS_ASSERT(output->hasMaskedBins(0));
+    TS_ASSERT_EQUALS(output->maskedBins(0).count(2), 1);
+    TS_ASSERT_DELTA(output->y(0)[2], 6.0, 1e-12);
+
+    for (const auto &name : {"masked1", "masked2", "masked3"})
+      ads.remove(name);
+  }
+
   //-----------------------------------------------------------------------------------------------
   void testExec_MixingEventAnd2D_gives_a2D() {
     EventSetup();
@@ -240,6 +240,51 @@ public:
     Mantid::API::AnalysisDataService::Instance().remove(prefix + "_mask");
   }
 
+  void test_exec_difc_peak_windows_only() {
+    std::vector<double> dValues = convertPosToD(DIFC_155);
+
+    const std::string prefix{"PDCalibration_windows"};
+
+    PDCalibration alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT(alg.isInitialized())
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("InputWorkspace", "PDCalibrationTest_WS"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("MaskWorkspace", prefix + "_mask"));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("TofBinning", TOF_BINNING));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("HistogramPeakWindowsOnly", true));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputCalibrationTable", prefix + "cal"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("DiagnosticWorkspaces", prefix + "diag"));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("PeakPositions", dValues));
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    ITableWorkspace_sptr calTable = AnalysisDataService::Instance().retrieveWS<ITableWorkspace>(prefix + "cal");
+    TS_ASSERT(calTable);
+    Mantid::DataObjects::TableColumn_ptr<int> col0 = calTable->getColumn(0);
+    std::vector<int> detIDs = col0->data();
+
+    // the same as when the whole range is binned
+    for (const int detID : {155, 195}) {
+      size_t index = std::find(detIDs.begin(), detIDs.end(), detID) - detIDs.begin();
+      TS_ASSERT_EQUALS(calTable->cell<int>(index, 0), detID);           // detid
+      TS_ASSERT_DELTA(calTable->cell<double>(index, 1), DIFC_155, .01); // difc
+      TS_ASSERT_EQUALS(calTable->cell<double>(index, 2), 0);            // difa
+      TS_ASSERT_EQUALS(calTable->cell<double>(index, 3), 0);            // tzero
+    }
+    checkDSpacing(prefix + "diag_dspacing", dValues);
+
+    // only the peak windows were histogrammed
+    MatrixWorkspace_const_sptr fitted =
+        AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(prefix + "diag_fitted");
+    const auto &tof = fitted->x(WKSPINDEX_155);
+    TS_ASSERT_LESS_THAN(tof.size(), static_cast<size_t>(TOF_MAX - TOF_MIN));
+    TS_ASSERT_LESS_THAN(TOF_MIN, tof.front());
+    TS_ASSERT_LESS_THAN_EQUALS(tof.back(), TOF_MAX);
+
+    Mantid::API::AnalysisDataService::Instance().remove(prefix + "cal");
+    Mantid::API::AnalysisDataService::Instance().remove(prefix + "_mask");
+  }
+
   void test_exec_difc_tzero() {
     using Mantid::Kernel::UnitParams;
     // setup the peak postions based on transformation from detID=155
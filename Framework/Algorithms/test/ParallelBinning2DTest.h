@@ -0,0 +1,91 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAlgorithms/ParallelBinning2D.h"
+
+#include <stdexcept>
+
+using Mantid::Algorithms::ParallelBinning2D;
+
+namespace {
+struct SumCell {
+  double sum{0.};
+  void combine(const SumCell &later) { sum += later.sum; }
+};
+
+/// Records the update x -> (x + value) / 2, which depends on the order
+struct HalvingCell {
+  double value{0.};
+  double scale{1.};
+  void combine(const HalvingCell &later) {
+    value = later.scale * value + later.value;
+    scale *= later.scale;
+  }
+};
+
+constexpr size_t NUM_ROWS = 3;
+constexpr size_t NUM_COLUMNS = 4;
+constexpr size_t NUM_ITEMS = 1000;
+} // namespace
+
+class ParallelBinning2DTest : public CxxTest::TestSuite {
+public:
+  static ParallelBinning2DTest *createSuite() { return new ParallelBinning2DTest(); }
+  static void destroySuite(ParallelBinning2DTest *suite) { delete suite; }
+
+  void test_sums_match_serial_loop() {
+    ParallelBinning2D<SumCell> binning(NUM_ROWS, NUM_COLUMNS);
+    const auto grid = binning.run(NUM_ITEMS, [](const size_t item, auto &cells) {
+      cells(item % NUM_ROWS, item % NUM_COLUMNS).sum += static_cast<double>(item);
+    });
+    double expected[NUM_ROWS][NUM_COLUMNS] = {};
+    for (size_t item = 0; item < NUM_ITEMS; ++item)
+      expected[item % NUM_ROWS][item % NUM_COLUMNS] += static_cast<double>(item);
+    for (size_t row = 0; row < NUM_ROWS; ++row) {
+      for (size_t column = 0; column < NUM_COLUMNS; ++column)
+        TS_ASSERT_EQUALS(grid(row, column).sum, expected[row][column]);
+    }
+  }
+
+  void test_order_dependent_updates_match_serial_loop() {
+    ParallelBinning2D<HalvingCell> binning(NUM_ROWS, NUM_COLUMNS);
+    const auto deposit = [](const size_t item, auto &cells) {
+      auto &cell = cells(item % NUM_ROWS, 0);
+      cell.value = (cell.value + static_cast<double>(item % 7)) / 2.;
+      cell.scale /= 2.;
+    };
+    const auto parallel = binning.run(NUM_ITEMS, deposit);
+    const auto serial = binning.run(NUM_ITEMS, deposit, false);
+    for (size_t row = 0; row < NUM_ROWS; ++row)
+      TS_ASSERT_DELTA(parallel(row, 0).value, serial(row, 0).value, 1e-12);
+  }
+
+  void test_empty_cells_stay_empty() {
+    ParallelBinning2D<SumCell> binning(NUM_ROWS, NUM_COLUMNS);
+    const auto grid = binning.run(NUM_ITEMS, [](const size_t, auto &cells) { cells(0, 0).sum += 1.; });
+    TS_ASSERT_EQUALS(grid(0, 0).sum, static_cast<double>(NUM_ITEMS));
+    TS_ASSERT_EQUALS(grid(NUM_ROWS - 1, NUM_COLUMNS - 1).sum, 0.);
+  }
+
+  void test_no_items() {
+    ParallelBinning2D<SumCell> binning(NUM_ROWS, NUM_COLUMNS);
+    const auto grid = binning.run(0, [](const size_t, auto &cells) { cells(0, 0).sum += 1.; });
+    TS_ASSERT_EQUALS(grid(0, 0).sum, 0.);
+  }
+
+  void test_exception_in_deposit_is_rethrown() {
+    ParallelBinning2D<SumCell> binning(NUM_ROWS, NUM_COLUMNS);
+    const auto deposit = [](const size_t item, auto &) {
+      if (item == NUM_ITEMS - 1)
+        throw std::runtime_error("bad item");
+    };
+    TS_ASSERT_THROWS(binning.run(NUM_ITEMS, deposit), const std::runtime_error &);
+  }
+};
@@ -11,10 +11,14 @@
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/Axis.h"
 #include "MantidAlgorithms/ConvertUnits.h"
+#include "MantidAlgorithms/ParallelBinning2D.h"
 #include "MantidAlgorithms/Qxy.h"
 #include "MantidDataHandling/LoadRaw3.h"
+#include "MantidKernel/MultiThreaded.h"
 #include <cxxtest/TestSuite.h>
 
+#include <cmath>
+
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
 
@@ -176,7 +180,44 @@ public:
     Mantid::API::AnalysisDataService::Instance().remove(outputWS);
   }
 
+  void test_NaN_in_a_later_block_drops_the_earlier_blocks() {
+    // A NaN inside the last block is reset by the next deposit, which drops
+    // everything deposited before it, as in a serial loop
+    checkCellMatchesSerialLoop(90, 9.);
+    // and so is a NaN at the end of a block, by the first deposit of the next
+    checkCellMatchesSerialLoop(49, 50.);
+    // A NaN that nothing is deposited after stays
+    checkCellMatchesSerialLoop(99, std::nan(""));
+  }
+
 private:
+  /** Deposit 100 spectra into one cell on four threads, one of which is NaN
+   * @param nanItem :: the spectrum that is NaN
+   * @param expected :: the signal a serial loop gives
+   */
+  void checkCellMatchesSerialLoop(const size_t nanItem, const double expected) {
+    using Mantid::Algorithms::ParallelBinning2D;
+    using Mantid::Algorithms::QxyCell;
+    ParallelBinning2D<QxyCell> binning(1, 1);
+    const auto deposit = [nanItem](const size_t item, auto &cells) {
+      cells(0, 0).deposit(item == nanItem ? std::nan("") : 1., 1.);
+    };
+    [[maybe_unused]] const int maxThreads = PARALLEL_GET_MAX_THREADS;
+    PARALLEL_SET_NUM_THREADS(4)
+    const auto parallel = binning.run(100, deposit);
+    PARALLEL_SET_NUM_THREADS(maxThreads)
+    const auto serial = binning.run(100, deposit, false);
+
+    for (const auto &cell : {serial(0, 0), parallel(0, 0)}) {
+      if (std::isnan(expected)) {
+        TS_ASSERT(std::isnan(cell.signal));
+      } else {
+        TS_ASSERT_EQUALS(cell.signal, expected);
+        TS_ASSERT_EQUALS(cell.errorSq, expected);
+      }
+    }
+  }
+
   std::string prepareTestWs() {
     Mantid::DataHandling::LoadRaw3 loader;
     loader.initialize();
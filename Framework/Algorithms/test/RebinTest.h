@@ -118,6 +118,16 @@ public:
 
   /* execution tests */
 
+  void test_isChunkMergeable_needs_fixed_boundaries() {
+    Rebin rebin;
+    rebin.initialize();
+    rebin.setPropertyValue("Params", "1.5,2.0,20");
+    TS_ASSERT(rebin.isChunkMergeable());
+    // The range would come from the data
+    rebin.setPropertyValue("Params", "2.0");
+    TS_ASSERT(!rebin.isChunkMergeable());
+  }
+
   void testworkspace1D_dist() {
     Workspace2D_sptr test_in1D = Create1DWorkspace(50);
     test_in1D->setDistribution(true);
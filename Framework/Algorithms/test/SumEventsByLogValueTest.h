@@ -133,6 +133,52 @@ public:
     // Save more complex tests for a system test
   }
 
+  void test_pulse_times_out_of_order() {
+    // Events are matched to the log in time order, whatever their order in the
+    // event lists
+    EventWorkspace_sptr ws = WorkspaceCreationHelper::createEventWorkspace(2, 1);
+    const DateAndTime run_start("2010-01-01T00:00:00");
+    for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+      auto &eventList = ws->getSpectrum(i);
+      eventList.clear(false);
+      for (const double offset : {25.0, 15.0, 5.0, 20.0, 0.0})
+        eventList.addEventQuickly(Mantid::Types::Event::TofEvent(100.0, run_start + offset));
+    }
+    auto dblTSP = new TimeSeriesProperty<double>("doubleProp");
+    dblTSP->addValue(run_start + 10.0, 2.0);
+    dblTSP->addValue(run_start, 1.0);
+    dblTSP->addValue(run_start + 20.0, 3.0);
+    ws->mutableRun().addProperty(dblTSP);
+    auto intTSP = new TimeSeriesProperty<int>("integerProp");
+    intTSP->addValue(run_start + 10.0, 2);
+    intTSP->addValue(run_start, 1);
+    ws->mutableRun().addProperty(intTSP);
+
+    IAlgorithm_sptr alg = std::make_shared<SumEventsByLogValue>();
+    alg->initialize();
+    alg->setChild(true);
+    TS_ASSERT_THROWS_NOTHING(alg->setProperty("InputWorkspace", ws));
+    TS_ASSERT_THROWS_NOTHING(alg->setProperty("OutputWorkspace", "outws"));
+    TS_ASSERT_THROWS_NOTHING(alg->setProperty("LogName", "doubleProp"));
+    TS_ASSERT_THROWS_NOTHING(alg->setProperty("OutputBinning", "0.5,1,3.5"));
+    TS_ASSERT(alg->execute());
+    MatrixWorkspace_sptr binned = alg->getProperty("OutputWorkspace");
+    TS_ASSERT_EQUALS(binned->y(0)[0], 4.0);
+    TS_ASSERT_EQUALS(binned->y(0)[1], 2.0);
+    TS_ASSERT_EQUALS(binned->y(0)[2], 4.0);
+
+    alg->initialize();
+    alg->setChild(true);
+    TS_ASSERT_THROWS_NOTHING(alg->setProperty("InputWorkspace", ws));
+    TS_ASSERT_THROWS_NOTHING(alg->setProperty("OutputWorkspace", "outws"));
+    TS_ASSERT_THROWS_NOTHING(alg->setProperty("LogName", "integerProp"));
+    TS_ASSERT(alg->execute());
+    Workspace_sptr out = alg->getProperty("OutputWorkspace");
+    auto table = std::dynamic_pointer_cast<ITableWorkspace>(out);
+    TS_ASSERT_EQUALS(table->Int(0, 1), 4);
+    TS_ASSERT_EQUALS(table->Int(1, 1), 6);
+  }
+
   void test_loadNexus() {
     EventWorkspace_sptr WS;
     auto loader = AlgorithmManager::Instance().create("LoadEventNexus");
@@ -16,6 +16,7 @@
 #include <cmath>
 #include <cxxtest/TestSuite.h>
 #include <limits>
+#include <numeric>
 
 using namespace Mantid;
 using namespace Mantid::API;
@@ -48,6 +49,17 @@ public:
     TS_ASSERT(validationErrors.empty());
   }
 
+  void testIsChunkMergeable() {
+    Mantid::Algorithms::SumSpectra runner;
+    runner.initialize();
+    TS_ASSERT(runner.isChunkMergeable());
+    runner.setProperty("WeightedSum", true);
+    TS_ASSERT(!runner.isChunkMergeable());
+    runner.setProperty("WeightedSum", false);
+    runner.setProperty("RemoveSpecialValues", true);
+    TS_ASSERT(!runner.isChunkMergeable());
+  }
+
   void testValidateInputsWithMinGreaterThanMaxReturnErrors() {
     Mantid::Algorithms::SumSpectra runner;
     runner.initialize();
@@ -281,6 +293,53 @@ public:
     TS_ASSERT(output->run().hasProperty("NumZeroSpectra"))
   }
 
+  void testExecEvent_mixed_event_types() {
+    const int numEvents = 20;
+    EventWorkspace_sptr input = WorkspaceCreationHelper::createEventWorkspace(3, 20, numEvents);
+    input->getSpectrum(1) *= 2.0;
+
+    Mantid::Algorithms::SumSpectra alg;
+    alg.initialize();
+    alg.setChild(true);
+    alg.setProperty("InputWorkspace", input);
+    alg.setPropertyValue("OutputWorkspace", "unused");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    MatrixWorkspace_sptr out = alg.getProperty("OutputWorkspace");
+    auto output = std::dynamic_pointer_cast<EventWorkspace>(out);
+    TS_ASSERT(output);
+
+    // Like appending the lists, the output takes the weighted event type
+    const auto &outputEL = output->getSpectrum(0);
+    TS_ASSERT_EQUALS(outputEL.getEventType(), Mantid::API::WEIGHTED);
+    TS_ASSERT_EQUALS(outputEL.getNumberEvents(), 3 * numEvents);
+    const auto &events = outputEL.getWeightedEvents();
+    const double totalWeight = std::accumulate(events.cbegin(), events.cend(), 0.0,
+                                               [](double sum, const auto &event) { return sum + event.weight(); });
+    TS_ASSERT_DELTA(totalWeight, 4.0 * numEvents, 1e-10);
+    TS_ASSERT_EQUALS(outputEL.getDetectorIDs().size(), 3);
+  }
+
+  void testKahanSummation() {
+    // Adding 1 to 1e16 is lost to rounding in a plain double sum
+    auto input = WorkspaceCreationHelper::create2DWorkspace(6, 1);
+    const std::vector<double> values{1e16, 1.0, 1.0, 1.0, 1.0, -1e16};
+    for (size_t i = 0; i < values.size(); ++i) {
+      input->mutableY(i)[0] = values[i];
+      input->mutableE(i)[0] = 1.0;
+    }
+
+    Mantid::Algorithms::SumSpectra alg;
+    alg.initialize();
+    alg.setChild(true);
+    alg.setProperty("InputWorkspace", input);
+    alg.setPropertyValue("OutputWorkspace", "unused");
+    alg.setProperty("UseKahanSummation", true);
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    MatrixWorkspace_sptr output = alg.getProperty("OutputWorkspace");
+    TS_ASSERT_EQUALS(output->y(0)[0], 4.0);
+    TS_ASSERT_DELTA(output->e(0)[0], std::sqrt(6.0), 1e-12);
+  }
+
   void testRebinnedOutputSum() {
     AnalysisDataService::Instance().clear();
     RebinnedOutput_sptr ws = WorkspaceCreationHelper::createRebinnedOutputWorkspace();
@@ -0,0 +1,112 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace Benchmarks {
+
+/** State : the timing of one benchmark.
+
+  A benchmark prepares its input and then calls measure() with the code to
+  time. The code is run repeatedly until at least the minimum time has been
+  spent in it, which gives one sample of the time per iteration, and this is
+  repeated to collect the requested number of samples. The median of the
+  samples is reported.
+*/
+class State {
+public:
+  State(const double minTime, const size_t repetitions) : m_minTime(minTime), m_repetitions(repetitions) {}
+
+  /// Time body(), running setup() untimed before each iteration
+  template <typename Setup, typename Body> void measure(const Setup &setup, const Body &body) {
+    using Clock = std::chrono::steady_clock;
+    std::vector<double> samples;
+    samples.reserve(m_repetitions);
+    for (size_t repetition = 0; repetition < m_repetitions; ++repetition) {
+      double elapsed = 0.;
+      size_t iterations = 0;
+      while (iterations == 0 || elapsed < m_minTime) {
+        setup();
+        const auto start = Clock::now();
+        body();
+        elapsed += std::chrono::duration<double>(Clock::now() - start).count();
+        ++iterations;
+      }
+      samples.emplace_back(elapsed / static_cast<double>(iterations));
+      m_iterations += iterations;
+    }
+    setSamples(std::move(samples));
+  }
+
+  /// Time body()
+  template <typename Body> void measure(const Body &body) {
+    measure([] {}, body);
+  }
+
+  /// @return true if measure() has been called
+  bool measured() const { return m_measured; }
+  /// @return the median time of one iteration in seconds
+  double secondsPerIteration() const { return m_secondsPerIteration; }
+  /// @return the total number of timed iterations
+  size_t iterations() const { return m_iterations; }
+
+private:
+  void setSamples(std::vector<double> samples);
+
+  double m_minTime;
+  size_t m_repetitions;
+  bool m_measured{false};
+  double m_secondsPerIteration{0.};
+  size_t m_iterations{0};
+};
+
+/// Stop the compiler from discarding the computation of a value
+template <typename T> inline void doNotOptimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r"(&value) : "memory");
+#else
+  static const void *volatile sink;
+  sink = &value;
+#endif
+}
+
+using BenchmarkFunction = void (*)(State &);
+
+/// A registered benchmark
+struct BenchmarkInfo {
+  std::string suite;
+  std::string name;
+  BenchmarkFunction function;
+};
+
+/// Adds a benchmark to the registry when constructed
+struct Registrar {
+  Registrar(const char *suite, const char *name, BenchmarkFunction function);
+};
+
+const std::vector<BenchmarkInfo> &registeredBenchmarks();
+int runBenchmarks(int argc, char **argv);
+
+} // namespace Benchmarks
+} // namespace Mantid
+
+/** Define a benchmark, e.g.
+ *    MANTID_BENCHMARK(EventListBenchmark, sortTof) {
+ *      // set up the input, then
+ *      state.measure([&] { ... });
+ *    }
+ * Results are reported as SUITE.NAME.
+ */
+#define MANTID_BENCHMARK(SUITE, NAME)                                                                                  \
+  static void SUITE##_##NAME(Mantid::Benchmarks::State &state);                                                        \
+  static const Mantid::Benchmarks::Registrar SUITE##_##NAME##_registrar(#SUITE, #NAME, &SUITE##_##NAME);               \
+  static void SUITE##_##NAME(Mantid::Benchmarks::State &state)
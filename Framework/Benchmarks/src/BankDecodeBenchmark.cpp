@@ -0,0 +1,99 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidBenchmarks/Benchmark.h"
+#include "MantidDataHandling/BankPulseTimes.h"
+#include "MantidDataHandling/DefaultEventLoader.h"
+#include "MantidDataHandling/EventWorkspaceCollection.h"
+#include "MantidDataHandling/LoadEventNexus.h"
+#include "MantidFrameworkTestHelpers/ComponentCreationHelper.h"
+#include "MantidIndexing/IndexInfo.h"
+#include "MantidKernel/MersenneTwister.h"
+#include "MantidTypes/Core/DateAndTime.h"
+#include "MantidTypes/SpectrumDefinition.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using Mantid::DataHandling::BankPulseTimes;
+using Mantid::DataHandling::DefaultEventLoader;
+using Mantid::DataHandling::EventWorkspaceCollection;
+using Mantid::DataHandling::LoadEventNexus;
+using Mantid::Kernel::MersenneTwister;
+using Mantid::Types::Core::DateAndTime;
+
+namespace {
+constexpr size_t NUM_BANK_EVENTS = 1000000;
+constexpr size_t NUM_PULSES = 6000;
+constexpr int PIXELS_PER_SIDE = 128;
+constexpr uint32_t NUM_PIXELS = PIXELS_PER_SIDE * PIXELS_PER_SIDE;
+// the IDs of a rectangular bank start at its number times its number of pixels
+constexpr uint32_t MIN_DETID = NUM_PIXELS;
+
+/// The event arrays of one NXevent_data bank, as read from a file
+struct BankData {
+  std::shared_ptr<std::vector<uint64_t>> eventIndex;
+  std::shared_ptr<std::vector<uint32_t>> eventID;
+  std::shared_ptr<std::vector<float>> timeOfFlight;
+  std::shared_ptr<BankPulseTimes> pulseTimes;
+};
+
+BankData createBankData() {
+  MersenneTwister rng(12345, 0., 1.);
+  BankData bank;
+  bank.eventIndex = std::make_shared<std::vector<uint64_t>>(NUM_PULSES);
+  for (size_t pulse = 0; pulse < NUM_PULSES; ++pulse)
+    (*bank.eventIndex)[pulse] = NUM_BANK_EVENTS * pulse / NUM_PULSES;
+  bank.eventID = std::make_shared<std::vector<uint32_t>>(NUM_BANK_EVENTS);
+  bank.timeOfFlight = std::make_shared<std::vector<float>>(NUM_BANK_EVENTS);
+  for (size_t i = 0; i < NUM_BANK_EVENTS; ++i) {
+    // a few events have ids outside the bank, as in real data
+    (*bank.eventID)[i] = MIN_DETID + static_cast<uint32_t>(rng.nextValue() * (NUM_PIXELS + 16)) - 8;
+    (*bank.timeOfFlight)[i] = static_cast<float>(rng.nextValue() * 16666.);
+  }
+  const DateAndTime start("2010-01-01T00:00:00");
+  std::vector<DateAndTime> pulseTimes;
+  pulseTimes.reserve(NUM_PULSES);
+  for (size_t pulse = 0; pulse < NUM_PULSES; ++pulse)
+    pulseTimes.emplace_back(start + static_cast<double>(pulse) / 60.);
+  bank.pulseTimes = std::make_shared<BankPulseTimes>(pulseTimes);
+  return bank;
+}
+
+/// An event workspace with a spectrum for each pixel of a rectangular bank
+void createWorkspace(EventWorkspaceCollection &workspace) {
+  workspace.setInstrument(ComponentCreationHelper::createTestInstrumentRectangular(1, PIXELS_PER_SIDE));
+  Mantid::Indexing::IndexInfo indexInfo(NUM_PIXELS);
+  std::vector<Mantid::SpectrumDefinition> definitions(NUM_PIXELS);
+  for (size_t i = 0; i < NUM_PIXELS; ++i)
+    definitions[i].add(i);
+  indexInfo.setSpectrumDefinitions(definitions);
+  workspace.setIndexInfo(indexInfo);
+}
+} // namespace
+
+/** ProcessBankData sorting the events of a bank into the event lists of the
+ * pixels, with the arrays already in memory rather than read from a file.
+ */
+MANTID_BENCHMARK(BankDecodeBenchmark, processBankData) {
+  const auto bank = createBankData();
+  LoadEventNexus alg;
+  alg.initialize();
+  alg.filter_tof_range = false;
+  EventWorkspaceCollection workspace;
+  createWorkspace(workspace);
+
+  state.measure(
+      [&] {
+        for (size_t i = 0; i < workspace.getNumberHistograms(); ++i)
+          workspace.getSpectrum(i).clear(false);
+      },
+      [&] {
+        DefaultEventLoader::processBank(&alg, workspace, "bank1_events", bank.eventID, bank.timeOfFlight,
+                                        bank.eventIndex, bank.pulseTimes, true);
+      });
+}
@@ -0,0 +1,189 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidBenchmarks/Benchmark.h"
+
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace Mantid::Benchmarks {
+
+namespace {
+std::vector<BenchmarkInfo> &registry() {
+  static std::vector<BenchmarkInfo> benchmarks;
+  return benchmarks;
+}
+
+/// The outcome of running one benchmark
+struct Result {
+  const BenchmarkInfo *info;
+  double secondsPerIteration;
+  size_t iterations;
+  std::string error;
+};
+
+struct Options {
+  std::string filter;
+  std::string output;
+  double minTime{0.2};
+  size_t repetitions{5};
+  bool list{false};
+};
+
+void printUsage(const char *program) {
+  std::cout << "Usage: " << program << " [options]\n"
+            << "  --filter TEXT       run only the benchmarks whose SUITE.NAME contains TEXT\n"
+            << "  --output FILE       write the results to FILE as XUnit XML\n"
+            << "  --min-time SECONDS  minimum time spent in each sample (default 0.2)\n"
+            << "  --repetitions N     number of samples, of which the median is reported (default 5)\n"
+            << "  --list              list the benchmarks and exit\n";
+}
+
+std::string escapeXML(const std::string &text) {
+  std::string escaped;
+  escaped.reserve(text.size());
+  for (const char c : text) {
+    switch (c) {
+    case '&':
+      escaped += "&amp;";
+      break;
+    case '<':
+      escaped += "&lt;";
+      break;
+    case '>':
+      escaped += "&gt;";
+      break;
+    case '"':
+      escaped += "&quot;";
+      break;
+    default:
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+
+/** Write the results in the XUnit format read by
+ * Testing/PerformanceTests/xunit_to_sql.py. The time of a test case is the
+ * time of one iteration. Failed benchmarks have no time, so that they are not
+ * recorded as timings.
+ */
+void writeXUnit(const std::string &filename, const std::vector<Result> &results) {
+  std::ofstream file(filename);
+  if (!file)
+    throw std::runtime_error("Unable to open " + filename + " for writing");
+  const auto failures =
+      std::count_if(results.cbegin(), results.cend(), [](const Result &result) { return !result.error.empty(); });
+  file << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+       << "<testsuite name=\"FrameworkBenchmarks\" tests=\"" << results.size() << "\" failures=\"" << failures
+       << "\">\n";
+  file << std::setprecision(9);
+  for (const auto &result : results) {
+    file << "  <testcase classname=\"" << escapeXML(result.info->suite) << "\" name=\""
+         << escapeXML(result.info->name) << "\"";
+    if (result.error.empty()) {
+      file << " time=\"" << result.secondsPerIteration << "\" iterations=\"" << result.iterations << "\"/>\n";
+    } else {
+      file << ">\n    <failure message=\"" << escapeXML(result.error) << "\"/>\n  </testcase>\n";
+    }
+  }
+  file << "</testsuite>\n";
+}
+
+std::string formatTime(const double seconds) {
+  std::ostringstream text;
+  text << std::fixed << std::setprecision(3);
+  if (seconds < 1e-3)
+    text << seconds * 1e6 << " us";
+  else if (seconds < 1.)
+    text << seconds * 1e3 << " ms";
+  else
+    text << seconds << " s";
+  return text.str();
+}
+} // namespace
+
+void State::setSamples(std::vector<double> samples) {
+  const auto middle = samples.begin() + static_cast<std::ptrdiff_t>(samples.size() / 2);
+  std::nth_element(samples.begin(), middle, samples.end());
+  m_secondsPerIteration = *middle;
+  m_measured = true;
+}
+
+Registrar::Registrar(const char *suite, const char *name, BenchmarkFunction function) {
+  registry().push_back({suite, name, function});
+}
+
+const std::vector<BenchmarkInfo> &registeredBenchmarks() { return registry(); }
+
+/**
+ * Run the registered benchmarks selected by the command line
+ * @param argc :: number of arguments
+ * @param argv :: the arguments
+ * @return the exit code of the program
+ */
+int runBenchmarks(int argc, char **argv) {
+  Options options;
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    const bool hasValue = i + 1 < argc;
+    if (arg == "--filter" && hasValue) {
+      options.filter = argv[++i];
+    } else if (arg == "--output" && hasValue) {
+      options.output = argv[++i];
+    } else if (arg == "--min-time" && hasValue) {
+      options.minTime = std::stod(argv[++i]);
+    } else if (arg == "--repetitions" && hasValue) {
+      options.repetitions = std::max<size_t>(1, std::stoul(argv[++i]));
+    } else if (arg == "--list") {
+      options.list = true;
+    } else {
+      printUsage(argv[0]);
+      return arg == "--help" ? 0 : 1;
+    }
+  }
+
+  std::vector<Result> results;
+  for (const auto &info : registry()) {
+    const auto fullName = info.suite + "." + info.name;
+    if (fullName.find(options.filter) == std::string::npos)
+      continue;
+    if (options.list) {
+      std::cout << fullName << "\n";
+      continue;
+    }
+
+    State state(options.minTime, options.repetitions);
+    Result result{&info, 0., 0, ""};
+    try {
+      info.function(state);
+      if (!state.measured())
+        throw std::runtime_error("The benchmark did not call State::measure");
+      result.secondsPerIteration = state.secondsPerIteration();
+      result.iterations = state.iterations();
+    } catch (std::exception &e) {
+      result.error = e.what();
+    }
+    std::cout << std::left << std::setw(60) << fullName << " "
+              << (result.error.empty() ? formatTime(result.secondsPerIteration) + " (" +
+                                             std::to_string(result.iterations) + " iterations)"
+                                       : "FAILED: " + result.error)
+              << std::endl;
+    results.emplace_back(std::move(result));
+  }
+
+  if (!options.output.empty())
+    writeXUnit(options.output, results);
+  const bool failed = std::any_of(results.cbegin(), results.cend(), [](const Result &r) { return !r.error.empty(); });
+  return failed ? 1 : 0;
+}
+
+} // namespace Mantid::Benchmarks
@@ -0,0 +1,73 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidBenchmarks/Benchmark.h"
+#include "MantidFrameworkTestHelpers/ComponentCreationHelper.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/Track.h"
+#include "MantidKernel/MersenneTwister.h"
+#include "MantidKernel/V3D.h"
+
+using Mantid::Benchmarks::doNotOptimize;
+using Mantid::Benchmarks::State;
+using Mantid::Geometry::CSGObject;
+using Mantid::Geometry::Track;
+using Mantid::Kernel::MersenneTwister;
+using Mantid::Kernel::V3D;
+
+namespace {
+constexpr size_t NUM_TRACKS = 10000;
+
+/// Random points in a cube around the origin
+std::vector<V3D> createPoints(const double halfWidth, const size_t seed) {
+  MersenneTwister rng(seed, -halfWidth, halfWidth);
+  std::vector<V3D> points(NUM_TRACKS);
+  for (auto &point : points)
+    point = V3D(rng.nextValue(), rng.nextValue(), rng.nextValue());
+  return points;
+}
+
+/// Trace tracks from points outside the shape towards points inside its bounding box
+void interceptTracks(State &state, const CSGObject &shape) {
+  const auto starts = createPoints(5., 1);
+  const auto ends = createPoints(0.5, 2);
+  std::vector<V3D> directions(NUM_TRACKS);
+  for (size_t i = 0; i < NUM_TRACKS; ++i)
+    directions[i] = normalize(ends[i] - starts[i]);
+  state.measure([&] {
+    int numLinks = 0;
+    for (size_t i = 0; i < NUM_TRACKS; ++i) {
+      Track track(starts[i], directions[i]);
+      numLinks += shape.interceptSurface(track);
+    }
+    doNotOptimize(numLinks);
+  });
+}
+
+void testPoints(State &state, const CSGObject &shape) {
+  const auto points = createPoints(0.6, 3);
+  state.measure([&] {
+    size_t numInside = 0;
+    for (const auto &point : points)
+      numInside += shape.isValid(point) ? 1 : 0;
+    doNotOptimize(numInside);
+  });
+}
+} // namespace
+
+MANTID_BENCHMARK(CSGObjectBenchmark, interceptSurfaceCylinder) {
+  interceptTracks(state, *ComponentCreationHelper::createCappedCylinder(0.5, 1., V3D(0., 0., -0.5), V3D(0., 0., 1.),
+                                                                        "cylinder"));
+}
+
+MANTID_BENCHMARK(CSGObjectBenchmark, interceptSurfaceHollowShell) {
+  interceptTracks(state, *ComponentCreationHelper::createHollowShell(0.4, 0.5));
+}
+
+MANTID_BENCHMARK(CSGObjectBenchmark, isValidCylinder) {
+  testPoints(state, *ComponentCreationHelper::createCappedCylinder(0.5, 1., V3D(0., 0., -0.5), V3D(0., 0., 1.),
+                                                                   "cylinder"));
+}
@@ -0,0 +1,75 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidBenchmarks/Benchmark.h"
+#include "MantidDataObjects/EventList.h"
+#include "MantidKernel/MersenneTwister.h"
+#include "MantidTypes/Core/DateAndTime.h"
+
+using namespace Mantid::DataObjects;
+using Mantid::Kernel::MersenneTwister;
+using Mantid::MantidVec;
+using Mantid::Types::Core::DateAndTime;
+using Mantid::Types::Event::TofEvent;
+
+namespace {
+constexpr size_t NUM_EVENTS = 1000000;
+constexpr size_t NUM_BINS = 10000;
+constexpr double MAX_TOF = 100000.;
+
+/// Events with random TOFs, in pulse time order as they are loaded
+EventList createEventList() {
+  MersenneTwister rng(12345, 0., MAX_TOF);
+  const DateAndTime start("2010-01-01T00:00:00");
+  EventList events;
+  events.reserve(NUM_EVENTS);
+  for (size_t i = 0; i < NUM_EVENTS; ++i)
+    events.addEventQuickly(TofEvent(rng.nextValue(), start + static_cast<double>(i / 100) / 60.));
+  return events;
+}
+
+MantidVec createBinEdges() {
+  MantidVec edges(NUM_BINS + 1);
+  for (size_t i = 0; i <= NUM_BINS; ++i)
+    edges[i] = MAX_TOF * static_cast<double>(i) / static_cast<double>(NUM_BINS);
+  return edges;
+}
+} // namespace
+
+MANTID_BENCHMARK(EventListBenchmark, generateHistogram) {
+  const auto events = createEventList();
+  events.sortTof();
+  const auto edges = createBinEdges();
+  MantidVec counts, errors;
+  state.measure([&] {
+    events.generateHistogram(edges, counts, errors);
+    Mantid::Benchmarks::doNotOptimize(counts);
+  });
+}
+
+MANTID_BENCHMARK(EventListBenchmark, generateHistogramUnsorted) {
+  const auto unsorted = createEventList();
+  const auto edges = createBinEdges();
+  EventList events;
+  MantidVec counts, errors;
+  state.measure([&] { events = unsorted; },
+                [&] {
+                  events.generateHistogram(edges, counts, errors);
+                  Mantid::Benchmarks::doNotOptimize(counts);
+                });
+}
+
+MANTID_BENCHMARK(EventListBenchmark, sortTof) {
+  const auto unsorted = createEventList();
+  EventList events;
+  state.measure([&] { events = unsorted; }, [&] { events.sortTof(); });
+}
+
+MANTID_BENCHMARK(EventListBenchmark, convertTof) {
+  const auto original = createEventList();
+  EventList events;
+  state.measure([&] { events = original; }, [&] { events.convertTof(0.5, 10.); });
+}
@@ -0,0 +1,111 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidBenchmarks/Benchmark.h"
+#include "MantidKernel/FunctionTask.h"
+#include "MantidKernel/ThreadPool.h"
+#include "MantidKernel/TimeROI.h"
+#include "MantidKernel/TimeSeriesProperty.h"
+#include "MantidKernel/Unit.h"
+
+#include <atomic>
+#include <cmath>
+#include <memory>
+
+using namespace Mantid::Kernel;
+using Mantid::Benchmarks::doNotOptimize;
+using Mantid::Benchmarks::State;
+using Mantid::Types::Core::DateAndTime;
+
+namespace {
+constexpr size_t NUM_LOG_VALUES = 100000;
+constexpr size_t NUM_TASKS = 10000;
+constexpr size_t NUM_TOF_VALUES = 100000;
+
+/// A slowly oscillating log recorded at 10 Hz
+std::unique_ptr<TimeSeriesProperty<double>> createLog() {
+  const DateAndTime start("2010-01-01T00:00:00");
+  std::vector<DateAndTime> times;
+  std::vector<double> values;
+  times.reserve(NUM_LOG_VALUES);
+  values.reserve(NUM_LOG_VALUES);
+  for (size_t i = 0; i < NUM_LOG_VALUES; ++i) {
+    times.emplace_back(start + static_cast<double>(i) * 0.1);
+    values.emplace_back(std::sin(static_cast<double>(i) * 1e-3));
+  }
+  auto log = std::make_unique<TimeSeriesProperty<double>>("log");
+  log->addValues(times, values);
+  return log;
+}
+
+std::vector<double> createTOFs() {
+  std::vector<double> tofs(NUM_TOF_VALUES);
+  for (size_t i = 0; i < NUM_TOF_VALUES; ++i)
+    tofs[i] = 1000. + static_cast<double>(i);
+  return tofs;
+}
+
+void convertFromTOF(State &state, Unit &unit, const std::initializer_list<std::pair<const UnitParams, double>> params) {
+  const auto tofs = createTOFs();
+  std::vector<double> xdata, ydata;
+  state.measure([&] { xdata = tofs; },
+                [&] {
+                  unit.fromTOF(xdata, ydata, 10., 0, params);
+                  doNotOptimize(xdata);
+                });
+}
+} // namespace
+
+MANTID_BENCHMARK(TimeSeriesPropertyBenchmark, makeFilterByValue) {
+  const auto log = createLog();
+  state.measure([&] {
+    const auto roi = log->makeFilterByValue(0., 0.5);
+    doNotOptimize(roi);
+  });
+}
+
+MANTID_BENCHMARK(TimeSeriesPropertyBenchmark, filteredValuesAsVector) {
+  const auto log = createLog();
+  const auto roi = log->makeFilterByValue(0., 0.5);
+  state.measure([&] {
+    const auto values = log->filteredValuesAsVector(&roi);
+    doNotOptimize(values);
+  });
+}
+
+MANTID_BENCHMARK(TimeSeriesPropertyBenchmark, timeAverageValue) {
+  const auto log = createLog();
+  const auto roi = log->makeFilterByValue(0., 0.5);
+  state.measure([&] {
+    const auto average = log->timeAverageValue(&roi);
+    doNotOptimize(average);
+  });
+}
+
+MANTID_BENCHMARK(ThreadPoolBenchmark, scheduleSmallTasks) {
+  std::atomic<size_t> total{0};
+  state.measure([&] {
+    ThreadPool pool;
+    for (size_t i = 0; i < NUM_TASKS; ++i)
+      pool.schedule(std::make_shared<FunctionTask>([&total, i] { total += i; }));
+    pool.joinAll();
+  });
+}
+
+MANTID_BENCHMARK(UnitConversionBenchmark, tofToDSpacing) {
+  Units::dSpacing unit;
+  convertFromTOF(state, unit, {{UnitParams::l2, 2.}, {UnitParams::twoTheta, 1.5}});
+}
+
+MANTID_BENCHMARK(UnitConversionBenchmark, tofToWavelength) {
+  Units::Wavelength unit;
+  convertFromTOF(state, unit, {{UnitParams::l2, 2.}, {UnitParams::twoTheta, 1.5}});
+}
+
+MANTID_BENCHMARK(UnitConversionBenchmark, tofToEnergy) {
+  Units::Energy unit;
+  convertFromTOF(state, unit, {{UnitParams::l2, 2.}, {UnitParams::twoTheta, 1.5}});
+}
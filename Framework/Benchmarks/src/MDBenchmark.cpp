@@ -0,0 +1,88 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidBenchmarks/Benchmark.h"
+#include "MantidAPI/IMDHistoWorkspace.h"
+#include "MantidFrameworkTestHelpers/MDEventsTestHelper.h"
+#include "MantidKernel/MersenneTwister.h"
+#include "MantidMDAlgorithms/BinMD.h"
+
+using namespace Mantid::DataObjects;
+using Mantid::coord_t;
+using Mantid::Benchmarks::doNotOptimize;
+using Mantid::Kernel::MersenneTwister;
+
+namespace {
+constexpr size_t NUM_MD_EVENTS = 1000000;
+constexpr coord_t MD_MIN = 0.;
+constexpr coord_t MD_MAX = 10.;
+
+using Event3D = MDLeanEvent<3>;
+using Workspace3D = MDEventWorkspace<Event3D, 3>;
+
+/// Events spread uniformly over the workspace
+std::vector<Event3D> createEvents() {
+  MersenneTwister rng(12345, MD_MIN, MD_MAX);
+  std::vector<Event3D> events;
+  events.reserve(NUM_MD_EVENTS);
+  for (size_t i = 0; i < NUM_MD_EVENTS; ++i) {
+    const coord_t centers[3] = {static_cast<coord_t>(rng.nextValue()), static_cast<coord_t>(rng.nextValue()),
+                                static_cast<coord_t>(rng.nextValue())};
+    events.emplace_back(1.f, 1.f, centers);
+  }
+  return events;
+}
+
+/// An empty workspace that has not been split yet
+std::shared_ptr<Workspace3D> createWorkspace() { return MDEventsTestHelper::makeMDEW<3>(10, MD_MIN, MD_MAX); }
+
+/// A workspace holding the events, split as far as the events need
+std::shared_ptr<Workspace3D> createSplitWorkspace(const std::vector<Event3D> &events) {
+  auto workspace = createWorkspace();
+  workspace->splitBox();
+  workspace->addEvents(events);
+  workspace->splitAllIfNeeded(nullptr);
+  workspace->refreshCache();
+  return workspace;
+}
+} // namespace
+
+MANTID_BENCHMARK(MDBoxBenchmark, addEvents) {
+  const auto events = createEvents();
+  std::shared_ptr<Workspace3D> workspace;
+  state.measure([&] { workspace = createWorkspace(); }, [&] { workspace->addEvents(events); });
+}
+
+MANTID_BENCHMARK(MDBoxBenchmark, splitAllIfNeeded) {
+  const auto events = createEvents();
+  std::shared_ptr<Workspace3D> workspace;
+  state.measure(
+      [&] {
+        workspace = createWorkspace();
+        workspace->addEvents(events);
+      },
+      [&] {
+        workspace->splitBox();
+        workspace->splitAllIfNeeded(nullptr);
+      });
+}
+
+MANTID_BENCHMARK(BinMDBenchmark, axisAligned) {
+  const auto workspace = createSplitWorkspace(createEvents());
+  state.measure([&] {
+    Mantid::MDAlgorithms::BinMD alg;
+    alg.initialize();
+    alg.setChild(true);
+    alg.setProperty("InputWorkspace", std::static_pointer_cast<Mantid::API::IMDEventWorkspace>(workspace));
+    alg.setPropertyValue("AlignedDim0", "Axis0,0,10,100");
+    alg.setPropertyValue("AlignedDim1", "Axis1,0,10,100");
+    alg.setPropertyValue("AlignedDim2", "Axis2,0,10,100");
+    alg.setPropertyValue("OutputWorkspace", "binned");
+    alg.execute();
+    Mantid::API::IMDHistoWorkspace_sptr binned = alg.getProperty("OutputWorkspace");
+    doNotOptimize(binned);
+  });
+}
@@ -20,6 +20,9 @@
 #include <tuple>
 
 namespace Mantid {
+namespace DataObjects {
+class Peak;
+}
 namespace Crystal {
 
 /** Using a known crystal lattice and UB matrix, predict where single crystal
@@ -70,6 +73,13 @@ private:
   void calculateQAndAddToOutput(const Kernel::V3D &hkl, const Kernel::DblMatrix &orientedUB,
                                 const Kernel::DblMatrix &goniometerMatrix);
 
+  std::unique_ptr<DataObjects::Peak> predictPeak(const Kernel::V3D &hkl, const Kernel::DblMatrix &orientedUB,
+                                                 const Kernel::DblMatrix &goniometerMatrix) const;
+
+  void predictPeaksForGoniometers(const std::vector<Kernel::DblMatrix> &gonioVec, const Kernel::DblMatrix &ub,
+                                  const std::vector<Kernel::V3D> &possibleHKLs, double lambdaMin, double lambdaMax,
+                                  API::Progress &prog);
+
   void calculateQAndAddToOutputLeanElastic(const Kernel::V3D &hkl, const Kernel::DblMatrix &UB);
 
 private:
@@ -81,6 +91,8 @@ private:
 
   /// Number of edge pixels with no peaks
   int m_edge;
+  /// Whether to predict peaks in the extended detector space
+  bool m_useExtendedDetectorSpace = false;
 
   /// Reflection conditions possible
   std::vector<Mantid::Geometry::ReflectionCondition_sptr> m_refConds;
@@ -26,6 +26,7 @@
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/EnabledWhenProperty.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 
 #include <fstream>
 using Mantid::Kernel::EnabledWhenProperty;
@@ -168,6 +169,7 @@ void PredictPeaks::exec() {
   // Get the input properties
   Workspace_sptr rawInputWorkspace = getProperty("InputWorkspace");
   m_edge = this->getProperty("EdgePixels");
+  m_useExtendedDetectorSpace = getProperty("PredictPeaksOutsideDetectors");
   m_leanElasticPeak = (getPropertyValue("OutputType") == "LeanElasticPeak");
   bool usingInstrument = !(m_leanElasticPeak && !getProperty("CalculateWavelength"));
 
@@ -341,32 +343,11 @@ void PredictPeaks::exec() {
     logNumberOfPeaksFound(allowedPeakCount);
 
   } else {
-    for (auto &goniometerMatrix : gonioVec) {
-      // Final transformation matrix (HKL to Q in lab frame)
-      DblMatrix orientedUB = goniometerMatrix * ub;
-
-      /* Because of the additional filtering step it's better to keep track of
-       * the allowed peaks with a counter. */
-      HKLFilterWavelength lambdaFilter(orientedUB, lambdaMin, lambdaMax);
-
-      size_t allowedPeakCount = 0;
-
-      bool useExtendedDetectorSpace = getProperty("PredictPeaksOutsideDetectors");
-      if (useExtendedDetectorSpace && !m_inst->getComponentByName("extended-detector-space")) {
-        g_log.warning() << "Attempting to find peaks outside of detectors but "
-                           "no extended detector space has been defined\n";
-      }
-
-      for (auto &possibleHKL : possibleHKLs) {
-        if (lambdaFilter.isAllowed(possibleHKL)) {
-          calculateQAndAddToOutput(possibleHKL, orientedUB, goniometerMatrix);
-          ++allowedPeakCount;
-        }
-        prog.report();
-      }
-
-      logNumberOfPeaksFound(allowedPeakCount);
+    if (m_useExtendedDetectorSpace && !m_inst->getComponentByName("extended-detector-space")) {
+      g_log.warning() << "Attempting to find peaks outside of detectors but "
+                         "no extended detector space has been defined\n";
     }
+    predictPeaksForGoniometers(gonioVec, ub, possibleHKLs, lambdaMin, lambdaMax, prog);
   }
 
   // Sort peaks by run number so that peaks with equal goniometer matrices are
@@ -383,6 +364,78 @@ void PredictPeaks::exec() {
   setProperty<IPeaksWorkspace_sptr>("OutputWorkspace", m_pw);
 }
 
+/**
+ * Predict the peaks for every pair of goniometer matrix and HKL and add them
+ * to the output workspace.
+ *
+ * The pairs are split into batches of HKLs for one goniometer matrix, which
+ * are predicted in parallel. The peaks are added in the same order as a
+ * serial loop over the goniometer matrices and then the HKLs would add them.
+ *
+ * @param gonioVec :: the goniometer matrices
+ * @param ub :: the UB matrix
+ * @param possibleHKLs :: the HKLs to predict peaks for
+ * @param lambdaMin :: the minimum wavelength of a peak
+ * @param lambdaMax :: the maximum wavelength of a peak
+ * @param prog :: reports one step for every pair
+ */
+void PredictPeaks::predictPeaksForGoniometers(const std::vector<DblMatrix> &gonioVec, const DblMatrix &ub,
+                                              const std::vector<V3D> &possibleHKLs, const double lambdaMin,
+                                              const double lambdaMax, Progress &prog) {
+  // Final transformation matrices (HKL to Q in lab frame)
+  std::vector<DblMatrix> orientedUBs;
+  orientedUBs.reserve(gonioVec.size());
+  std::transform(gonioVec.cbegin(), gonioVec.cend(), std::back_inserter(orientedUBs),
+                 [&ub](const auto &goniometerMatrix) { return goniometerMatrix * ub; });
+
+  struct Batch {
+    /// Number of HKLs allowed by the wavelength filter
+    size_t allowedPeakCount = 0;
+    std::vector<std::unique_ptr<Peak>> peaks;
+  };
+  constexpr size_t batchSize = 1024;
+  const size_t batchesPerGoniometer = (possibleHKLs.size() + batchSize - 1) / batchSize;
+  std::vector<Batch> batches(gonioVec.size() * batchesPerGoniometer);
+
+  PRAGMA_OMP(parallel for schedule(dynamic, 1))
+  for (int64_t i = 0; i < static_cast<int64_t>(batches.size()); ++i) {
+    PARALLEL_START_INTERRUPT_REGION
+    const auto batchIndex = static_cast<size_t>(i);
+    const size_t goniometerIndex = batchIndex / batchesPerGoniometer;
+    const auto &orientedUB = orientedUBs[goniometerIndex];
+    /* Because of the additional filtering step it's better to keep track of
+     * the allowed peaks with a counter. */
+    HKLFilterWavelength lambdaFilter(orientedUB, lambdaMin, lambdaMax);
+    auto &batch = batches[batchIndex];
+    const size_t first = (batchIndex % batchesPerGoniometer) * batchSize;
+    const size_t last = std::min(first + batchSize, possibleHKLs.size());
+    for (size_t hklIndex = first; hklIndex < last; ++hklIndex) {
+      const auto &possibleHKL = possibleHKLs[hklIndex];
+      if (lambdaFilter.isAllowed(possibleHKL)) {
+        if (auto peak = predictPeak(possibleHKL, orientedUB, gonioVec[goniometerIndex]))
+          batch.peaks.emplace_back(std::move(peak));
+        ++batch.allowedPeakCount;
+      }
+      prog.report();
+    }
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
+  for (size_t goniometerIndex = 0; goniometerIndex < gonioVec.size(); ++goniometerIndex) {
+    size_t allowedPeakCount = 0;
+    for (size_t batchIndex = goniometerIndex * batchesPerGoniometer;
+         batchIndex < (goniometerIndex + 1) * batchesPerGoniometer; ++batchIndex) {
+      auto &batch = batches[batchIndex];
+      for (const auto &peak : batch.peaks)
+        m_pw->addPeak(*peak);
+      allowedPeakCount += batch.allowedPeakCount;
+      batch.peaks.clear();
+    }
+    logNumberOfPeaksFound(allowedPeakCount);
+  }
+}
+
 /**
  * Log the number of peaks found to fall on and off detectors
  *
@@ -541,11 +594,8 @@ void PredictPeaks::setStructureFactorCalculatorFromSample(const Sample &sample)
 /**
  * @brief Calculates Q from HKL and adds a peak to the output workspace
  *
- * This method takes HKL and uses the oriented UB matrix (UB multiplied by the
- * goniometer matrix) to calculate Q. It then creates a Peak-object using
- * that Q-vector and the internally stored instrument. If the corresponding
- * diffracted beam intersects with a detector, the peak is added to the output-
- * workspace.
+ * If the diffracted beam for the HKL intersects with a detector, the peak
+ * from predictPeak is added to the output-workspace.
  *
  * @param hkl
  * @param orientedUB
@@ -553,6 +603,26 @@ void PredictPeaks::setStructureFactorCalculatorFromSample(const Sample &sample)
  */
 void PredictPeaks::calculateQAndAddToOutput(const V3D &hkl, const DblMatrix &orientedUB,
                                             const DblMatrix &goniometerMatrix) {
+  if (const auto peak = predictPeak(hkl, orientedUB, goniometerMatrix))
+    m_pw->addPeak(*peak);
+}
+
+/**
+ * @brief Calculates Q from HKL and creates the peak it would produce
+ *
+ * This method takes HKL and uses the oriented UB matrix (UB multiplied by the
+ * goniometer matrix) to calculate Q. It then creates a Peak-object using
+ * that Q-vector and the internally stored instrument. It does not modify the
+ * algorithm, so it may be called from several threads.
+ *
+ * @param hkl
+ * @param orientedUB
+ * @param goniometerMatrix
+ * @return the peak, or nullptr if the diffracted beam does not intersect with
+ * a detector
+ */
+std::unique_ptr<Peak> PredictPeaks::predictPeak(const V3D &hkl, const DblMatrix &orientedUB,
+                                                const DblMatrix &goniometerMatrix) const {
   // The q-vector direction of the peak is = goniometer * ub * hkl_vector
   // This is in inelastic convention: momentum transfer of the LATTICE!
   // Also, q does have a 2pi factor = it is equal to 2pi/wavelength.
@@ -561,13 +631,12 @@ void PredictPeaks::calculateQAndAddToOutput(const V3D &hkl, const DblMatrix &ori
   const auto detectorDir = std::get<0>(params);
   const auto wl = std::get<1>(params);
 
-  const bool useExtendedDetectorSpace = getProperty("PredictPeaksOutsideDetectors");
   const auto result = m_detectorCacheSearch->findDetectorIndex(q);
   const auto hitDetector = std::get<0>(result);
   const auto index = std::get<1>(result);
 
-  if (!hitDetector && !useExtendedDetectorSpace) {
-    return;
+  if (!hitDetector && !m_useExtendedDetectorSpace) {
+    return nullptr;
   }
 
   const auto &detInfo = m_pw->detectorInfo();
@@ -578,9 +647,9 @@ void PredictPeaks::calculateQAndAddToOutput(const V3D &hkl, const DblMatrix &ori
     // peak hit a detector to add it to the list
     peak = std::make_unique<Peak>(m_inst, det.getID(), wl);
     if (!peak->getDetector()) {
-      return;
+      return nullptr;
     }
-  } else if (useExtendedDetectorSpace) {
+  } else if (m_useExtendedDetectorSpace) {
     // use extended detector space to try and guess peak position
     const auto returnedComponent = m_inst->getComponentByName("extended-detector-space");
     // Check that the component is valid
@@ -593,7 +662,7 @@ void PredictPeaks::calculateQAndAddToOutput(const V3D &hkl, const DblMatrix &ori
     // find where this Q vector should intersect with "extended" space
     Geometry::Track track(detInfo.samplePosition(), detectorDir);
     if (!component->interceptSurface(track))
-      return;
+      return nullptr;
 
     // The exit point is the vector to the place that we hit a detector
     const auto magnitude = track.back().exitPoint.norm();
@@ -601,7 +670,7 @@ void PredictPeaks::calculateQAndAddToOutput(const V3D &hkl, const DblMatrix &ori
   }
 
   if (m_edge > 0 && edgePixel(m_inst, peak->getBankName(), peak->getCol(), peak->getRow(), m_edge))
-    return;
+    return nullptr;
 
   // Only add peaks that hit the detector
   peak->setGoniometerMatrix(goniometerMatrix);
@@ -614,8 +683,7 @@ void PredictPeaks::calculateQAndAddToOutput(const V3D &hkl, const DblMatrix &ori
     peak->setIntensity(m_sfCalculator->getFSquared(hkl));
   }
 
-  // Add it to the workspace
-  m_pw->addPeak(*peak);
+  return peak;
 }
 
 /**
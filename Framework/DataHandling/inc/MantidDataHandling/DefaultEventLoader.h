@@ -14,6 +14,7 @@ class BankPulseTimes;
 
 namespace Mantid {
 namespace DataHandling {
+class BankPulseTimes;
 class LoadEventNexus;
 
 /** Helper class for LoadEventNexus that is specific to the current default
@@ -26,6 +27,11 @@ public:
                    std::vector<std::string> bankNames, const std::vector<int> &periodLog, const std::string &classType,
                    std::vector<std::size_t> bankNumEvents, const bool oldNeXusFileNames, const bool precount,
                    const int chunk, const int totalChunks);
+  static void processBank(LoadEventNexus *alg, EventWorkspaceCollection &ws, const std::string &bankName,
+                          std::shared_ptr<std::vector<uint32_t>> eventIDs,
+                          std::shared_ptr<std::vector<float>> timeOfFlight,
+                          std::shared_ptr<std::vector<uint64_t>> eventIndex,
+                          std::shared_ptr<BankPulseTimes> pulseTimes, const bool precount);
 
   /// Flag for dealing with a simulated file
   bool m_haveWeights;
@@ -69,6 +75,14 @@ public:
   /// event list.
   std::vector<std::vector<std::vector<Mantid::DataObjects::WeightedEventNoTime> *>> weightedNoTimeEventVectors;
 
+  /// Vector where index = event_id; value = ptr to the counts of the
+  /// spectrum, when loading directly to histograms.
+  std::vector<std::vector<double *>> histogramCounts;
+
+  /// Vector where index = event_id; value = ptr to the squared errors of the
+  /// spectrum, when loading weighted events directly to histograms.
+  std::vector<std::vector<double *>> histogramErrorsSquared;
+
   /// Vector where (index = pixel ID+pixelID_to_wi_offset), value = workspace
   /// index)
   std::vector<size_t> pixelID_to_wi_vector;
@@ -82,6 +96,8 @@ private:
   std::pair<size_t, size_t> setupChunking(std::vector<std::string> &bankNames, std::vector<std::size_t> &bankNumEvents);
   /// Map detector IDs to event lists.
   template <class T> void makeMapToEventLists(std::vector<std::vector<T>> &vectors);
+  /// Map detector IDs to something taken from each spectrum.
+  template <class T, class Getter> void makeMapToSpectra(std::vector<std::vector<T>> &vectors, const Getter &get);
 };
 
 /** Generate a look-up table where the index = the pixel ID of an event
@@ -89,6 +105,18 @@ private:
  * @param vectors :: the array to create the map on
  */
 template <class T> void DefaultEventLoader::makeMapToEventLists(std::vector<std::vector<T>> &vectors) {
+  makeMapToSpectra(vectors, [this](const size_t wi, const size_t period, T &value) {
+    getEventsFrom(m_ws.getSpectrum(wi, period), value);
+  });
+}
+
+/** Generate a look-up table where the index = the pixel ID of an event
+ * and the value = what get(workspace index, period, value) sets for its spectrum
+ * @param vectors :: the array to create the map on
+ * @param get :: sets the value of the spectrum with a workspace index in a period
+ */
+template <class T, class Getter>
+void DefaultEventLoader::makeMapToSpectra(std::vector<std::vector<T>> &vectors, const Getter &get) {
   vectors.resize(m_ws.nPeriods());
   if (event_id_is_spec) {
     // Find max spectrum no
@@ -112,7 +140,7 @@ template <class T> void DefaultEventLoader::makeMapToEventLists(std::vector<std:
     for (size_t period = 0; period < m_ws.nPeriods(); ++period) {
       for (size_t i = 0; i < m_ws.getNumberHistograms(); ++i) {
         const auto &spec = m_ws.getSpectrum(i);
-        getEventsFrom(m_ws.getSpectrum(i, period), vectors[period][spec.getSpectrumNo()]);
+        get(i, period, vectors[period][spec.getSpectrumNo()]);
       }
     }
   } else {
@@ -131,7 +159,7 @@ template <class T> void DefaultEventLoader::makeMapToEventLists(std::vector<std:
       // Save a POINTER to the vector
       if (wi < m_ws.getNumberHistograms()) {
         for (size_t period = 0; period < m_ws.nPeriods(); ++period) {
-          getEventsFrom(m_ws.getSpectrum(wi, period), vectors[period][j - pixelID_to_wi_offset]);
+          get(wi, period, vectors[period][j - pixelID_to_wi_offset]);
         }
       }
     }
@@ -0,0 +1,151 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/ITableWorkspace_fwd.h"
+#include "MantidAPI/MatrixWorkspace_fwd.h"
+#include "MantidDataHandling/DllConfig.h"
+#include "MantidGeometry/IDTypes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace Mantid {
+namespace DataHandling {
+
+/** EventHistogrammer : the histograms LoadEventNexus adds events to while
+  they are decoded when HistogramBinning is set, instead of creating event
+  lists.
+
+  The bins are given as rebin parameters in time-of-flight, or in d-spacing
+  when a calibration table with the diffractometer constants (difc, difa,
+  tzero) of each detector is set. Events of detectors missing from the
+  calibration, or outside of the bins, are not counted.
+
+  Each spectrum of each period has its own vector of counts, and of squared
+  errors for weighted events, so tasks filling different spectra do not need
+  to synchronise.
+*/
+class MANTID_DATAHANDLING_DLL EventHistogrammer {
+public:
+  /// Returned by findBin for events that are not in any bin
+  static constexpr size_t NO_BIN = std::numeric_limits<size_t>::max();
+
+  EventHistogrammer(const std::vector<double> &binParams, const size_t numPeriods, const size_t numSpectra,
+                    const bool weighted);
+
+  /// Offset added to every time-of-flight before it is binned
+  void setTofOffset(const double offset) { m_tofOffset = offset; }
+  void setCalibration(const API::ITableWorkspace &calibration);
+  bool isInDSpacing() const { return !m_calibration.empty(); }
+
+  const std::vector<double> &binEdges() const { return m_binEdges; }
+  size_t findBin(const detid_t detid, const double tof) const;
+
+  /// The counts of a spectrum, one per bin
+  double *counts(const size_t period, const size_t wi) { return m_counts[period][wi].data(); }
+  /// The squared errors of a spectrum, or nullptr if the events are not weighted
+  double *errorsSquared(const size_t period, const size_t wi) {
+    return m_errorsSquared.empty() ? nullptr : m_errorsSquared[period][wi].data();
+  }
+
+  API::MatrixWorkspace_sptr createWorkspace(const API::MatrixWorkspace &events, const size_t period);
+
+private:
+  /// The constants converting the time-of-flight of a detector to d-spacing
+  struct DiffractometerConstants {
+    double difc;
+    double difa;
+    double tzero;
+  };
+
+  static double toDSpacing(const DiffractometerConstants &constants, const double tof);
+  size_t findBinOfX(const double x) const;
+
+  enum class BinningType { LINEAR, LOGARITHMIC, GENERAL };
+
+  std::vector<double> m_binEdges;
+  BinningType m_binningType;
+  /// Inverse of the bin width, or of log(1 + |step|) for logarithmic bins
+  double m_divisor;
+  double m_tofOffset;
+  /// Indexed by detector ID minus m_firstCalibratedDetID
+  std::vector<DiffractometerConstants> m_calibration;
+  detid_t m_firstCalibratedDetID;
+  /// Indexed by period then workspace index
+  std::vector<std::vector<std::vector<double>>> m_counts;
+  std::vector<std::vector<std::vector<double>>> m_errorsSquared;
+};
+
+/**
+ * Find the bin an event falls in. This is called for every event loaded.
+ *
+ * @param detid :: The detector ID of the event
+ * @param tof :: The time-of-flight of the event in microseconds
+ * @return The index of the bin, or NO_BIN
+ */
+inline size_t EventHistogrammer::findBin(const detid_t detid, const double tof) const {
+  double x = tof + m_tofOffset;
+  if (!m_calibration.empty()) {
+    if (detid < m_firstCalibratedDetID)
+      return NO_BIN;
+    const auto index = static_cast<size_t>(detid - m_firstCalibratedDetID);
+    if (index >= m_calibration.size())
+      return NO_BIN;
+    x = toDSpacing(m_calibration[index], x);
+  }
+  return findBinOfX(x);
+}
+
+/**
+ * Convert a time-of-flight to d-spacing the same way as Units::dSpacing, but
+ * return NaN rather than throw when there is no physical solution.
+ */
+inline double EventHistogrammer::toDSpacing(const DiffractometerConstants &constants, const double tof) {
+  const double negativeConstantTerm = tof - constants.tzero;
+  if (constants.difa == 0.)
+    return negativeConstantTerm / constants.difc;
+  if (negativeConstantTerm < 0. && constants.difa > 0.)
+    return std::numeric_limits<double>::quiet_NaN();
+  if (negativeConstantTerm == 0.)
+    return constants.difa < 0. ? -constants.difc / constants.difa : 0.;
+  const double sqrtTerm = 1. + 4. * constants.difa * negativeConstantTerm / (constants.difc * constants.difc);
+  if (sqrtTerm < 0.)
+    return std::numeric_limits<double>::quiet_NaN();
+  if (negativeConstantTerm < 0.)
+    return negativeConstantTerm / (0.5 * constants.difc * (1. - std::sqrt(sqrtTerm)));
+  return negativeConstantTerm / (0.5 * constants.difc * (1. + std::sqrt(sqrtTerm)));
+}
+
+inline size_t EventHistogrammer::findBinOfX(const double x) const {
+  // written so that NaN is rejected as well
+  if (!(x >= m_binEdges.front() && x < m_binEdges.back()))
+    return NO_BIN;
+  size_t bin;
+  switch (m_binningType) {
+  case BinningType::LINEAR:
+    bin = static_cast<size_t>((x - m_binEdges.front()) * m_divisor);
+    break;
+  case BinningType::LOGARITHMIC:
+    bin = static_cast<size_t>(std::log(x / m_binEdges.front()) * m_divisor);
+    break;
+  default:
+    return static_cast<size_t>(std::upper_bound(m_binEdges.cbegin(), m_binEdges.cend(), x) - m_binEdges.cbegin()) - 1;
+  }
+  // the estimate can be out by one from rounding, or from a short last bin
+  bin = std::min(bin, m_binEdges.size() - 2);
+  while (x < m_binEdges[bin])
+    --bin;
+  while (x >= m_binEdges[bin + 1])
+    ++bin;
+  return bin;
+}
+
+} // namespace DataHandling
+} // namespace Mantid
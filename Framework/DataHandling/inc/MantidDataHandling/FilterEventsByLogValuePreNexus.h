@@ -13,6 +13,7 @@
 #include "MantidDataObjects/Events.h"
 #include "MantidKernel/BinaryFile.h"
 #include "MantidKernel/FileDescriptor.h"
+#include "MantidKernel/MemoryMappedFile.h"
 #include <fstream>
 #include <string>
 #include <vector>
@@ -122,7 +123,7 @@ private:
   void procEvents(DataObjects::EventWorkspace_sptr &workspace);
 
   void procEventsLinear(DataObjects::EventWorkspace_sptr &workspace,
-                        std::vector<Types::Event::TofEvent> **arrayOfVectors, DasEvent *event_buffer,
+                        std::vector<Types::Event::TofEvent> **arrayOfVectors, const DasEvent *event_buffer,
                         size_t current_event_buffer_size, size_t fileOffset);
 
   void setProtonCharge(DataObjects::EventWorkspace_sptr &workspace);
@@ -141,7 +142,7 @@ private:
   void filterEvents();
   ///
   void filterEventsLinear(DataObjects::EventWorkspace_sptr &workspace,
-                          std::vector<Types::Event::TofEvent> **arrayOfVectors, DasEvent *event_buffer,
+                          std::vector<Types::Event::TofEvent> **arrayOfVectors, const DasEvent *event_buffer,
                           size_t current_event_buffer_size, size_t fileOffset);
 
   /// Correct wrong event indexes with pulse
@@ -179,7 +180,7 @@ private:
   Mantid::detid_t m_detid_max;
 
   /// Handles loading from the event file
-  std::unique_ptr<Mantid::Kernel::BinaryFile<DasEvent>> m_eventFile;
+  std::unique_ptr<Mantid::Kernel::MemoryMappedFile> m_eventFile;
   std::size_t m_numEvents; ///< The number of events in the file
   std::size_t m_numPulses; ///< the number of pulses
   uint32_t m_numPixel;     ///< the number of pixels
@@ -45,6 +45,7 @@
 
 namespace Mantid {
 namespace DataHandling {
+class EventHistogrammer;
 
 /** @class InvalidLogPeriods
  * Custom exception extending std::invalid_argument
@@ -183,6 +184,11 @@ public:
   double compressTolerance;
   bool compressEvents;
 
+  /// Histograms the events are added to instead of event lists, if HistogramBinning is set
+  std::shared_ptr<EventHistogrammer> m_histograms;
+  /// A count of the events added to the histograms
+  size_t histogrammed_events;
+
   /// Pulse times for ALL banks, taken from proton_charge log.
   std::shared_ptr<BankPulseTimes> m_allBanksPulseTimes;
 
@@ -208,6 +214,8 @@ private:
   DataObjects::EventWorkspace_sptr createEmptyEventWorkspace();
 
   void loadEvents(API::Progress *const prog, const bool monitors);
+  void setupHistograms(const bool haveWeights);
+  API::Workspace_sptr createHistogramWorkspace();
   void createSpectraMapping(const std::string &nxsfile, const bool monitorsOnly,
                             const std::vector<std::string> &bankNames = std::vector<std::string>());
   void deleteBanks(const EventWorkspaceCollection_sptr &workspace, const std::vector<std::string> &bankNames);
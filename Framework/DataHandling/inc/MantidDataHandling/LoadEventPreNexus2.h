@@ -12,6 +12,7 @@
 #include "MantidDataObjects/Events.h"
 #include "MantidKernel/BinaryFile.h"
 #include "MantidKernel/FileDescriptor.h"
+#include "MantidKernel/MemoryMappedFile.h"
 #include <fstream>
 #include <string>
 #include <vector>
@@ -124,7 +125,7 @@ private:
   Mantid::detid_t detid_max;
 
   /// Handles loading from the event file
-  std::unique_ptr<Mantid::Kernel::BinaryFile<DasEvent>> eventfile;
+  std::unique_ptr<Mantid::Kernel::MemoryMappedFile> eventfile;
   std::size_t num_events; ///< The number of events in the file
   std::size_t num_pulses; ///< the number of pulses
   uint32_t numpixel;      ///< the number of pixels
@@ -190,8 +191,8 @@ private:
   void procEvents(DataObjects::EventWorkspace_sptr &workspace);
 
   void procEventsLinear(DataObjects::EventWorkspace_sptr &workspace,
-                        std::vector<Types::Event::TofEvent> **arrayOfVectors, DasEvent *event_buffer,
-                        size_t current_event_buffer_size, size_t fileOffset, bool dbprint);
+                        std::vector<Types::Event::TofEvent> **arrayOfVectors, const DasEvent *event_buffer,
+                        size_t current_event_buffer_size, size_t fileOffset, int64_t firstPulse, bool dbprint);
 
   void setProtonCharge(DataObjects::EventWorkspace_sptr &workspace);
 
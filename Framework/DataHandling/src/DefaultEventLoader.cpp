@@ -6,11 +6,15 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataHandling/DefaultEventLoader.h"
 #include "MantidAPI/Progress.h"
+#include "MantidDataHandling/EventHistogrammer.h"
 #include "MantidDataHandling/LoadBankFromDiskTask.h"
 #include "MantidDataHandling/LoadEventNexus.h"
+#include "MantidDataHandling/ProcessBankData.h"
 #include "MantidKernel/ThreadPool.h"
 #include "MantidKernel/ThreadSchedulerMutexes.h"
 
+#include <algorithm>
+
 using namespace Mantid::Kernel;
 
 namespace Mantid::DataHandling {
@@ -46,6 +50,43 @@ void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws,
   diskIOMutex.reset();
 }
 
+/** Add the unweighted events of a bank that is already in memory to the
+ * workspace with the ProcessBankData task that load() runs for each bank read
+ * from the file. The task runs on the calling thread, without splitting the
+ * bank, and the time-of-flight and pulse filters of the algorithm apply.
+ *
+ * @param alg :: The algorithm with the loading options
+ * @param ws :: The workspace to add the events to
+ * @param bankName :: The name of the bank, for logging
+ * @param eventIDs :: The detector IDs of the events
+ * @param timeOfFlight :: The times-of-flight of the events
+ * @param eventIndex :: The index of the first event of each pulse
+ * @param pulseTimes :: The pulse times of the bank
+ * @param precount :: Whether to count the events of each detector and reserve the event lists first
+ */
+void DefaultEventLoader::processBank(LoadEventNexus *alg, EventWorkspaceCollection &ws, const std::string &bankName,
+                                     std::shared_ptr<std::vector<uint32_t>> eventIDs,
+                                     std::shared_ptr<std::vector<float>> timeOfFlight,
+                                     std::shared_ptr<std::vector<uint64_t>> eventIndex,
+                                     std::shared_ptr<BankPulseTimes> pulseTimes, const bool precount) {
+  if (eventIDs->empty())
+    return;
+  DefaultEventLoader loader(alg, ws, false, false, 1, precount, EMPTY_INT(), EMPTY_INT());
+
+  // limit the detector IDs to those with event lists, as LoadBankFromDiskTask does
+  const auto [minID, maxID] = std::minmax_element(eventIDs->cbegin(), eventIDs->cend());
+  const auto minDetID = std::max(static_cast<detid_t>(*minID), -loader.pixelID_to_wi_offset);
+  const auto maxDetID = std::min(static_cast<detid_t>(*maxID), loader.eventid_max);
+  if (minDetID > maxDetID)
+    return;
+
+  const auto numEvents = eventIDs->size();
+  API::Progress prog(alg, 0., 1., 3);
+  ProcessBankData task(loader, bankName, &prog, std::move(eventIDs), std::move(timeOfFlight), numEvents, 0,
+                       std::move(eventIndex), std::move(pulseTimes), false, nullptr, minDetID, maxDetID);
+  task.run();
+}
+
 DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg, EventWorkspaceCollection &ws, bool haveWeights,
                                        bool event_id_is_spec, const size_t numBanks, const bool precount,
                                        const int chunk, const int totalChunks)
@@ -58,7 +99,17 @@ DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg, EventWorkspaceCollec
     pixelID_to_wi_vector = m_ws.getDetectorIDToWorkspaceIndexVector(pixelID_to_wi_offset, true);
 
   // Cache a map for speed.
-  if (!haveWeights) {
+  if (alg->m_histograms) {
+    // Events are added to histograms and the event lists stay empty
+    auto &histograms = *alg->m_histograms;
+    makeMapToSpectra(histogramCounts, [&histograms](const size_t wi, const size_t period, double *&counts) {
+      counts = histograms.counts(period, wi);
+    });
+    if (haveWeights)
+      makeMapToSpectra(histogramErrorsSquared, [&histograms](const size_t wi, const size_t period, double *&errors) {
+        errors = histograms.errorsSquared(period, wi);
+      });
+  } else if (!haveWeights) {
     if (alg->compressEvents && alg->compressTolerance != 0) {
       // Convert to weighted events
       for (size_t i = 0; i < m_ws.getNumberHistograms(); i++) {
@@ -0,0 +1,113 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataHandling/EventHistogrammer.h"
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/ITableWorkspace.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/UnitFactory.h"
+#include "MantidKernel/VectorHelper.h"
+
+#include <stdexcept>
+
+namespace Mantid::DataHandling {
+
+/**
+ * @param binParams :: Rebin parameters of the histograms, with at least a start, step and end
+ * @param numPeriods :: The number of periods loaded
+ * @param numSpectra :: The number of spectra of each period
+ * @param weighted :: Whether the events have weights, so the squared errors are accumulated too
+ */
+EventHistogrammer::EventHistogrammer(const std::vector<double> &binParams, const size_t numPeriods,
+                                     const size_t numSpectra, const bool weighted)
+    : m_binningType(BinningType::GENERAL), m_divisor(0.), m_tofOffset(0.), m_firstCalibratedDetID(0) {
+  if (binParams.size() < 3)
+    throw std::invalid_argument("The histogram binning needs a start, a step and an end");
+  Kernel::VectorHelper::createAxisFromRebinParams(binParams, m_binEdges);
+
+  // a single step can be turned straight into a bin number
+  if (binParams.size() == 3) {
+    const double step = binParams[1];
+    if (step > 0.) {
+      m_binningType = BinningType::LINEAR;
+      m_divisor = 1. / step;
+    } else {
+      m_binningType = BinningType::LOGARITHMIC;
+      m_divisor = 1. / std::log1p(std::fabs(step));
+    }
+  }
+
+  const size_t numBins = m_binEdges.size() - 1;
+  m_counts.assign(numPeriods, std::vector<std::vector<double>>(numSpectra, std::vector<double>(numBins, 0.)));
+  if (weighted)
+    m_errorsSquared = m_counts;
+}
+
+/**
+ * Bin the events in d-spacing using the diffractometer constants of their
+ * detectors.
+ *
+ * @param calibration :: A table with the detid, difc, difa and tzero columns
+ */
+void EventHistogrammer::setCalibration(const API::ITableWorkspace &calibration) {
+  const auto detIDs = calibration.getColumn("detid");
+  const auto difcs = calibration.getColumn("difc");
+  const auto difas = calibration.getColumn("difa");
+  const auto tzeros = calibration.getColumn("tzero");
+  const size_t numRows = calibration.rowCount();
+  if (numRows == 0)
+    throw std::invalid_argument("The calibration table is empty");
+
+  auto minDetID = std::numeric_limits<detid_t>::max();
+  auto maxDetID = std::numeric_limits<detid_t>::min();
+  for (size_t row = 0; row < numRows; ++row) {
+    const auto detID = static_cast<detid_t>(detIDs->toDouble(row));
+    minDetID = std::min(minDetID, detID);
+    maxDetID = std::max(maxDetID, detID);
+  }
+
+  // a difc of zero puts the events of detectors missing from the table outside of every bin
+  m_firstCalibratedDetID = minDetID;
+  m_calibration.assign(static_cast<size_t>(maxDetID - minDetID) + 1, DiffractometerConstants{0., 0., 0.});
+  for (size_t row = 0; row < numRows; ++row) {
+    const auto index = static_cast<size_t>(static_cast<detid_t>(detIDs->toDouble(row)) - minDetID);
+    m_calibration[index] = {difcs->toDouble(row), difas->toDouble(row), tzeros->toDouble(row)};
+  }
+}
+
+/**
+ * Create the histogram workspace of a period. The histograms are moved into
+ * it, so this can only be called once for each period.
+ *
+ * @param events :: The event workspace the events would have been loaded into,
+ * which has the instrument, logs and spectra of the output
+ * @param period :: The index of the period
+ * @return The histogram workspace
+ */
+API::MatrixWorkspace_sptr EventHistogrammer::createWorkspace(const API::MatrixWorkspace &events, const size_t period) {
+  API::MatrixWorkspace_sptr workspace =
+      DataObjects::create<DataObjects::Workspace2D>(events, HistogramData::BinEdges(m_binEdges));
+  if (isInDSpacing())
+    workspace->getAxis(0)->unit() = Kernel::UnitFactory::Instance().create("dSpacing");
+
+  auto &counts = m_counts[period];
+  const auto numSpectra = static_cast<int64_t>(counts.size());
+  PARALLEL_FOR_IF(Kernel::threadSafe(*workspace))
+  for (int64_t i = 0; i < numSpectra; ++i) {
+    const auto wi = static_cast<size_t>(i);
+    // the variance of a count of unweighted events is the count itself
+    if (m_errorsSquared.empty())
+      workspace->setCountVariances(wi, counts[wi]);
+    else
+      workspace->setCountVariances(wi, std::move(m_errorsSquared[period][wi]));
+    workspace->setCounts(wi, std::move(counts[wi]));
+  }
+  return workspace;
+}
+
+} // namespace Mantid::DataHandling
@@ -28,6 +28,7 @@
 #include "MantidKernel/FileValidator.h"
 #include "MantidKernel/Glob.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MemoryMappedFile.h"
 #include "MantidKernel/OptionalBool.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/TimeSeriesProperty.h"
@@ -849,7 +850,6 @@ void FilterEventsByLogValuePreNexus::procEvents(DataObjects::EventWorkspace_sptr
   //--------------------------------------------------------------------
   // Vector of partial workspaces, for parallel processing.
   std::vector<EventWorkspace_sptr> partWorkspaces;
-  std::vector<DasEvent *> buffers;
 
   /// Pointer to the vector of events
   using EventVector_pt = std::vector<TofEvent> *;
@@ -862,7 +862,6 @@ void FilterEventsByLogValuePreNexus::procEvents(DataObjects::EventWorkspace_sptr
     numThreads = size_t(PARALLEL_GET_MAX_THREADS);
 
   partWorkspaces.resize(numThreads);
-  buffers.resize(numThreads);
   eventVectors = new EventVector_pt *[numThreads];
 
   // Processing by number of threads
@@ -885,9 +884,6 @@ void FilterEventsByLogValuePreNexus::procEvents(DataObjects::EventWorkspace_sptr
       } else
         partWS = workspace;
 
-      // Allocate the buffers
-      buffers[i] = new DasEvent[loadBlockSize];
-
       // For each partial workspace, make an array where index = detector ID and
       // value = pointer to the events vector
       eventVectors[i] = new EventVector_pt[m_detid_max + 1];
@@ -920,9 +916,6 @@ void FilterEventsByLogValuePreNexus::procEvents(DataObjects::EventWorkspace_sptr
       } else
         ws = workspace;
 
-      // Get the buffer (for this thread)
-      DasEvent *event_buffer = buffers[threadNum];
-
       // Get the speeding-up array of vector<tofEvent> where index = detid.
       EventVector_pt *theseEventVectors = eventVectors[threadNum];
 
@@ -932,10 +925,8 @@ void FilterEventsByLogValuePreNexus::procEvents(DataObjects::EventWorkspace_sptr
       size_t current_event_buffer_size =
           (blockNum == int(numBlocks - 1)) ? (m_maxNumEvents - (numBlocks - 1) * loadBlockSize) : loadBlockSize;
 
-      // Load this chunk of event data (critical block)
-      PARALLEL_CRITICAL(FilterEventsByLogValuePreNexus_fileAccess) {
-        current_event_buffer_size = m_eventFile->loadBlockAt(event_buffer, fileOffset, current_event_buffer_size);
-      }
+      // The events are read straight from the mapped file
+      const DasEvent *event_buffer = m_eventFile->elements<DasEvent>() + fileOffset;
 
       // This processes the events. Can be done in parallel!
       procEventsLinear(ws, theseEventVectors, event_buffer, current_event_buffer_size, fileOffset);
@@ -987,9 +978,8 @@ void FilterEventsByLogValuePreNexus::procEvents(DataObjects::EventWorkspace_sptr
     }
     PARALLEL_CHECK_INTERRUPT_REGION
 
-    // Delete the buffers for each thread.
+    // Delete the event vector arrays for each thread.
     for (size_t i = 0; i < numThreads; i++) {
-      delete[] buffers[i];
       delete[] eventVectors[i];
     }
     delete[] eventVectors;
@@ -1042,7 +1032,7 @@ void FilterEventsByLogValuePreNexus::procEvents(DataObjects::EventWorkspace_sptr
  * @param fileOffset :: Value for an offset into the binary file
  */
 void FilterEventsByLogValuePreNexus::procEventsLinear(DataObjects::EventWorkspace_sptr & /*workspace*/,
-                                                      std::vector<TofEvent> **arrayOfVectors, DasEvent *event_buffer,
+                                                      std::vector<TofEvent> **arrayOfVectors, const DasEvent *event_buffer,
                                                       size_t current_event_buffer_size, size_t fileOffset) {
   //----------------------------------------------------------------------------------
   // Set up parameters to process events from raw file
@@ -1085,7 +1075,7 @@ void FilterEventsByLogValuePreNexus::procEventsLinear(DataObjects::EventWorkspac
 
   for (size_t ievent = 0; ievent < current_event_buffer_size; ++ievent) {
     // Load DasEvent
-    DasEvent &tempevent = *(event_buffer + ievent);
+    const DasEvent &tempevent = *(event_buffer + ievent);
 
     // DasEvetn's pixel ID
     PixelType pixelid = tempevent.pid;
@@ -1419,7 +1409,6 @@ void FilterEventsByLogValuePreNexus::filterEvents() {
   //--------------------------------------------------------------------
   // Vector of partial workspaces, for parallel processing.
   std::vector<EventWorkspace_sptr> partWorkspaces;
-  std::vector<DasEvent *> buffers;
 
   /// Pointer to the vector of events
   using EventVector_pt = std::vector<TofEvent> *;
@@ -1432,7 +1421,6 @@ void FilterEventsByLogValuePreNexus::filterEvents() {
     numThreads = size_t(PARALLEL_GET_MAX_THREADS);
 
   partWorkspaces.resize(numThreads);
-  buffers.resize(numThreads);
   eventVectors = new EventVector_pt *[numThreads];
 
   // Processing by number of threads
@@ -1455,9 +1443,6 @@ void FilterEventsByLogValuePreNexus::filterEvents() {
       } else
         partWS = m_localWorkspace;
 
-      // Allocate the buffers
-      buffers[i] = new DasEvent[loadBlockSize];
-
       // For each partial workspace, make an array where index = detector ID and
       // value = pointer to the events vector
       eventVectors[i] = new EventVector_pt[m_detid_max + 1];
@@ -1493,9 +1478,6 @@ void FilterEventsByLogValuePreNexus::filterEvents() {
       } else
         ws = m_localWorkspace;
 
-      // Get the buffer (for this thread)
-      DasEvent *event_buffer = buffers[threadNum];
-
       // Get the speeding-up array of vector<tofEvent> where index = detid.
       EventVector_pt *theseEventVectors = eventVectors[threadNum];
 
@@ -1505,10 +1487,8 @@ void FilterEventsByLogValuePreNexus::filterEvents() {
       size_t current_event_buffer_size =
           (blockNum == int(numBlocks - 1)) ? (m_maxNumEvents - (numBlocks - 1) * loadBlockSize) : loadBlockSize;
 
-      // Load this chunk of event data (critical block)
-      PARALLEL_CRITICAL(FilterEventsByLogValuePreNexus_fileAccess) {
-        current_event_buffer_size = m_eventFile->loadBlockAt(event_buffer, fileOffset, current_event_buffer_size);
-      }
+      // The events are read straight from the mapped file
+      const DasEvent *event_buffer = m_eventFile->elements<DasEvent>() + fileOffset;
 
       // This processes the events. Can be done in parallel!
       filterEventsLinear(ws, theseEventVectors, event_buffer, current_event_buffer_size, fileOffset);
@@ -1560,9 +1540,8 @@ void FilterEventsByLogValuePreNexus::filterEvents() {
     }
     PARALLEL_CHECK_INTERRUPT_REGION
 
-    // Delete the buffers for each thread.
+    // Delete the event vector arrays for each thread.
     for (size_t i = 0; i < numThreads; i++) {
-      delete[] buffers[i];
       delete[] eventVectors[i];
     }
     delete[] eventVectors;
@@ -1612,7 +1591,7 @@ void FilterEventsByLogValuePreNexus::filterEvents() {
  * @param fileOffset :: Value for an offset into the binary file
  */
 void FilterEventsByLogValuePreNexus::filterEventsLinear(DataObjects::EventWorkspace_sptr & /*workspace*/,
-                                                        std::vector<TofEvent> **arrayOfVectors, DasEvent *event_buffer,
+                                                        std::vector<TofEvent> **arrayOfVectors, const DasEvent *event_buffer,
                                                         size_t current_event_buffer_size, size_t fileOffset) {
   //----------------------------------------------------------------------------------
   // Set up parameters to process events from raw file
@@ -1658,8 +1637,8 @@ void FilterEventsByLogValuePreNexus::filterEventsLinear(DataObjects::EventWorksp
     definedfilterstatus = false;
   } else {
     size_t firstindex = 1234567890;
-    for (size_t i = 0; i <= current_event_buffer_size; ++i) {
-      DasEvent &tempevent = *(event_buffer + i);
+    for (size_t i = 0; i < current_event_buffer_size; ++i) {
+      const DasEvent &tempevent = *(event_buffer + i);
       PixelType pixelid = tempevent.pid;
       if (pixelid == m_vecLogPixelID[0]) {
         filterstatus = -1;
@@ -1712,7 +1691,7 @@ void FilterEventsByLogValuePreNexus::filterEventsLinear(DataObjects::EventWorksp
   for (size_t ievent = 0; ievent < current_event_buffer_size; ++ievent) {
 
     // Load DasEvent
-    DasEvent &tempevent = *(event_buffer + ievent);
+    const DasEvent &tempevent = *(event_buffer + ievent);
 
     // DasEvetn's pixel ID
     PixelType pixelid = tempevent.pid;
@@ -2146,8 +2125,8 @@ void FilterEventsByLogValuePreNexus::loadPixelMap(const std::string &filename) {
  */
 void FilterEventsByLogValuePreNexus::openEventFile(const std::string &filename) {
   // Open the file
-  m_eventFile = std::make_unique<BinaryFile<DasEvent>>(filename);
-  m_numEvents = m_eventFile->getNumElements();
+  m_eventFile = std::make_unique<MemoryMappedFile>(filename);
+  m_numEvents = m_eventFile->numElements<DasEvent>();
   g_log.debug() << "File contains " << m_numEvents << " event records.\n";
 
   // Check if we are only loading part of the event file
@@ -2185,19 +2164,18 @@ void FilterEventsByLogValuePreNexus::readPulseidFile(const std::string &filename
     return;
   }
 
-  std::vector<Pulse> pulses;
-
-  // set up for reading
+  // Read the pulses in place, like the event file
+  std::unique_ptr<MemoryMappedFile> pulseFile;
+  const Pulse *pulses = nullptr;
   // Open the file; will throw if there is any problem
   try {
-    BinaryFile<Pulse> pulseFile(filename);
+    pulseFile = std::make_unique<MemoryMappedFile>(filename);
 
     // Get the # of pulse
-    this->m_numPulses = pulseFile.getNumElements();
+    this->m_numPulses = pulseFile->numElements<Pulse>();
     this->g_log.information() << "Using pulseid file \"" << filename << "\", with " << m_numPulses << " pulses.\n";
 
-    // Load all the data
-    pulses = pulseFile.loadAll();
+    pulses = pulseFile->elements<Pulse>();
   } catch (runtime_error &e) {
     if (throwError) {
       throw;
@@ -2210,7 +2188,10 @@ void FilterEventsByLogValuePreNexus::readPulseidFile(const std::string &filename
   if (m_numPulses > 0) {
     DateAndTime lastPulseDateTime(0, 0);
     this->pulsetimes.reserve(m_numPulses);
-    for (const auto &pulse : pulses) {
+    this->m_vecEventIndex.reserve(m_numPulses);
+    this->m_protonCharge.reserve(m_numPulses);
+    for (size_t i = 0; i < m_numPulses; ++i) {
+      const Pulse &pulse = pulses[i];
       DateAndTime pulseDateTime(static_cast<int64_t>(pulse.seconds), static_cast<int64_t>(pulse.nanoseconds));
       this->pulsetimes.emplace_back(pulseDateTime);
       this->m_vecEventIndex.emplace_back(pulse.event_index);
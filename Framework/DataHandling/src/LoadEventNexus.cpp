@@ -9,11 +9,13 @@
 #include "MantidAPI/Axis.h"
 #include "MantidAPI/FileProperty.h"
 #include "MantidAPI/IEventWorkspace.h"
+#include "MantidAPI/ITableWorkspace.h"
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/RegisterFileLoader.h"
 #include "MantidAPI/Run.h"
 #include "MantidAPI/Sample.h"
 #include "MantidDataHandling/DefaultEventLoader.h"
+#include "MantidDataHandling/EventHistogrammer.h"
 #include "MantidDataHandling/EventWorkspaceCollection.h"
 #include "MantidDataHandling/LoadEventNexusIndexSetup.h"
 #include "MantidDataHandling/LoadHelper.h"
@@ -29,6 +31,7 @@
 #include "MantidKernel/EnumeratedString.h"
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/RebinParamsValidator.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidKernel/Timer.h"
 #include "MantidKernel/UnitFactory.h"
@@ -94,8 +97,8 @@ bool exists(const std::map<std::string, std::string> &entries, const std::string
  */
 LoadEventNexus::LoadEventNexus()
     : filter_tof_min(0), filter_tof_max(0), m_specMin(0), m_specMax(0), longest_tof(0), shortest_tof(0), bad_tofs(0),
-      discarded_events(0), compressEvents(false), m_instrument_loaded_correctly(false), loadlogs(false),
-      event_id_is_spec(false) {
+      discarded_events(0), compressEvents(false), histogrammed_events(0), m_instrument_loaded_correctly(false),
+      loadlogs(false), event_id_is_spec(false) {
   compressTolerance = EMPTY_DBL();
 }
 
@@ -305,6 +308,21 @@ void LoadEventNexus::init() {
                   "the binning later.  If there is no data loaded, or you "
                   "select meta data only you will only get 1 bin.");
 
+  declareProperty(
+      std::make_unique<ArrayProperty<double>>("HistogramBinning", std::make_shared<RebinParamsValidator>(true)),
+      "Optional. Rebin parameters (start, step, end, ...) of histograms to add the events to as they "
+      "are read, instead of creating event lists. The output is then a Workspace2D. A negative step "
+      "gives logarithmic bins.");
+  declareProperty(std::make_unique<WorkspaceProperty<ITableWorkspace>>("CalibrationWorkspace", "", Direction::Input,
+                                                                       PropertyMode::Optional),
+                  "Optional. A table with the detid, difc, difa and tzero columns, as made by PDCalibration "
+                  "or LoadDiffCal, to histogram the events in d-spacing. HistogramBinning is then in d-spacing.");
+  setPropertySettings("CalibrationWorkspace",
+                      std::make_unique<VisibleWhenProperty>("HistogramBinning", IS_NOT_DEFAULT));
+  std::string grp5 = "Load Into Histograms";
+  setPropertyGroup("HistogramBinning", grp5);
+  setPropertyGroup("CalibrationWorkspace", grp5);
+
   // Flexible log loading
   declareProperty(std::make_unique<PropertyWithValue<std::vector<std::string>>>("AllowList", std::vector<std::string>(),
                                                                                 Direction::Input),
@@ -325,6 +343,26 @@ std::map<std::string, std::string> LoadEventNexus::validateInputs() {
       result[PropertyNames::BAD_PULSES_CUTOFF] = "Must be empty or between 0 and 100";
   }
 
+  const std::vector<double> histogramBinning = getProperty("HistogramBinning");
+  if (!histogramBinning.empty()) {
+    if (histogramBinning.size() < 3)
+      result["HistogramBinning"] = "Must give at least a start, a step and an end";
+    const bool metaDataOnly = getProperty("MetaDataOnly");
+    if (metaDataOnly)
+      result["HistogramBinning"] = "Cannot histogram events when only the meta data is loaded";
+  }
+
+  ITableWorkspace_const_sptr calibration = getProperty("CalibrationWorkspace");
+  if (calibration) {
+    const auto columnNames = calibration->getColumnNames();
+    for (const auto &column : {"detid", "difc", "difa", "tzero"}) {
+      if (std::find(columnNames.cbegin(), columnNames.cend(), column) == columnNames.cend())
+        result["CalibrationWorkspace"] = "Missing the column '" + std::string(column) + "'";
+    }
+    if (histogramBinning.empty())
+      result["CalibrationWorkspace"] = "Can only be used with HistogramBinning";
+  }
+
   return result;
 }
 
@@ -364,6 +402,11 @@ template <typename T> void LoadEventNexus::filterDuringPause(T workspace) {
   try {
     if ((!ConfigService::Instance().hasProperty("loadeventnexus.keeppausedevents")) &&
         (m_ws->run().getLogData("pause")->size() > 1)) {
+      if (m_histograms) {
+        g_log.warning("The run was paused, but the events recorded during the pause cannot be filtered "
+                      "out of the histograms made while loading.");
+        return;
+      }
       g_log.notice("Filtering out events when the run was marked as paused. "
                    "Set the loadeventnexus.keeppausedevents configuration "
                    "property to override this.");
@@ -439,6 +482,14 @@ void LoadEventNexus::execLoader() {
       compressTolerance = -1. * std::fabs(compressTolerance);
   }
 
+  // Events added to histograms while loading are not compressed
+  m_histograms.reset();
+  if (compressEvents && !isDefault("HistogramBinning")) {
+    g_log.notice() << "The events are histogrammed while loading so " << PropertyNames::COMPRESS_TOL
+                   << " is ignored\n";
+    compressEvents = false;
+  }
+
   loadlogs = getProperty("LoadLogs");
 
   // Check to see if the monitors need to be loaded later
@@ -477,7 +528,10 @@ void LoadEventNexus::execLoader() {
   // add filename
   m_ws->mutableRun().addProperty("Filename", m_filename);
   // Save output
-  this->setProperty("OutputWorkspace", m_ws->combinedWorkspace());
+  if (m_histograms)
+    this->setProperty("OutputWorkspace", createHistogramWorkspace());
+  else
+    this->setProperty("OutputWorkspace", m_ws->combinedWorkspace());
 
   // close the file since LoadNexusMonitors will take care of its own file
   // handle
@@ -1187,6 +1241,14 @@ void LoadEventNexus::loadEvents(API::Progress *const prog, const bool monitors)
   shortest_tof = static_cast<double>(std::numeric_limits<uint32_t>::max()) * 0.1;
   longest_tof = 0.;
 
+  // Add the events to histograms rather than event lists if requested
+  if (!monitors && !isDefault("HistogramBinning")) {
+    if (descriptor->isEntry("/" + m_top_entry_name + "/detector_1_events"))
+      throw std::invalid_argument("HistogramBinning cannot be used with ISIS event files, whose times-of-flight "
+                                  "are adjusted after the events are loaded");
+    setupHistograms(haveWeights);
+  }
+
   bool loaded{false};
   auto loaderType = defineLoaderType(haveWeights, oldNeXusFileNames, classType);
   if (loaderType == LoaderType::MULTIPROCESS) {
@@ -1232,7 +1294,7 @@ void LoadEventNexus::loadEvents(API::Progress *const prog, const bool monitors)
   }
 
   // Info reporting
-  const std::size_t eventsLoaded = m_ws->getNumberEvents();
+  const std::size_t eventsLoaded = m_histograms ? histogrammed_events : m_ws->getNumberEvents();
   g_log.information() << "Read " << eventsLoaded << " events"
                       << ". Shortest TOF: " << shortest_tof << " microsec; longest TOF: " << longest_tof
                       << " microsec.\n";
@@ -1304,6 +1366,52 @@ void LoadEventNexus::loadEvents(API::Progress *const prog, const bool monitors)
   }
 }
 
+//-----------------------------------------------------------------------------
+/** Create the histograms the events are added to as they are read, for the
+ * spectra and periods of the event workspace.
+ *
+ * @param haveWeights :: Whether the events have weights
+ */
+void LoadEventNexus::setupHistograms(const bool haveWeights) {
+  const std::vector<double> histogramBinning = getProperty("HistogramBinning");
+  m_histograms =
+      std::make_shared<EventHistogrammer>(histogramBinning, m_ws->nPeriods(), m_ws->getNumberHistograms(), haveWeights);
+  histogrammed_events = 0;
+
+  ITableWorkspace_const_sptr calibration = getProperty("CalibrationWorkspace");
+  if (calibration) {
+    if (event_id_is_spec)
+      throw std::invalid_argument("CalibrationWorkspace cannot be used with a file whose event IDs are spectrum "
+                                  "numbers rather than detector IDs");
+    m_histograms->setCalibration(*calibration);
+  }
+
+  // The T0 offset of the instrument is added to the events later, which is too late for histograms
+  if (m_ws->getInstrument()->hasParameter("T0")) {
+    const std::vector<double> instrumentT0 = m_ws->getInstrument()->getNumberParameter("T0", true);
+    if (!instrumentT0.empty())
+      m_histograms->setTofOffset(instrumentT0.front());
+  }
+}
+
+/** Create the output workspace from the histograms the events were added to,
+ * with the instrument, logs and spectra of the event workspace of each period.
+ *
+ * @return A Workspace2D, or a WorkspaceGroup of them if there are several periods
+ */
+Workspace_sptr LoadEventNexus::createHistogramWorkspace() {
+  if (m_ws->nPeriods() == 1)
+    return m_histograms->createWorkspace(*m_ws->getSingleHeldWorkspace(), 0);
+
+  const auto periods = std::dynamic_pointer_cast<WorkspaceGroup>(m_ws->combinedWorkspace());
+  auto histograms = std::make_shared<WorkspaceGroup>();
+  for (size_t period = 0; period < m_ws->nPeriods(); ++period) {
+    const auto periodEvents = std::dynamic_pointer_cast<MatrixWorkspace>(periods->getItem(period));
+    histograms->addWorkspace(m_histograms->createWorkspace(*periodEvents, period));
+  }
+  return histograms;
+}
+
 //-----------------------------------------------------------------------------
 /** Load the instrument from the nexus file
  *
@@ -1523,6 +1631,16 @@ void LoadEventNexus::runLoadMonitors() {
   if (mons) {
     // Set the internal monitor workspace pointer as well
     m_ws->setMonitorWorkspace(mons);
+    if (m_histograms) {
+      // The output was made from the histograms, not the event workspaces
+      Workspace_sptr output = getProperty("OutputWorkspace");
+      if (const auto outputGroup = std::dynamic_pointer_cast<WorkspaceGroup>(output)) {
+        for (int i = 0; i < outputGroup->getNumberOfEntries(); ++i)
+          std::dynamic_pointer_cast<MatrixWorkspace>(outputGroup->getItem(i))->setMonitorWorkspace(mons);
+      } else {
+        std::dynamic_pointer_cast<MatrixWorkspace>(output)->setMonitorWorkspace(mons);
+      }
+    }
 
     filterDuringPause(mons);
   } else {
@@ -1722,6 +1840,7 @@ LoadEventNexus::LoaderType LoadEventNexus::defineLoaderType(const bool haveWeigh
   noParallelConstrictions &= !((!isDefault(PropertyNames::COMPRESS_TOL) || !isDefault("SpectrumMin") ||
                                 !isDefault("SpectrumMax") || !isDefault("SpectrumList") || !isDefault("ChunkNumber")));
   noParallelConstrictions &= !(classType != "NXevent_data");
+  noParallelConstrictions &= !m_histograms;
 
   if (!noParallelConstrictions)
     return LoaderType::DEFAULT;
@@ -27,6 +27,7 @@
 #include "MantidKernel/Glob.h"
 #include "MantidKernel/InstrumentInfo.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MemoryMappedFile.h"
 #include "MantidKernel/OptionalBool.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/TimeSeriesProperty.h"
@@ -701,7 +702,6 @@ void LoadEventPreNexus2::procEvents(DataObjects::EventWorkspace_sptr &workspace)
   //-------------------------------------------------------------------------
   // Vector of partial workspaces, for parallel processing.
   std::vector<EventWorkspace_sptr> partWorkspaces;
-  std::vector<DasEvent *> buffers;
 
   /// Pointer to the vector of events
   using EventVector_pt = std::vector<TofEvent> *;
@@ -714,7 +714,6 @@ void LoadEventPreNexus2::procEvents(DataObjects::EventWorkspace_sptr &workspace)
     numThreads = size_t(PARALLEL_GET_MAX_THREADS);
 
   partWorkspaces.resize(numThreads);
-  buffers.resize(numThreads);
   eventVectors = new EventVector_pt *[numThreads];
 
     PRAGMA_OMP( parallel for if (parallelProcessing) )
@@ -731,9 +730,6 @@ void LoadEventPreNexus2::procEvents(DataObjects::EventWorkspace_sptr &workspace)
       } else
         partWS = workspace;
 
-      // Allocate the buffers
-      buffers[i] = new DasEvent[loadBlockSize];
-
       // For each partial workspace, make an array where index = detector ID and
       // value = pointer to the events vector
       eventVectors[i] = new EventVector_pt[detid_max + 1];
@@ -754,6 +750,22 @@ void LoadEventPreNexus2::procEvents(DataObjects::EventWorkspace_sptr &workspace)
 
     prog->resetNumSteps(numBlocks, 0.1, 0.8);
 
+    const DasEvent *events = eventfile->elements<DasEvent>();
+
+    // Each block starts looking for the pulse of its first event near that
+    // pulse, rather than walking the pulses from the start of the run.
+    // Vetoed pulses can leave the event indices out of order, in which case
+    // the search starts at the first pulse as before.
+    const bool eventIndicesSorted = std::is_sorted(event_indices.cbegin(), event_indices.cend());
+    const auto lastPulseToSearch = static_cast<int64_t>(std::min(num_pulses, event_indices.size())) - 2;
+    auto firstPulseOfEvent = [&](size_t eventIndex) -> int64_t {
+      if (!eventIndicesSorted || lastPulseToSearch <= 0)
+        return 0;
+      const auto pulse = std::upper_bound(event_indices.cbegin(), event_indices.cend(), eventIndex);
+      return std::clamp(static_cast<int64_t>(std::distance(event_indices.cbegin(), pulse)) - 1, int64_t{0},
+                        lastPulseToSearch);
+    };
+
     //-------------------------------------------------------------------------
     // LOAD THE DATA
     //-------------------------------------------------------------------------
@@ -771,9 +783,6 @@ void LoadEventPreNexus2::procEvents(DataObjects::EventWorkspace_sptr &workspace)
       } else
         ws = workspace;
 
-      // Get the buffer (for this thread)
-      DasEvent *event_buffer = buffers[threadNum];
-
       // Get the speeding-up array of vector<tofEvent> where index = detid.
       EventVector_pt *theseEventVectors = eventVectors[threadNum];
 
@@ -783,14 +792,14 @@ void LoadEventPreNexus2::procEvents(DataObjects::EventWorkspace_sptr &workspace)
       size_t current_event_buffer_size =
           (blockNum == int(numBlocks - 1)) ? (max_events - (numBlocks - 1) * loadBlockSize) : loadBlockSize;
 
-      // Load this chunk of event data (critical block)
-      PARALLEL_CRITICAL(LoadEventPreNexus2_fileAccess) {
-        current_event_buffer_size = eventfile->loadBlockAt(event_buffer, fileOffset, current_event_buffer_size);
-      }
+      // The events are read straight from the mapped file, so no thread
+      // waits for another one to read its block.
+      const DasEvent *event_buffer = events + fileOffset;
 
       // This processes the events. Can be done in parallel!
       bool dbprint = m_dbOutput && (blockNum == m_dbOpBlockNumber);
-      procEventsLinear(ws, theseEventVectors, event_buffer, current_event_buffer_size, fileOffset, dbprint);
+      procEventsLinear(ws, theseEventVectors, event_buffer, current_event_buffer_size, fileOffset,
+                       firstPulseOfEvent(fileOffset), dbprint);
 
       // Report progress
       prog->report("Load Event PreNeXus");
@@ -842,9 +851,8 @@ void LoadEventPreNexus2::procEvents(DataObjects::EventWorkspace_sptr &workspace)
     // Clean memory
     //-------------------------------------------------------------------------
 
-    // Delete the buffers for each thread.
+    // Delete the event vector arrays for each thread.
     for (size_t i = 0; i < numThreads; i++) {
-      delete[] buffers[i];
       delete[] eventVectors[i];
     }
     delete[] eventVectors;
@@ -906,14 +914,16 @@ void LoadEventPreNexus2::procEvents(DataObjects::EventWorkspace_sptr &workspace)
  * @param event_buffer :: The buffer containing the DAS events
  * @param current_event_buffer_size :: The length of the given DAS buffer
  * @param fileOffset :: Value for an offset into the binary file
+ * @param firstPulse :: Index of a pulse at or before the first event's pulse
  * @param dbprint :: flag to print out events information
  */
 void LoadEventPreNexus2::procEventsLinear(DataObjects::EventWorkspace_sptr & /*workspace*/,
-                                          std::vector<TofEvent> **arrayOfVectors, DasEvent *event_buffer,
-                                          size_t current_event_buffer_size, size_t fileOffset, bool dbprint) {
+                                          std::vector<TofEvent> **arrayOfVectors, const DasEvent *event_buffer,
+                                          size_t current_event_buffer_size, size_t fileOffset, int64_t firstPulse,
+                                          bool dbprint) {
   // Starting pulse time
   DateAndTime pulsetime;
-  int64_t pulse_i = 0;
+  int64_t pulse_i = firstPulse;
   auto numPulses = static_cast<int64_t>(num_pulses);
   if (event_indices.size() < num_pulses) {
     g_log.warning() << "Event_indices vector is smaller than the pulsetimes array.\n";
@@ -939,7 +949,7 @@ void LoadEventPreNexus2::procEventsLinear(DataObjects::EventWorkspace_sptr & /*w
   std::stringstream dbss;
   // size_t numwrongpid = 0;
   for (size_t i = 0; i < current_event_buffer_size; i++) {
-    DasEvent &temp = *(event_buffer + i);
+    const DasEvent &temp = *(event_buffer + i);
     PixelType pid = temp.pid;
     bool iswrongdetid = false;
 
@@ -1190,8 +1200,8 @@ void LoadEventPreNexus2::loadPixelMap(const std::string &filename) {
  */
 void LoadEventPreNexus2::openEventFile(const std::string &filename) {
   // Open the file
-  eventfile = std::make_unique<BinaryFile<DasEvent>>(filename);
-  num_events = eventfile->getNumElements();
+  eventfile = std::make_unique<MemoryMappedFile>(filename);
+  num_events = eventfile->numElements<DasEvent>();
   g_log.debug() << "File contains " << num_events << " event records.\n";
 
   // Check if we are only loading part of the event file
@@ -1229,19 +1239,18 @@ void LoadEventPreNexus2::readPulseidFile(const std::string &filename, const bool
     return;
   }
 
-  std::vector<Pulse> pulses;
-
-  // set up for reading
+  // Read the pulses in place, like the event file
+  std::unique_ptr<MemoryMappedFile> pulseFile;
+  const Pulse *pulses = nullptr;
   // Open the file; will throw if there is any problem
   try {
-    BinaryFile<Pulse> pulseFile(filename);
+    pulseFile = std::make_unique<MemoryMappedFile>(filename);
 
     // Get the # of pulse
-    this->num_pulses = pulseFile.getNumElements();
+    this->num_pulses = pulseFile->numElements<Pulse>();
     this->g_log.information() << "Using pulseid file \"" << filename << "\", with " << num_pulses << " pulses.\n";
 
-    // Load all the data
-    pulses = pulseFile.loadAll();
+    pulses = pulseFile->elements<Pulse>();
   } catch (runtime_error &e) {
     if (throwError) {
       throw;
@@ -1254,7 +1263,10 @@ void LoadEventPreNexus2::readPulseidFile(const std::string &filename, const bool
   if (num_pulses > 0) {
     DateAndTime lastPulseDateTime(0, 0);
     this->pulsetimes.reserve(num_pulses);
-    for (const auto &pulse : pulses) {
+    this->event_indices.reserve(num_pulses);
+    this->proton_charge.reserve(num_pulses);
+    for (size_t i = 0; i < num_pulses; ++i) {
+      const Pulse &pulse = pulses[i];
       DateAndTime pulseDateTime(static_cast<int64_t>(pulse.seconds), static_cast<int64_t>(pulse.nanoseconds));
       this->pulsetimes.emplace_back(pulseDateTime);
       this->event_indices.emplace_back(pulse.event_index);
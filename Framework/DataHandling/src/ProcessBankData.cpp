@@ -7,6 +7,7 @@
 #include <utility>
 
 #include "MantidDataHandling/DefaultEventLoader.h"
+#include "MantidDataHandling/EventHistogrammer.h"
 #include "MantidDataHandling/LoadEventNexus.h"
 #include "MantidDataHandling/ProcessBankData.h"
 #include "MantidDataHandling/PulseIndexer.h"
@@ -84,10 +85,14 @@ void ProcessBankData::run() {
   // A count of "bad" TOFs that were too high
   size_t badTofs = 0;
   size_t my_discarded_events(0);
+  size_t my_histogrammed_events(0);
+
+  // Events are added straight to histograms rather than event lists if requested
+  const EventHistogrammer *histograms = m_loader.alg->m_histograms.get();
 
   prog->report(entry_name + ": precount");
   // ---- Pre-counting events per pixel ID ----
-  if (m_loader.precount) {
+  if (m_loader.precount && !histograms) {
     this->preCountAndReserveMem();
     if (m_loader.alg->getCancel())
       return; // User cancellation
@@ -142,8 +147,27 @@ void ProcessBankData::run() {
         const auto tof = static_cast<double>((*event_time_of_flight)[eventIndex]);
         // this is fancy for check if value is in range
         if ((NO_TOF_FILTERING) || ((tof - TOF_MIN) * (tof - TOF_MAX) <= 0.)) {
-          // Handle simulated data if present
-          if (have_weight) {
+          if (histograms) {
+            // We have cached the counts of the spectrum for this detector ID
+            auto *counts = m_loader.histogramCounts[periodIndex][detId];
+            // NULL counts indicates a bad spectrum lookup
+            if (counts) {
+              const size_t bin = histograms->findBin(detId, tof);
+              if (bin != EventHistogrammer::NO_BIN) {
+                if (have_weight) {
+                  const auto weight = static_cast<double>((*event_weight)[eventIndex]);
+                  counts[bin] += weight;
+                  m_loader.histogramErrorsSquared[periodIndex][detId][bin] += weight * weight;
+                } else {
+                  counts[bin] += 1.;
+                }
+                ++my_histogrammed_events;
+              }
+            } else {
+              ++my_discarded_events;
+            }
+          } else if (have_weight) {
+            // Handle simulated data if present
             auto *eventVector = m_loader.weightedEventVectors[periodIndex][detId];
             // NULL eventVector indicates a bad spectrum lookup
             if (eventVector) {
@@ -195,10 +219,10 @@ void ProcessBankData::run() {
       thisBankPulseTimes->arePulseTimesIncreasing() ? DataObjects::PULSETIME_SORT : DataObjects::UNSORTED;
 
   //------------ Compress Events (or set sort order) ------------------
-  // Do it on all the detector IDs we touched
+  // Do it on all the detector IDs we touched, unless the events went into histograms
   auto &outputWS = m_loader.m_ws;
   const size_t numEventLists = outputWS.getNumberHistograms();
-  for (detid_t pixID = m_min_detid; pixID <= m_max_detid; ++pixID) {
+  for (detid_t pixID = m_min_detid; pixID <= m_max_detid && !histograms; ++pixID) {
     if (usedDetIds[pixID - m_min_detid]) {
       // Find the workspace index corresponding to that pixel ID
       size_t wi = getWorkspaceIndexFromPixelID(pixID);
@@ -229,6 +253,7 @@ void ProcessBankData::run() {
     }
     alg->bad_tofs += badTofs;
     alg->discarded_events += my_discarded_events;
+    alg->histogrammed_events += my_histogrammed_events;
   }
 
 #ifndef _WIN32
@@ -0,0 +1,69 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataHandling/BankPulseTimes.h"
+#include "MantidDataHandling/DefaultEventLoader.h"
+#include "MantidDataHandling/EventWorkspaceCollection.h"
+#include "MantidDataHandling/LoadEventNexus.h"
+#include "MantidFrameworkTestHelpers/ComponentCreationHelper.h"
+#include "MantidIndexing/IndexInfo.h"
+#include "MantidTypes/SpectrumDefinition.h"
+
+#include <memory>
+#include <vector>
+
+using namespace Mantid::DataHandling;
+using Mantid::Types::Core::DateAndTime;
+
+class DefaultEventLoaderTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static DefaultEventLoaderTest *createSuite() { return new DefaultEventLoaderTest(); }
+  static void destroySuite(DefaultEventLoaderTest *suite) { delete suite; }
+
+  void test_processBank_sorts_events_into_spectra() {
+    LoadEventNexus alg;
+    alg.initialize();
+    alg.filter_tof_range = false;
+    // a 2x2 bank with detector IDs 4 to 7
+    EventWorkspaceCollection workspace;
+    workspace.setInstrument(ComponentCreationHelper::createTestInstrumentRectangular(1, 2));
+    Mantid::Indexing::IndexInfo indexInfo(4);
+    std::vector<Mantid::SpectrumDefinition> definitions(4);
+    for (size_t i = 0; i < definitions.size(); ++i)
+      definitions[i].add(i);
+    indexInfo.setSpectrumDefinitions(definitions);
+    workspace.setIndexInfo(indexInfo);
+
+    // two pulses, with events of detectors outside the bank in both
+    const auto eventIDs = std::make_shared<std::vector<uint32_t>>(std::vector<uint32_t>{4, 9, 7, 3, 4, 5});
+    const auto timeOfFlight =
+        std::make_shared<std::vector<float>>(std::vector<float>{100.f, 200.f, 300.f, 400.f, 500.f, 600.f});
+    const auto eventIndex = std::make_shared<std::vector<uint64_t>>(std::vector<uint64_t>{0, 3});
+    const DateAndTime start("2010-01-01T00:00:00");
+    const auto pulseTimes = std::make_shared<BankPulseTimes>(std::vector<DateAndTime>{start, start + 1.});
+
+    DefaultEventLoader::processBank(&alg, workspace, "bank1_events", eventIDs, timeOfFlight, eventIndex, pulseTimes,
+                                    true);
+
+    TS_ASSERT_EQUALS(workspace.getSpectrum(0).getNumberEvents(), 2);
+    TS_ASSERT_EQUALS(workspace.getSpectrum(1).getNumberEvents(), 1);
+    TS_ASSERT_EQUALS(workspace.getSpectrum(2).getNumberEvents(), 0);
+    TS_ASSERT_EQUALS(workspace.getSpectrum(3).getNumberEvents(), 1);
+    const auto &events = workspace.getSpectrum(0).getEvents();
+    TS_ASSERT_EQUALS(events[0].tof(), 100.);
+    TS_ASSERT_EQUALS(events[0].pulseTime(), start);
+    TS_ASSERT_EQUALS(events[1].tof(), 500.);
+    TS_ASSERT_EQUALS(events[1].pulseTime(), start + 1.);
+    // the events outside the bank are not counted in the range
+    TS_ASSERT_EQUALS(alg.longest_tof, 600.);
+  }
+};
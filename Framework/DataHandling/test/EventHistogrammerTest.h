@@ -0,0 +1,160 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/TableRow.h"
+#include "MantidDataHandling/EventHistogrammer.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/TableWorkspace.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidFrameworkTestHelpers/WorkspaceCreationHelper.h"
+#include "MantidKernel/Unit.h"
+
+#include <cxxtest/TestSuite.h>
+
+#include <algorithm>
+#include <cmath>
+
+using Mantid::DataHandling::EventHistogrammer;
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+using namespace Mantid::Kernel;
+
+class EventHistogrammerTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventHistogrammerTest *createSuite() { return new EventHistogrammerTest(); }
+  static void destroySuite(EventHistogrammerTest *suite) { delete suite; }
+
+  void test_too_few_parameters_throws() {
+    TS_ASSERT_THROWS(EventHistogrammer({10.}, 1, 1, false), const std::invalid_argument &);
+  }
+
+  void test_linear_bins() {
+    EventHistogrammer histogrammer({0., 10., 100.}, 1, 1, false);
+    TS_ASSERT_EQUALS(histogrammer.binEdges().size(), 11);
+    TS_ASSERT_EQUALS(histogrammer.findBin(1, 0.), 0);
+    TS_ASSERT_EQUALS(histogrammer.findBin(1, 9.999), 0);
+    TS_ASSERT_EQUALS(histogrammer.findBin(1, 10.), 1);
+    TS_ASSERT_EQUALS(histogrammer.findBin(1, 99.999), 9);
+    TS_ASSERT_EQUALS(histogrammer.findBin(1, 100.), EventHistogrammer::NO_BIN);
+    TS_ASSERT_EQUALS(histogrammer.findBin(1, -0.001), EventHistogrammer::NO_BIN);
+    TS_ASSERT_EQUALS(histogrammer.findBin(1, std::nan("")), EventHistogrammer::NO_BIN);
+  }
+
+  void test_linear_bins_with_short_last_bin() { checkBinsMatchEdges({1000., 3., 10001.}); }
+
+  void test_logarithmic_bins() { checkBinsMatchEdges({1000., -0.001, 20000.}); }
+
+  void test_bins_of_several_widths() { checkBinsMatchEdges({1000., 10., 2000., -0.01, 20000.}); }
+
+  void test_tof_offset() {
+    EventHistogrammer histogrammer({0., 10., 100.}, 1, 1, false);
+    histogrammer.setTofOffset(5.);
+    TS_ASSERT_EQUALS(histogrammer.findBin(1, 4.), 0);
+    TS_ASSERT_EQUALS(histogrammer.findBin(1, 5.), 1);
+    TS_ASSERT_EQUALS(histogrammer.findBin(1, 95.), EventHistogrammer::NO_BIN);
+  }
+
+  void test_calibration_bins_in_dSpacing() {
+    EventHistogrammer histogrammer({0., 0.5, 2.}, 1, 1, false);
+    TS_ASSERT(!histogrammer.isInDSpacing());
+    histogrammer.setCalibration(*createCalibration());
+    TS_ASSERT(histogrammer.isInDSpacing());
+
+    // d = (tof - tzero) / difc for the first detector
+    TS_ASSERT_EQUALS(histogrammer.findBin(10, 1009.), 1);
+    TS_ASSERT_EQUALS(histogrammer.findBin(10, 1010.), 2);
+    TS_ASSERT_EQUALS(histogrammer.findBin(10, 2010.), EventHistogrammer::NO_BIN);
+    // detectors that are not in the table
+    TS_ASSERT_EQUALS(histogrammer.findBin(9, 1010.), EventHistogrammer::NO_BIN);
+    TS_ASSERT_EQUALS(histogrammer.findBin(11, 1010.), EventHistogrammer::NO_BIN);
+    TS_ASSERT_EQUALS(histogrammer.findBin(13, 1010.), EventHistogrammer::NO_BIN);
+  }
+
+  void test_calibration_with_difa_matches_unit_conversion() {
+    EventHistogrammer histogrammer({0.1, 0.0001, 3.}, 1, 1, false);
+    histogrammer.setCalibration(*createCalibration());
+    const auto &edges = histogrammer.binEdges();
+
+    Units::dSpacing dSpacing;
+    dSpacing.initialize(10., 0, {{UnitParams::difc, 2000.}, {UnitParams::difa, -20.}, {UnitParams::tzero, 5.}});
+    for (double tof = 500.; tof < 5000.; tof += 123.) {
+      const double d = dSpacing.singleFromTOF(tof);
+      const size_t bin = histogrammer.findBin(12, tof);
+      TS_ASSERT_DIFFERS(bin, EventHistogrammer::NO_BIN);
+      TS_ASSERT(edges[bin] <= d && d < edges[bin + 1]);
+    }
+  }
+
+  void test_createWorkspace() {
+    const auto events = WorkspaceCreationHelper::createEventWorkspace2(3, 10);
+    EventHistogrammer histogrammer({0., 10., 100.}, 1, 3, false);
+    histogrammer.counts(0, 1)[2] = 4.;
+    histogrammer.counts(0, 2)[9] = 1.;
+
+    const auto workspace = histogrammer.createWorkspace(*events, 0);
+    TS_ASSERT(std::dynamic_pointer_cast<Workspace2D>(workspace));
+    TS_ASSERT_EQUALS(workspace->getNumberHistograms(), 3);
+    TS_ASSERT_EQUALS(workspace->getInstrument()->getName(), events->getInstrument()->getName());
+    TS_ASSERT_EQUALS(workspace->getSpectrum(1).getSpectrumNo(), events->getSpectrum(1).getSpectrumNo());
+    TS_ASSERT_EQUALS(workspace->getAxis(0)->unit()->unitID(), "TOF");
+    TS_ASSERT_EQUALS(workspace->x(0).rawData(), histogrammer.binEdges());
+    TS_ASSERT_EQUALS(workspace->y(0)[2], 0.);
+    TS_ASSERT_EQUALS(workspace->y(1)[2], 4.);
+    TS_ASSERT_EQUALS(workspace->e(1)[2], 2.);
+    TS_ASSERT_EQUALS(workspace->y(2)[9], 1.);
+    TS_ASSERT_EQUALS(workspace->e(2)[9], 1.);
+  }
+
+  void test_createWorkspace_weighted_in_dSpacing() {
+    const auto events = WorkspaceCreationHelper::createEventWorkspace2(2, 10);
+    EventHistogrammer histogrammer({0., 0.5, 2.}, 2, 2, true);
+    histogrammer.setCalibration(*createCalibration());
+    histogrammer.counts(1, 0)[3] = 1.5;
+    histogrammer.errorsSquared(1, 0)[3] = 1.25;
+
+    const auto workspace = histogrammer.createWorkspace(*events, 1);
+    TS_ASSERT_EQUALS(workspace->getAxis(0)->unit()->unitID(), "dSpacing");
+    TS_ASSERT_EQUALS(workspace->y(0)[3], 1.5);
+    TS_ASSERT_DELTA(workspace->e(0)[3], std::sqrt(1.25), 1e-12);
+  }
+
+private:
+  /// Check every bin against a search of the bin edges
+  void checkBinsMatchEdges(const std::vector<double> &params) {
+    EventHistogrammer histogrammer(params, 1, 1, false);
+    const auto &edges = histogrammer.binEdges();
+    for (double tof = params.front() - 1.; tof < params.back() + 1.; tof += 0.37) {
+      const auto upper = std::upper_bound(edges.cbegin(), edges.cend(), tof);
+      const size_t expected = (upper == edges.cbegin() || upper == edges.cend())
+                                  ? EventHistogrammer::NO_BIN
+                                  : static_cast<size_t>(upper - edges.cbegin()) - 1;
+      TS_ASSERT_EQUALS(histogrammer.findBin(1, tof), expected);
+    }
+    // exactly on the edges
+    for (size_t i = 0; i + 1 < edges.size(); ++i)
+      TS_ASSERT_EQUALS(histogrammer.findBin(1, edges[i]), i);
+  }
+
+  /// Detectors 10 and 12, leaving a gap at 11
+  TableWorkspace_sptr createCalibration() {
+    auto table = std::make_shared<TableWorkspace>();
+    table->addColumn("int", "detid");
+    table->addColumn("double", "difc");
+    table->addColumn("double", "difa");
+    table->addColumn("double", "tzero");
+    TableRow first = table->appendRow();
+    first << 10 << 1000. << 0. << 10.;
+    TableRow second = table->appendRow();
+    second << 12 << 2000. << -20. << 5.;
+    return table;
+  }
+};
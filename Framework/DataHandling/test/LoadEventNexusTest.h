@@ -7,13 +7,17 @@
 #pragma once
 
 #include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/Axis.h"
 #include "MantidAPI/FrameworkManager.h"
+#include "MantidAPI/ITableWorkspace.h"
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/Run.h"
 #include "MantidAPI/SpectrumInfo.h"
+#include "MantidAPI/TableRow.h"
 #include "MantidAPI/Workspace.h"
 #include "MantidDataHandling/LoadEventNexus.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/TableWorkspace.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidIndexing/SpectrumIndexSet.h"
@@ -1304,6 +1308,161 @@ public:
     AnalysisDataService::Instance().remove(filtered_name);
   }
 
+  void test_Load_Into_Histograms_with_time_and_bad_pulse_filters() {
+    // This will use ProcessBankData, adding the events to histograms rather than event lists
+    const std::string filename{"CNCS_7860_event.nxs"};
+    const std::string binning{"40000,500,70000"};
+
+    Mantid::API::FrameworkManager::Instance();
+
+    // create expected output workspace by rebinning the events after loading
+    std::string rebinned_name = "cncs_rebinned";
+    {
+      LoadEventNexus ld;
+      ld.initialize();
+      ld.setPropertyValue("Filename", filename);
+      ld.setPropertyValue("OutputWorkspace", rebinned_name);
+      ld.setProperty("FilterByTimeStart", 20.);
+      ld.setProperty("FilterByTimeStop", 50.);
+      ld.setProperty("FilterBadPulsesLowerCutoff", 95.);
+      ld.execute();
+      TS_ASSERT(ld.isExecuted());
+
+      auto rebin = AlgorithmManager::Instance().create("Rebin");
+      rebin->setPropertyValue("InputWorkspace", rebinned_name);
+      rebin->setPropertyValue("OutputWorkspace", rebinned_name);
+      rebin->setPropertyValue("Params", binning);
+      rebin->setProperty("PreserveEvents", false);
+      rebin->execute();
+      TS_ASSERT(rebin->isExecuted());
+    }
+
+    // create histogrammed during load
+    std::string histogrammed_name = "cncs_histogrammed";
+    {
+      LoadEventNexus ld;
+      ld.initialize();
+      ld.setPropertyValue("Filename", filename);
+      ld.setPropertyValue("OutputWorkspace", histogrammed_name);
+      ld.setProperty("FilterByTimeStart", 20.);
+      ld.setProperty("FilterByTimeStop", 50.);
+      ld.setProperty("FilterBadPulsesLowerCutoff", 95.);
+      ld.setPropertyValue("HistogramBinning", binning);
+      ld.execute();
+      TS_ASSERT(ld.isExecuted());
+    }
+
+    const auto histogrammed = AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(histogrammed_name);
+    TS_ASSERT(!std::dynamic_pointer_cast<EventWorkspace>(histogrammed));
+    TS_ASSERT_EQUALS(histogrammed->getNumberHistograms(), 51200);
+    TS_ASSERT_EQUALS(histogrammed->blocksize(), 60);
+
+    // validate the resulting workspace is the same as the rebinned events
+    auto checkAlg = AlgorithmManager::Instance().create("CompareWorkspaces");
+    checkAlg->setProperty("Workspace1", histogrammed_name);
+    checkAlg->setProperty("Workspace2", rebinned_name);
+    checkAlg->setProperty("CheckSample", true); // this will check that the logs get filtered correctly
+    checkAlg->execute();
+    TS_ASSERT(checkAlg->getProperty("Result"));
+
+    // cleanup
+    AnalysisDataService::Instance().remove(rebinned_name);
+    AnalysisDataService::Instance().remove(histogrammed_name);
+  }
+
+  void test_Load_Into_Histograms_in_dSpacing() {
+    const std::string filename{"CNCS_7860_event.nxs"};
+    const std::string binning{"39,0.5,69"};
+
+    Mantid::API::FrameworkManager::Instance();
+
+    // create expected output workspace by aligning and rebinning the events after loading
+    std::string aligned_name = "cncs_aligned";
+    ITableWorkspace_sptr calibration;
+    {
+      LoadEventNexus ld;
+      ld.initialize();
+      ld.setPropertyValue("Filename", filename);
+      ld.setPropertyValue("OutputWorkspace", aligned_name);
+      ld.setProperty<bool>("LoadLogs", false); // Time-saver
+      ld.execute();
+      TS_ASSERT(ld.isExecuted());
+
+      // a power of two keeps the conversion exact, so no event can move across a bin edge
+      calibration = std::make_shared<TableWorkspace>();
+      calibration->addColumn("int", "detid");
+      calibration->addColumn("double", "difc");
+      calibration->addColumn("double", "difa");
+      calibration->addColumn("double", "tzero");
+      const auto events = AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(aligned_name);
+      for (const auto detID : events->detectorInfo().detectorIDs()) {
+        TableRow row = calibration->appendRow();
+        row << detID << 1024. << 0. << 0.;
+      }
+
+      auto align = AlgorithmManager::Instance().create("AlignDetectors");
+      align->setPropertyValue("InputWorkspace", aligned_name);
+      align->setPropertyValue("OutputWorkspace", aligned_name);
+      align->setProperty("CalibrationWorkspace", calibration);
+      align->execute();
+      TS_ASSERT(align->isExecuted());
+
+      auto rebin = AlgorithmManager::Instance().create("Rebin");
+      rebin->setPropertyValue("InputWorkspace", aligned_name);
+      rebin->setPropertyValue("OutputWorkspace", aligned_name);
+      rebin->setPropertyValue("Params", binning);
+      rebin->setProperty("PreserveEvents", false);
+      rebin->execute();
+      TS_ASSERT(rebin->isExecuted());
+    }
+
+    // create histogrammed in d-spacing during load
+    std::string histogrammed_name = "cncs_histogrammed_dspacing";
+    {
+      LoadEventNexus ld;
+      ld.initialize();
+      ld.setPropertyValue("Filename", filename);
+      ld.setPropertyValue("OutputWorkspace", histogrammed_name);
+      ld.setProperty<bool>("LoadLogs", false); // Time-saver
+      ld.setPropertyValue("HistogramBinning", binning);
+      ld.setProperty("CalibrationWorkspace", calibration);
+      ld.execute();
+      TS_ASSERT(ld.isExecuted());
+    }
+
+    const auto histogrammed = AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(histogrammed_name);
+    TS_ASSERT_EQUALS(histogrammed->getAxis(0)->unit()->unitID(), "dSpacing");
+
+    auto checkAlg = AlgorithmManager::Instance().create("CompareWorkspaces");
+    checkAlg->setProperty("Workspace1", histogrammed_name);
+    checkAlg->setProperty("Workspace2", aligned_name);
+    checkAlg->execute();
+    TS_ASSERT(checkAlg->getProperty("Result"));
+
+    // cleanup
+    AnalysisDataService::Instance().remove(aligned_name);
+    AnalysisDataService::Instance().remove(histogrammed_name);
+  }
+
+  void test_CalibrationWorkspace_requires_HistogramBinning() {
+    auto calibration = std::make_shared<TableWorkspace>();
+    calibration->addColumn("int", "detid");
+    calibration->addColumn("double", "difc");
+
+    LoadEventNexus ld;
+    ld.initialize();
+    ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld.setPropertyValue("OutputWorkspace", "cncs_not_loaded");
+    ld.setProperty("CalibrationWorkspace", std::static_pointer_cast<ITableWorkspace>(calibration));
+    TS_ASSERT_THROWS_EQUALS(ld.execute(), const std::runtime_error &e, std::string(e.what()),
+                            "Some invalid Properties found: \n CalibrationWorkspace: Can only be used with "
+                            "HistogramBinning");
+
+    ld.setPropertyValue("HistogramBinning", "39,0.5,69");
+    TS_ASSERT_THROWS_EQUALS(ld.execute(), const std::runtime_error &e, std::string(e.what()),
+                            "Some invalid Properties found: \n CalibrationWorkspace: Missing the column 'tzero'");
+  }
+
   void doTestSingleBank(bool SingleBankPixelsOnly, bool Precount, const std::string &BankName = "bank36",
                         bool willFail = false) {
     Mantid::API::FrameworkManager::Instance();
@@ -12,6 +12,7 @@
 #include "MantidKernel/DiskBuffer.h"
 #include <nexus/NeXusFile.hpp>
 
+#include <memory>
 #include <mutex>
 
 namespace Mantid {
@@ -21,6 +22,8 @@ namespace DataObjects {
 /** The class responsible for saving events into nexus file using generic box
   controller interface
   * Expected to provide thread-safe file access.
+  * Files opened read-only are read with lock-free positional reads where the
+  * event data layout allows it, so boxes can be loaded from many threads.
 
     @date March 15, 2013
 */
@@ -60,6 +63,8 @@ public:
   int64_t getNDataColums() const { return m_BlockSize[1]; }
   // get pointer to the Nexus file --> compatribility testing only.
   ::NeXus::File *getFile() { return m_File.get(); }
+  /// @return true if blocks are read directly from the file, bypassing NeXus
+  bool usesDirectReads() const { return m_directReader != nullptr; }
 
   /**@brief The version of the "event_data" Nexus dataset
    *
@@ -134,6 +139,10 @@ private:
   std::vector<int64_t> m_BlockSize;
   /// lock Nexus file operations as Nexus is not thread safe
   mutable std::mutex m_fileMutex;
+  /// Reads the uncompressed chunks of "event_data" with positional reads
+  /// without taking m_fileMutex. Only set for files opened read-only.
+  class DirectBlockReader;
+  std::unique_ptr<DirectBlockReader> m_directReader;
 
   // Mainly static information which may be split into different IO classes
   // selected through chein of responsibility.
@@ -0,0 +1,172 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/MDHistoWorkspace.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <stdexcept>
+
+namespace Mantid {
+namespace DataObjects {
+/** Lazily evaluated element-wise arithmetic on MDHistoWorkspaces.
+
+  Chaining the in-place operators of MDHistoWorkspace, e.g. to compute
+  (A - B) / C * norm, needs a full temporary workspace and one sweep over
+  memory per operation. Building the same expression from the types in this
+  namespace instead records the operation tree at compile time, and
+  evaluate() computes signal and error for every bin in a single parallel
+  pass without any intermediate arrays:
+
+  @code
+  using namespace MDHistoExpression;
+  evaluate((ref(*a) - ref(*b)) / ref(*c) * scalar(norm), *out);
+  @endcode
+
+  Errors are propagated exactly as in MDHistoWorkspace::add(), subtract(),
+  multiply() and divide(). The number of events and the mask arrays of the
+  output are left untouched. The output may be one of the operands.
+*/
+namespace MDHistoExpression {
+
+/// Signal and squared error of one bin
+struct Value {
+  signal_t signal;
+  signal_t errorSquared;
+};
+
+/// Base class used to tag expression nodes, so the operators below only match expressions
+template <typename Derived> struct Expression {
+  const Derived &derived() const { return static_cast<const Derived &>(*this); }
+};
+
+/// Leaf node referring to the arrays of an existing workspace
+class Operand : public Expression<Operand> {
+public:
+  explicit Operand(const MDHistoWorkspace &ws)
+      : m_signals(ws.getSignalArray()), m_errorsSquared(ws.getErrorSquaredArray()), m_length(ws.getNPoints()) {}
+  Value operator()(size_t i) const { return {m_signals[i], m_errorsSquared[i]}; }
+  /// @return the number of bins, checked against the other operands
+  size_t length() const { return m_length; }
+
+private:
+  const signal_t *m_signals;
+  const signal_t *m_errorsSquared;
+  size_t m_length;
+};
+
+/// Leaf node broadcasting a single value to every bin
+class Scalar : public Expression<Scalar> {
+public:
+  Scalar(const signal_t signal, const signal_t error) : m_value{signal, error * error} {}
+  Value operator()(size_t) const { return m_value; }
+  /// @return 0, meaning this node matches any length
+  size_t length() const { return 0; }
+
+private:
+  Value m_value;
+};
+
+/// Interior node combining two sub-expressions bin by bin
+template <typename Op, typename Lhs, typename Rhs> class BinaryNode : public Expression<BinaryNode<Op, Lhs, Rhs>> {
+public:
+  BinaryNode(const Lhs &lhs, const Rhs &rhs) : m_lhs(lhs), m_rhs(rhs) {
+    const auto lhsLength = m_lhs.length();
+    const auto rhsLength = m_rhs.length();
+    if (lhsLength != 0 && rhsLength != 0 && lhsLength != rhsLength)
+      throw std::invalid_argument("Cannot build an MDHistoWorkspace expression: the "
+                                  "length of the signals vectors does not match.");
+  }
+  Value operator()(size_t i) const { return Op::apply(m_lhs(i), m_rhs(i)); }
+  size_t length() const { return m_lhs.length() != 0 ? m_lhs.length() : m_rhs.length(); }
+
+private:
+  Lhs m_lhs;
+  Rhs m_rhs;
+};
+
+/// f = a + b, df^2 = da^2 + db^2
+struct Plus {
+  static Value apply(const Value &a, const Value &b) {
+    return {a.signal + b.signal, a.errorSquared + b.errorSquared};
+  }
+};
+
+/// f = a - b, df^2 = da^2 + db^2
+struct Minus {
+  static Value apply(const Value &a, const Value &b) {
+    return {a.signal - b.signal, a.errorSquared + b.errorSquared};
+  }
+};
+
+/// f = a * b, df^2 = b^2 da^2 + a^2 db^2
+struct Multiplies {
+  static Value apply(const Value &a, const Value &b) {
+    return {a.signal * b.signal, a.errorSquared * b.signal * b.signal + b.errorSquared * a.signal * a.signal};
+  }
+};
+
+/// f = a / b, df^2 = da^2 / b^2 + db^2 f^2 / b^2
+struct Divides {
+  static Value apply(const Value &a, const Value &b) {
+    const signal_t f = a.signal / b.signal;
+    const signal_t b2 = b.signal * b.signal;
+    return {f, a.errorSquared / b2 + b.errorSquared * f * f / b2};
+  }
+};
+
+/// @return a leaf node reading from the given workspace
+inline Operand ref(const MDHistoWorkspace &ws) { return Operand(ws); }
+
+/// @return a leaf node with the given signal and (not squared) error in every bin
+inline Scalar scalar(const signal_t signal, const signal_t error = 0.0) { return Scalar(signal, error); }
+
+template <typename L, typename R>
+BinaryNode<Plus, L, R> operator+(const Expression<L> &lhs, const Expression<R> &rhs) {
+  return BinaryNode<Plus, L, R>(lhs.derived(), rhs.derived());
+}
+
+template <typename L, typename R>
+BinaryNode<Minus, L, R> operator-(const Expression<L> &lhs, const Expression<R> &rhs) {
+  return BinaryNode<Minus, L, R>(lhs.derived(), rhs.derived());
+}
+
+template <typename L, typename R>
+BinaryNode<Multiplies, L, R> operator*(const Expression<L> &lhs, const Expression<R> &rhs) {
+  return BinaryNode<Multiplies, L, R>(lhs.derived(), rhs.derived());
+}
+
+template <typename L, typename R>
+BinaryNode<Divides, L, R> operator/(const Expression<L> &lhs, const Expression<R> &rhs) {
+  return BinaryNode<Divides, L, R>(lhs.derived(), rhs.derived());
+}
+
+/** Evaluate an expression into the signal and error arrays of a workspace
+ *
+ * @param expression :: expression built from ref(), scalar() and + - * /
+ * @param out :: workspace receiving the result. May appear in the expression.
+ * @throw std::invalid_argument if the expression and workspace lengths differ
+ */
+template <typename Expr> void evaluate(const Expression<Expr> &expression, MDHistoWorkspace &out) {
+  const Expr &expr = expression.derived();
+  const size_t length = out.getNPoints();
+  if (expr.length() != 0 && expr.length() != length)
+    throw std::invalid_argument("Cannot evaluate the expression into this MDHistoWorkspace. The "
+                                "length of the signals vector does not match.");
+  signal_t *signals = out.mutableSignalArray();
+  signal_t *errorsSquared = out.mutableErrorSquaredArray();
+  PARALLEL_FOR_IF(length >= 16384)
+  for (int64_t i = 0; i < static_cast<int64_t>(length); ++i) {
+    const Value result = expr(static_cast<size_t>(i));
+    signals[i] = result.signal;
+    errorsSquared[i] = result.errorSquared;
+  }
+}
+
+} // namespace MDHistoExpression
+} // namespace DataObjects
+} // namespace Mantid
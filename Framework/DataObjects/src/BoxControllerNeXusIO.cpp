@@ -13,6 +13,8 @@
 #include "MantidDataObjects/MDEvent.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Exception.h"
+#include "MantidKernel/Logger.h"
+#include "MantidKernel/System.h"
 
 #include <H5Cpp.h>
 #include <Poco/File.h>
@@ -20,7 +22,204 @@
 #include <algorithm>
 #include <string>
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 namespace Mantid::DataObjects {
+namespace {
+Kernel::Logger g_log("BoxControllerNeXusIO");
+}
+
+/** Reads rows of the "event_data" dataset straight from the file.
+ *
+ * The dataset is written chunked and uncompressed, so each chunk is a plain
+ * row-major array at a fixed address in the file. The addresses are looked up
+ * once when the file is opened; afterwards any number of threads can read
+ * blocks with positional reads on a plain file descriptor, directly into the
+ * caller's buffer, without going through the (non thread-safe) NeXus/HDF5
+ * API. After each read the OS is asked to prefetch the next chunk, since
+ * boxes are usually loaded in the order they were written.
+ *
+ * Only used for files opened read-only, as writing may move chunks.
+ */
+class BoxControllerNeXusIO::DirectBlockReader {
+public:
+  /** Look up the chunk addresses of a dataset.
+   * @return nullptr if the dataset is not chunked along rows only, is
+   * filtered, does not hold native floating point data, or the HDF5 library
+   * cannot report chunk addresses
+   */
+  static std::unique_ptr<DirectBlockReader> create(const std::string &fileName, const std::string &datasetPath) {
+#if H5_VERSION_GE(1, 10, 5)
+    std::unique_ptr<DirectBlockReader> reader(new DirectBlockReader());
+    const hid_t file = H5Fopen(fileName.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    if (file < 0)
+      return nullptr;
+    const bool ok = reader->readChunkTable(file, datasetPath);
+    H5Fclose(file);
+    if (!ok || !reader->openDescriptor(fileName))
+      return nullptr;
+    return reader;
+#else
+    UNUSED_ARG(fileName);
+    UNUSED_ARG(datasetPath);
+    return nullptr;
+#endif
+  }
+
+  ~DirectBlockReader() {
+#ifdef _WIN32
+    if (m_handle != INVALID_HANDLE_VALUE)
+      CloseHandle(m_handle);
+#else
+    if (m_fd >= 0)
+      ::close(m_fd);
+#endif
+  }
+
+  /// @return size in bytes of one element of the dataset
+  size_t elementSize() const { return m_elementSize; }
+
+  /** Read whole rows.
+   * @param buffer :: destination, at least nRows * columns elements
+   * @param firstRow :: first row to read
+   * @param nRows :: number of rows
+   * @return false if a chunk is not allocated or the read failed, in which
+   * case the caller should fall back to NeXus
+   */
+  bool read(void *buffer, const uint64_t firstRow, const size_t nRows) const {
+    auto *out = static_cast<char *>(buffer);
+    const uint64_t rowBytes = m_columns * m_elementSize;
+    uint64_t row = firstRow;
+    const uint64_t endRow = firstRow + nRows;
+    while (row < endRow) {
+      const uint64_t chunk = row / m_chunkRows;
+      if (chunk >= m_chunkAddresses.size() || m_chunkAddresses[chunk] == HADDR_UNDEF)
+        return false;
+      const uint64_t rowInChunk = row - chunk * m_chunkRows;
+      const uint64_t rows = std::min(endRow - row, m_chunkRows - rowInChunk);
+      if (!readAt(out, rows * rowBytes, m_chunkAddresses[chunk] + rowInChunk * rowBytes))
+        return false;
+      out += rows * rowBytes;
+      row += rows;
+    }
+    if (nRows > 0)
+      prefetch((endRow - 1) / m_chunkRows + 1);
+    return true;
+  }
+
+private:
+  DirectBlockReader() = default;
+
+#if H5_VERSION_GE(1, 10, 5)
+  bool readChunkTable(const hid_t file, const std::string &datasetPath) {
+    bool ok = false;
+    const hid_t dataset = H5Dopen2(file, datasetPath.c_str(), H5P_DEFAULT);
+    if (dataset < 0)
+      return false;
+    const hid_t plist = H5Dget_create_plist(dataset);
+    const hid_t space = H5Dget_space(dataset);
+    const hid_t type = H5Dget_type(dataset);
+    hsize_t dims[2], chunkDims[2];
+    if (H5Pget_layout(plist) == H5D_CHUNKED && H5Pget_nfilters(plist) == 0 && H5Sget_simple_extent_ndims(space) == 2 &&
+        H5Pget_chunk(plist, 2, chunkDims) == 2 && H5Sget_simple_extent_dims(space, dims, nullptr) == 2 &&
+        chunkDims[1] == dims[1] && (H5Tequal(type, H5T_NATIVE_FLOAT) > 0 || H5Tequal(type, H5T_NATIVE_DOUBLE) > 0)) {
+      m_elementSize = H5Tget_size(type);
+      m_columns = dims[1];
+      m_chunkRows = chunkDims[0];
+      ok = readChunkAddresses(file, dataset, space, dims[0]);
+    }
+    H5Tclose(type);
+    H5Sclose(space);
+    H5Pclose(plist);
+    H5Dclose(dataset);
+    return ok;
+  }
+
+  bool readChunkAddresses(const hid_t file, const hid_t dataset, const hid_t space, const hsize_t nRows) {
+    // Chunk addresses are relative to the end of the user block
+    hsize_t userBlock = 0;
+    const hid_t filePlist = H5Fget_create_plist(file);
+    H5Pget_userblock(filePlist, &userBlock);
+    H5Pclose(filePlist);
+
+    hsize_t nChunks = 0;
+    if (H5Dget_num_chunks(dataset, space, &nChunks) < 0)
+      return false;
+    m_chunkAddresses.assign((nRows + m_chunkRows - 1) / m_chunkRows, HADDR_UNDEF);
+    for (hsize_t i = 0; i < nChunks; ++i) {
+      hsize_t offset[2];
+      unsigned filterMask = 0;
+      haddr_t address = HADDR_UNDEF;
+      hsize_t size = 0;
+      if (H5Dget_chunk_info(dataset, space, i, offset, &filterMask, &address, &size) < 0)
+        return false;
+      const auto chunk = static_cast<size_t>(offset[0] / m_chunkRows);
+      if (chunk < m_chunkAddresses.size() && size == m_chunkRows * m_columns * m_elementSize)
+        m_chunkAddresses[chunk] = address + userBlock;
+    }
+    return true;
+  }
+#endif
+
+  bool openDescriptor(const std::string &fileName) {
+#ifdef _WIN32
+    m_handle = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+                           FILE_ATTRIBUTE_NORMAL, nullptr);
+    return m_handle != INVALID_HANDLE_VALUE;
+#else
+    m_fd = ::open(fileName.c_str(), O_RDONLY);
+    return m_fd >= 0;
+#endif
+  }
+
+  bool readAt(char *out, uint64_t bytes, uint64_t position) const {
+    while (bytes > 0) {
+#ifdef _WIN32
+      OVERLAPPED overlapped{};
+      overlapped.Offset = static_cast<DWORD>(position & 0xFFFFFFFF);
+      overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+      DWORD toRead = static_cast<DWORD>(std::min<uint64_t>(bytes, 1u << 30));
+      DWORD got = 0;
+      if (!ReadFile(m_handle, out, toRead, &got, &overlapped) || got == 0)
+        return false;
+#else
+      const ssize_t got = ::pread(m_fd, out, static_cast<size_t>(bytes), static_cast<off_t>(position));
+      if (got <= 0)
+        return false;
+#endif
+      out += got;
+      bytes -= static_cast<uint64_t>(got);
+      position += static_cast<uint64_t>(got);
+    }
+    return true;
+  }
+
+  void prefetch(const uint64_t chunk) const {
+#if defined(POSIX_FADV_WILLNEED)
+    if (chunk < m_chunkAddresses.size() && m_chunkAddresses[chunk] != HADDR_UNDEF)
+      posix_fadvise(m_fd, static_cast<off_t>(m_chunkAddresses[chunk]),
+                    static_cast<off_t>(m_chunkRows * m_columns * m_elementSize), POSIX_FADV_WILLNEED);
+#else
+    UNUSED_ARG(chunk);
+#endif
+  }
+
+  size_t m_elementSize{0};
+  uint64_t m_columns{0};
+  uint64_t m_chunkRows{1};
+  /// File offset of each chunk of rows, HADDR_UNDEF if not allocated
+  std::vector<haddr_t> m_chunkAddresses;
+#ifdef _WIN32
+  HANDLE m_handle{INVALID_HANDLE_VALUE};
+#else
+  int m_fd{-1};
+#endif
+};
 // Default headers(attributes) describing the contents of the data, written by
 // this class
 const char *EventHeaders[] = {"signal, errorSquared, center (each dim.)",
@@ -158,9 +357,12 @@ bool BoxControllerNeXusIO::openFile(const std::string &fileName, const std::stri
   // DiskBuffer information;
   getDiskBufferFileData();
 
-  if (m_ReadOnly)
+  if (m_ReadOnly) {
     prepareNxSdata_CurVersion();
-  else
+    m_directReader = DirectBlockReader::create(m_fileName, "/MDEventWorkspace/" + g_EventGroupName + "/event_data");
+    if (!m_directReader)
+      g_log.debug() << "Events in " << m_fileName << " will be read through NeXus\n";
+  } else
     prepareNxSToWrite_CurVersion();
 
   return true;
@@ -514,10 +716,14 @@ void BoxControllerNeXusIO::loadGenericBlock(std::vector<Type> &Block, const uint
   size[0] = static_cast<int64_t>(nPoints);
   size[1] = dataEventCount(); // data item count per event in the Nexus file
 
-  std::lock_guard<std::mutex> _lock(m_fileMutex);
-
   Block.resize(size[0] * size[1]);
-  m_File->getSlab(&Block[0], start, size);
+  // Lock-free path for read-only files; falls back to NeXus e.g. for chunks
+  // that were never written
+  if (!m_directReader || m_directReader->elementSize() != sizeof(Type) ||
+      !m_directReader->read(Block.data(), blockPosition, nPoints)) {
+    std::lock_guard<std::mutex> _lock(m_fileMutex);
+    m_File->getSlab(&Block[0], start, size);
+  }
 
   adjustEventDataBlock(Block, "READ"); // insert goniometer info if necessary
 }
@@ -584,6 +790,7 @@ void BoxControllerNeXusIO::closeFile() {
     this->flushCache();
     // lock file
     std::lock_guard<std::mutex> _lock(m_fileMutex);
+    m_directReader.reset();
 
     m_File->closeData(); // close events data
     if (!m_ReadOnly)     // write free space groups from the disk buffer
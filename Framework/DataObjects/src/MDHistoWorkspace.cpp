@@ -13,6 +13,7 @@
 #include "MantidGeometry/MDGeometry/MDDimensionExtents.h"
 #include "MantidGeometry/MDGeometry/MDGeometryXMLBuilder.h"
 #include "MantidGeometry/MDGeometry/MDHistoDimension.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Utils.h"
 #include "MantidKernel/VMD.h"
 #include "MantidKernel/WarningSuppressions.h"
@@ -27,6 +28,11 @@ using namespace Mantid::Kernel;
 using namespace Mantid::Geometry;
 using namespace Mantid::API;
 
+namespace {
+/// Element-wise kernels over fewer bins than this are not worth spawning threads for
+constexpr size_t MIN_LENGTH_PARALLEL_KERNEL{16384};
+} // namespace
+
 namespace Mantid::DataObjects {
 //----------------------------------------------------------------------------------------------
 /** Constructor given the 4 dimensions
@@ -701,7 +707,8 @@ MDHistoWorkspace &MDHistoWorkspace::operator+=(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::add(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "add");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] += b.m_signals[i];
     m_errorsSquared[i] += b.m_errorsSquared[i];
     m_numEvents[i] += b.m_numEvents[i];
@@ -717,7 +724,8 @@ void MDHistoWorkspace::add(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::add(const signal_t signal, const signal_t error) {
   signal_t errorSquared = error * error;
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] += signal;
     m_errorsSquared[i] += errorSquared;
   }
@@ -740,7 +748,8 @@ MDHistoWorkspace &MDHistoWorkspace::operator-=(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::subtract(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "subtract");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] -= b.m_signals[i];
     m_errorsSquared[i] += b.m_errorsSquared[i];
     m_numEvents[i] += b.m_numEvents[i];
@@ -756,7 +765,8 @@ void MDHistoWorkspace::subtract(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::subtract(const signal_t signal, const signal_t error) {
   signal_t errorSquared = error * error;
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] -= signal;
     m_errorsSquared[i] += errorSquared;
   }
@@ -788,7 +798,8 @@ MDHistoWorkspace &MDHistoWorkspace::operator*=(const MDHistoWorkspace &b_ws) {
  * */
 void MDHistoWorkspace::multiply(const MDHistoWorkspace &b_ws) {
   checkWorkspaceSize(b_ws, "multiply");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
 
@@ -819,7 +830,8 @@ void MDHistoWorkspace::multiply(const signal_t signal, const signal_t error) {
   signal_t b = signal;
   signal_t db2 = error * error;
 
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
 
@@ -857,7 +869,8 @@ MDHistoWorkspace &MDHistoWorkspace::operator/=(const MDHistoWorkspace &b_ws) {
  **/
 void MDHistoWorkspace::divide(const MDHistoWorkspace &b_ws) {
   checkWorkspaceSize(b_ws, "divide");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
 
@@ -888,7 +901,8 @@ void MDHistoWorkspace::divide(const signal_t signal, const signal_t error) {
   signal_t b = signal;
   signal_t db2 = error * error;
   signal_t db2_relative = db2 / (b * b);
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
 
@@ -907,7 +921,8 @@ void MDHistoWorkspace::divide(const signal_t signal, const signal_t error) {
  * \f$ df^2 = a^2 / da^2 \f$
  */
 void MDHistoWorkspace::log(double filler) {
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
     if (a <= 0) {
@@ -927,7 +942,8 @@ void MDHistoWorkspace::log(double filler) {
  * \f$ df^2 = (ln(10)^-2) * a^2 / da^2 \f$
  */
 void MDHistoWorkspace::log10(double filler) {
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
     if (a <= 0) {
@@ -947,7 +963,8 @@ void MDHistoWorkspace::log10(double filler) {
  * \f$ df^2 = f^2 * da^2 \f$
  */
 void MDHistoWorkspace::exp() {
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     signal_t f = std::exp(m_signals[i]);
     signal_t da2 = m_errorsSquared[i];
     m_signals[i] = f;
@@ -964,7 +981,8 @@ void MDHistoWorkspace::exp() {
  */
 void MDHistoWorkspace::power(double exponent) {
   double exponent_squared = exponent * exponent;
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     signal_t a = m_signals[i];
     signal_t f = std::pow(a, exponent);
     signal_t da2 = m_errorsSquared[i];
@@ -989,7 +1007,8 @@ void MDHistoWorkspace::power(double exponent) {
  * @return *this after operation */
 MDHistoWorkspace &MDHistoWorkspace::operator&=(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "&= (and)");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] = ((m_signals[i] != 0 && !m_masks[i]) && (b.m_signals[i] != 0 && !b.m_masks[i])) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
   }
@@ -1006,7 +1025,8 @@ MDHistoWorkspace &MDHistoWorkspace::operator&=(const MDHistoWorkspace &b) {
  * @return *this after operation */
 MDHistoWorkspace &MDHistoWorkspace::operator|=(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "|= (or)");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] = ((m_signals[i] != 0 && !m_masks[i]) || (b.m_signals[i] != 0 && !b.m_masks[i])) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
   }
@@ -1023,7 +1043,8 @@ MDHistoWorkspace &MDHistoWorkspace::operator|=(const MDHistoWorkspace &b) {
  * @return *this after operation */
 MDHistoWorkspace &MDHistoWorkspace::operator^=(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "^= (xor)");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] = ((m_signals[i] != 0 && !m_masks[i]) ^ (b.m_signals[i] != 0 && !b.m_masks[i])) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
   }
@@ -1037,7 +1058,8 @@ MDHistoWorkspace &MDHistoWorkspace::operator^=(const MDHistoWorkspace &b) {
  * 0.0 is "false", all other values are "true". All errors are set to 0.
  */
 void MDHistoWorkspace::operatorNot() {
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] = (m_signals[i] == 0.0 || m_masks[i]) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0.0;
   }
@@ -1053,7 +1075,8 @@ void MDHistoWorkspace::operatorNot() {
  */
 void MDHistoWorkspace::lessThan(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "lessThan");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] = (m_signals[i] < b.m_signals[i]) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0.0;
   }
@@ -1068,7 +1091,8 @@ void MDHistoWorkspace::lessThan(const MDHistoWorkspace &b) {
  * @param signal :: signal value on the RHS of the comparison.
  */
 void MDHistoWorkspace::lessThan(const signal_t signal) {
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] = (m_signals[i] < signal) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0.0;
   }
@@ -1084,7 +1108,8 @@ void MDHistoWorkspace::lessThan(const signal_t signal) {
  */
 void MDHistoWorkspace::greaterThan(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "greaterThan");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] = (m_signals[i] > b.m_signals[i]) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
   }
@@ -1099,7 +1124,8 @@ void MDHistoWorkspace::greaterThan(const MDHistoWorkspace &b) {
  * @param signal :: signal value on the RHS of the comparison.
  */
 void MDHistoWorkspace::greaterThan(const signal_t signal) {
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] = (m_signals[i] > signal) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
   }
@@ -1116,7 +1142,8 @@ void MDHistoWorkspace::greaterThan(const signal_t signal) {
  */
 void MDHistoWorkspace::equalTo(const MDHistoWorkspace &b, const signal_t tolerance) {
   checkWorkspaceSize(b, "equalTo");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     signal_t diff = fabs(m_signals[i] - b.m_signals[i]);
     m_signals[i] = (diff < tolerance) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
@@ -1133,7 +1160,8 @@ void MDHistoWorkspace::equalTo(const MDHistoWorkspace &b, const signal_t toleran
  * @param tolerance :: accept this deviation from a perfect equality
  */
 void MDHistoWorkspace::equalTo(const signal_t signal, const signal_t tolerance) {
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     signal_t diff = fabs(m_signals[i] - signal);
     m_signals[i] = (diff < tolerance) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
@@ -1159,7 +1187,8 @@ void MDHistoWorkspace::equalTo(const signal_t signal, const signal_t tolerance)
 void MDHistoWorkspace::setUsingMask(const MDHistoWorkspace &mask, const MDHistoWorkspace &values) {
   checkWorkspaceSize(mask, "setUsingMask");
   checkWorkspaceSize(values, "setUsingMask");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     if (mask.m_signals[i] != 0.0) {
       m_signals[i] = values.m_signals[i];
       m_errorsSquared[i] = values.m_errorsSquared[i];
@@ -1187,7 +1216,8 @@ void MDHistoWorkspace::setUsingMask(const MDHistoWorkspace &mask, const MDHistoW
 void MDHistoWorkspace::setUsingMask(const MDHistoWorkspace &mask, const signal_t signal, const signal_t error) {
   signal_t errorSquared = error * error;
   checkWorkspaceSize(mask, "setUsingMask");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length >= MIN_LENGTH_PARALLEL_KERNEL)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     if (mask.m_signals[i] != 0.0) {
       m_signals[i] = signal;
       m_errorsSquared[i] = errorSquared;
@@ -9,12 +9,14 @@
 #include "MantidAPI/FileFinder.h"
 #include "MantidDataObjects/BoxControllerNeXusIO.h"
 #include "MantidFrameworkTestHelpers/MDEventsTestHelper.h"
+#include "MantidKernel/Exception.h"
 
 #include <map>
 #include <memory>
 
 #include <cxxtest/TestSuite.h>
 
+#include <H5Cpp.h>
 #include <nexus/NeXusFile.hpp>
 
 #include <Poco/File.h>
@@ -256,6 +258,45 @@ public:
 
   void test_WriteFloatReadDouble() { this->WriteReadRead<float, double>(); }
 
+  void test_read_only_file_is_read_directly_across_chunks() {
+    auto pSaver = createTestBoxController();
+    pSaver->setDataType(sizeof(float), "MDEvent");
+    TS_ASSERT_THROWS_NOTHING(pSaver->openFile(this->xxfFileName, "w"));
+    TS_ASSERT(!pSaver->usesDirectReads());
+    const std::string fullPathFile = pSaver->getFileName();
+
+    // more events than fit in two NeXus chunks
+    const size_t nEvents = 2 * pSaver->getDataChunk() + 500;
+    const auto nColumns = static_cast<size_t>(pSaver->getNDataColums());
+    std::vector<float> toWrite(nColumns * nEvents);
+    for (size_t i = 0; i < toWrite.size(); i++)
+      toWrite[i] = static_cast<float>(i % 100000);
+    TS_ASSERT_THROWS_NOTHING(pSaver->saveBlock(toWrite, 0));
+    pSaver->closeFile();
+
+    TS_ASSERT_THROWS_NOTHING(pSaver->openFile(fullPathFile, "r"));
+#if H5_VERSION_GE(1, 10, 5)
+    TS_ASSERT(pSaver->usesDirectReads());
+#endif
+    const size_t start = pSaver->getDataChunk() - 10;
+    const size_t nRead = pSaver->getDataChunk() + 20;
+    std::vector<float> toRead;
+    TS_ASSERT_THROWS_NOTHING(pSaver->loadBlock(toRead, start, nRead));
+    TS_ASSERT_EQUALS(toRead.size(), nRead * nColumns);
+    for (size_t i = 0; i < toRead.size(); i++) {
+      if (toRead[i] != toWrite[start * nColumns + i]) {
+        TS_FAIL("Mismatch at element " + std::to_string(i));
+        break;
+      }
+    }
+    TS_ASSERT_THROWS(pSaver->loadBlock(toRead, nEvents - 1, 2), const Mantid::Kernel::Exception::FileError &);
+
+    pSaver->closeFile();
+    TS_ASSERT(!pSaver->usesDirectReads());
+    if (Poco::File(fullPathFile).exists())
+      Poco::File(fullPathFile).remove();
+  }
+
   void test_dataEventCount() {
     using Mantid::DataObjects::BoxControllerNeXusIO;
     using EDV = BoxControllerNeXusIO::EventDataVersion;
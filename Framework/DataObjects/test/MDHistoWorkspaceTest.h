@@ -11,6 +11,7 @@
 #include "MantidAPI/IMDWorkspace.h"
 #include "MantidAPI/Sample.h"
 #include "MantidDataObjects/MDHistoWorkspace.h"
+#include "MantidDataObjects/MDHistoWorkspaceExpression.h"
 #include "MantidDataObjects/MDHistoWorkspaceIterator.h"
 #include "MantidDataObjects/WorkspaceSingleValue.h"
 #include "MantidFrameworkTestHelpers/MDEventsTestHelper.h"
@@ -776,6 +777,42 @@ public:
     checkWorkspace(a, 1.5, 1.5 * 1.5 * (.5 + 1. / 3.), 1.0);
   }
 
+  //--------------------------------------------------------------------------------------
+  void test_fused_expression_matches_chained_operators() {
+    using namespace MDHistoExpression;
+    MDHistoWorkspace_sptr a = MDEventsTestHelper::makeFakeMDHistoWorkspace(5.0, 2, 5, 10.0, 3.0 /*errorSquared*/);
+    MDHistoWorkspace_sptr b = MDEventsTestHelper::makeFakeMDHistoWorkspace(1.0, 2, 5, 10.0, 1.0 /*errorSquared*/);
+    MDHistoWorkspace_sptr c = MDEventsTestHelper::makeFakeMDHistoWorkspace(2.0, 2, 5, 10.0, 2.0 /*errorSquared*/);
+
+    MDHistoWorkspace_sptr chained(a->clone());
+    *chained -= *b;
+    *chained /= *c;
+    chained->multiply(3.0, 0.5);
+
+    MDHistoWorkspace_sptr fused(a->clone());
+    evaluate((ref(*a) - ref(*b)) / ref(*c) * scalar(3.0, 0.5), *fused);
+
+    for (size_t i = 0; i < fused->getNPoints(); i++) {
+      TS_ASSERT_DELTA(fused->getSignalAt(i), chained->getSignalAt(i), 1e-10);
+      TS_ASSERT_DELTA(fused->getErrorAt(i), chained->getErrorAt(i), 1e-10);
+    }
+    // (5 - 1) / 2 * 3
+    TS_ASSERT_DELTA(fused->getSignalAt(0), 6.0, 1e-10);
+  }
+
+  //--------------------------------------------------------------------------------------
+  void test_fused_expression_in_place_and_size_mismatch() {
+    using namespace MDHistoExpression;
+    MDHistoWorkspace_sptr a = MDEventsTestHelper::makeFakeMDHistoWorkspace(2.0, 2, 5, 10.0, 2.0 /*errorSquared*/);
+    MDHistoWorkspace_sptr b = MDEventsTestHelper::makeFakeMDHistoWorkspace(3.0, 2, 5, 10.0, 3.0 /*errorSquared*/);
+    evaluate(ref(*a) + ref(*b), *a);
+    checkWorkspace(a, 5.0, 5.0, 1.0);
+
+    MDHistoWorkspace_sptr small = MDEventsTestHelper::makeFakeMDHistoWorkspace(1.0, 2, 4);
+    TS_ASSERT_THROWS(ref(*a) + ref(*small), const std::invalid_argument &);
+    TS_ASSERT_THROWS(evaluate(ref(*a) * scalar(2.0), *small), const std::invalid_argument &);
+  }
+
   //--------------------------------------------------------------------------------------
   void test_exp() {
     MDHistoWorkspace_sptr a = MDEventsTestHelper::makeFakeMDHistoWorkspace(2.0, 2, 5, 10.0, 3.0);
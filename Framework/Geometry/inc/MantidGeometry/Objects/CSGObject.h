@@ -11,6 +11,7 @@
 //----------------------------------------------------------------------
 #include "MantidGeometry/DllConfig.h"
 #include "MantidGeometry/Objects/BoundingBox.h"
+#include "MantidGeometry/Objects/CompiledRule.h"
 #include "MantidGeometry/Objects/IObject.h"
 #include "MantidGeometry/Objects/Track.h"
 #include "MantidGeometry/Rendering/ShapeInfo.h"
@@ -202,6 +203,8 @@ private:
   double singleShotMonteCarloVolume(const int shotSize, const size_t seed) const;
   /// Top rule [ Geometric scope of object]
   std::unique_ptr<Rule> m_topRule;
+  /// m_topRule compiled for isValid, rebuilt with the surface list
+  CompiledRule m_compiledRule;
   /// Object's bounding box
   BoundingBox m_boundingBox;
   // -- DEPRECATED --
@@ -0,0 +1,74 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/DllConfig.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+class V3D;
+}
+namespace Geometry {
+class Rule;
+class Surface;
+
+/** CompiledRule : a Rule tree flattened into a program that decides whether a
+  point is valid from the sides of the surfaces it lies on.
+
+  Each distinct surface is asked for the side of the point once. Each distinct
+  (surface, sign) pair of the tree is a literal whose value is one bit of a
+  word, and the tree becomes a postfix program over those bits evaluated on a
+  bit stack. When there are few literals the program is run for every
+  combination of them up front, and a point is tested with one lookup in the
+  resulting truth table.
+
+  Trees that refer to other objects (CompObj) are not compiled: isCompiled()
+  is false and the tree must be used instead.
+*/
+class MANTID_GEOMETRY_DLL CompiledRule {
+public:
+  CompiledRule() = default;
+  explicit CompiledRule(const Rule *topRule);
+
+  /// @return true if the rule could be compiled
+  bool isCompiled() const { return m_compiled; }
+  bool isValid(const Kernel::V3D &point) const;
+
+private:
+  enum class OpCode : uint8_t { Literal, True, False, And, Or, Not };
+  struct Instruction {
+    OpCode code;
+    /// Bit of the literal pushed by a Literal instruction
+    uint8_t literal;
+  };
+  /// A surface and the sign its side is multiplied by
+  struct Literal {
+    size_t surface;
+    int sign;
+  };
+
+  bool compile(const Rule *rule, size_t depth);
+  size_t addLiteral(const Surface *surface, int sign);
+  bool evaluate(uint64_t literals) const;
+
+  bool m_compiled = false;
+  std::vector<const Surface *> m_surfaces;
+  std::vector<Literal> m_literals;
+  std::vector<Instruction> m_program;
+  /// Result of the program for every combination of literals, if there are
+  /// no more than MAX_TABLE_LITERALS
+  std::array<uint64_t, 4> m_truthTable{};
+  bool m_useTruthTable = false;
+};
+
+} // namespace Geometry
+} // namespace Mantid
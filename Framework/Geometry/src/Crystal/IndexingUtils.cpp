@@ -7,6 +7,7 @@
 #include "MantidGeometry/Crystal/IndexingUtils.h"
 #include "MantidGeometry/Crystal/NiggliCell.h"
 #include "MantidKernel/EigenConversionHelpers.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Quat.h"
 
 #include <boost/math/special_functions/round.hpp>
@@ -31,6 +32,81 @@ using Mantid::Kernel::V3D;
 namespace {
 const constexpr double DEG_TO_RAD = M_PI / 180.;
 const constexpr double RAD_TO_DEG = 180. / M_PI;
+
+/// The q_vectors divided by 2 pi, stored component by component so that
+/// projecting all of them onto a direction can use vector instructions.
+struct ScaledQComponents {
+  explicit ScaledQComponents(const std::vector<V3D> &q_vectors) {
+    x.reserve(q_vectors.size());
+    y.reserve(q_vectors.size());
+    z.reserve(q_vectors.size());
+    for (const auto &q_vector : q_vectors) {
+      const V3D q_vec = q_vector / (2.0 * M_PI);
+      x.emplace_back(q_vec.X());
+      y.emplace_back(q_vec.Y());
+      z.emplace_back(q_vec.Z());
+    }
+  }
+  std::vector<double> x;
+  std::vector<double> y;
+  std::vector<double> z;
+};
+
+/**
+  Histogram the projections of the q_vectors on a direction into the N
+  entries of projections[], as IndexingUtils::GetMagFFT does. The projections
+  are calculated in a separate loop to the histogram, so that loop vectorizes.
+  @param q_components  The q_vectors divided by 2 pi.
+  @param current_dir   The direction the Q vectors will be projected on.
+  @param N             The size of the projections[] array.
+  @param index_factor  Factor that maps a projection to an index.
+  @param indices       Work array, resized to hold one index per Q vector.
+  @param projections   Array filled with the histogram.
+ */
+void histogramProjections(const ScaledQComponents &q_components, const V3D &current_dir, const size_t N,
+                          const double index_factor, std::vector<double> &indices, double projections[]) {
+  const size_t num_q = q_components.x.size();
+  indices.resize(num_q);
+  const double dir_x = current_dir.X();
+  const double dir_y = current_dir.Y();
+  const double dir_z = current_dir.Z();
+  const double *x = q_components.x.data();
+  const double *y = q_components.y.data();
+  const double *z = q_components.z.data();
+  double *index = indices.data();
+  for (size_t i = 0; i < num_q; i++)
+    index[i] = fabs(index_factor * (dir_x * x[i] + dir_y * y[i] + dir_z * z[i]));
+
+  std::fill(projections, projections + N, 0.0);
+  for (size_t i = 0; i < num_q; i++) {
+    const auto bin = static_cast<size_t>(index[i]);
+    // bin >= N should not happen, but trap it in case of rounding errors.
+    projections[std::min(bin, N - 1)] += 1;
+  }
+}
+
+/**
+  Replace the N values in projections[] by their FFT, and fill magnitude_fft[]
+  with its magnitude.
+  @return The largest value in the magnitude_fft, that is stored in position
+          5 or more.
+ */
+double magnitudeFFT(const size_t N, double projections[], double magnitude_fft[]) {
+  gsl_fft_real_radix2_transform(projections, 1, N);
+  for (size_t i = 1; i < N / 2; i++) {
+    magnitude_fft[i] = sqrt(projections[i] * projections[i] + projections[N - i] * projections[N - i]);
+  }
+
+  magnitude_fft[0] = fabs(projections[0]);
+
+  size_t dc_end = 5; // we may need a better estimate of this
+  double max_mag_fft = 0.0;
+  for (size_t i = dc_end; i < N / 2; i++)
+    if (magnitude_fft[i] > max_mag_fft)
+      max_mag_fft = magnitude_fft[i];
+
+  return max_mag_fft;
+}
 } // namespace
 
 /**
@@ -1443,11 +1519,20 @@ size_t IndexingUtils::FFTScanFor_Directions(std::vector<V3D> &directions, const
 
   double index_factor = N_FFT_STEPS / max_mag_Q; // maps |proj Q| to index
 
-  for (size_t dir_num = 0; dir_num < full_list.size(); dir_num++) {
-    V3D current_dir = full_list[dir_num];
-    max_mag_fft = GetMagFFT(q_vectors, current_dir, N_FFT_STEPS, projections, index_factor, magnitude_fft);
-
-    max_fft_val[dir_num] = max_mag_fft;
+  // the directions are independent, so are split between threads which each
+  // have their own FFT work arrays
+  const ScaledQComponents q_components(q_vectors);
+  PRAGMA_OMP(parallel) {
+    std::vector<double> indices;
+    std::vector<double> thread_projections(N_FFT_STEPS);
+    std::vector<double> thread_magnitude_fft(HALF_FFT_STEPS);
+    PRAGMA_OMP(for)
+    for (int64_t i = 0; i < static_cast<int64_t>(full_list.size()); i++) {
+      const auto dir_num = static_cast<size_t>(i);
+      histogramProjections(q_components, full_list[dir_num], N_FFT_STEPS, index_factor, indices,
+                           thread_projections.data());
+      max_fft_val[dir_num] = magnitudeFFT(N_FFT_STEPS, thread_projections.data(), thread_magnitude_fft.data());
+    }
   }
   // find the directions with the 500 largest
   // fft values, and place them in temp_dirs vector
@@ -1609,20 +1694,7 @@ double IndexingUtils::GetMagFFT(const std::vector<V3D> &q_vectors, const V3D &cu
   }                            // case of rounding errors.
 
   // get the |FFT|
-  gsl_fft_real_radix2_transform(projections, 1, N);
-  for (size_t i = 1; i < N / 2; i++) {
-    magnitude_fft[i] = sqrt(projections[i] * projections[i] + projections[N - i] * projections[N - i]);
-  }
-
-  magnitude_fft[0] = fabs(projections[0]);
-
-  size_t dc_end = 5; // we may need a better estimate of this
-  double max_mag_fft = 0.0;
-  for (size_t i = dc_end; i < N / 2; i++)
-    if (magnitude_fft[i] > max_mag_fft)
-      max_mag_fft = magnitude_fft[i];
-
-  return max_mag_fft;
+  return magnitudeFFT(N, projections, magnitude_fft);
 }
 
 /**
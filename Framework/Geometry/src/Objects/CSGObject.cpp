@@ -783,6 +783,8 @@ int CSGObject::checkSurfaceValid(const Kernel::V3D &point, const Kernel::V3D &di
 bool CSGObject::isValid(const Kernel::V3D &point) const {
   if (!m_topRule)
     return false;
+  if (m_compiledRule.isCompiled())
+    return m_compiledRule.isValid(point);
   return m_topRule->isValid(point);
 }
 
@@ -836,6 +838,7 @@ int CSGObject::createSurfaceList(const int outFlag) {
     };
   });
   m_surList.erase(newEnd, m_surList.end());
+  m_compiledRule = CompiledRule(m_topRule.get());
 
   if (outFlag) {
 
@@ -936,6 +939,7 @@ void CSGObject::print() const {
 void CSGObject::makeComplement() {
   std::unique_ptr<Rule> NCG = procComp(std::move(m_topRule));
   m_topRule = std::move(NCG);
+  m_compiledRule = CompiledRule();
 }
 
 /**
@@ -992,6 +996,7 @@ void CSGObject::write(std::ostream &outStream) const {
  */
 int CSGObject::procString(const std::string &lineStr) {
   m_topRule = nullptr;
+  m_compiledRule = CompiledRule();
   std::map<int, std::unique_ptr<Rule>> RuleList; // List for the rules
   int Ridx = 0;                                  // Current index (not necessary size of RuleList
   // SURFACE REPLACEMENT
@@ -0,0 +1,176 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidGeometry/Objects/CompiledRule.h"
+#include "MantidGeometry/Objects/Rules.h"
+#include "MantidGeometry/Surfaces/Surface.h"
+#include "MantidKernel/V3D.h"
+
+#include <algorithm>
+
+namespace Mantid::Geometry {
+
+namespace {
+/// Rules with up to this many literals are evaluated with a truth table
+constexpr size_t MAX_TABLE_LITERALS = 8;
+/// Literals are bits of a 64 bit word
+constexpr size_t MAX_LITERALS = 64;
+/// The evaluation stack is a 64 bit word
+constexpr size_t MAX_STACK_DEPTH = 64;
+} // namespace
+
+/**
+ * Compile a rule tree
+ * @param topRule :: the rule tree, which may be null
+ */
+CompiledRule::CompiledRule(const Rule *topRule) {
+  if (!topRule || !compile(topRule, 1)) {
+    m_surfaces.clear();
+    m_literals.clear();
+    m_program.clear();
+    return;
+  }
+  m_compiled = true;
+
+  if (m_literals.size() <= MAX_TABLE_LITERALS) {
+    const uint64_t numCombinations = uint64_t(1) << m_literals.size();
+    for (uint64_t literals = 0; literals < numCombinations; ++literals) {
+      if (evaluate(literals))
+        m_truthTable[literals / 64] |= uint64_t(1) << (literals % 64);
+    }
+    m_useTruthTable = true;
+  }
+}
+
+/**
+ * Determines if a point is valid, with the same result as Rule::isValid on
+ * the tree that was compiled
+ * @param point :: Point to test
+ * @returns true if the point is within the object or on its surface
+ */
+bool CompiledRule::isValid(const Kernel::V3D &point) const {
+  if (!m_compiled)
+    return false;
+
+  std::array<int, MAX_LITERALS> sides;
+  for (size_t i = 0; i < m_surfaces.size(); ++i)
+    sides[i] = m_surfaces[i]->side(point);
+  uint64_t literals = 0;
+  for (size_t i = 0; i < m_literals.size(); ++i) {
+    const auto &literal = m_literals[i];
+    literals |= uint64_t(sides[literal.surface] * literal.sign >= 0) << i;
+  }
+
+  if (m_useTruthTable)
+    return (m_truthTable[literals / 64] >> (literals % 64)) & 1;
+  return evaluate(literals);
+}
+
+/**
+ * Append the postfix program for a rule
+ * @param rule :: the rule to compile
+ * @param depth :: the depth of the stack once the rule's value is pushed
+ * @return false if the rule cannot be compiled
+ */
+bool CompiledRule::compile(const Rule *rule, const size_t depth) {
+  if (depth > MAX_STACK_DEPTH)
+    return false;
+
+  if (const auto *surfPoint = dynamic_cast<const SurfPoint *>(rule)) {
+    if (!surfPoint->getKey()) {
+      m_program.push_back({OpCode::False, 0});
+      return true;
+    }
+    const auto literal = addLiteral(surfPoint->getKey(), surfPoint->getSign());
+    if (literal >= MAX_LITERALS)
+      return false;
+    m_program.push_back({OpCode::Literal, static_cast<uint8_t>(literal)});
+  } else if (dynamic_cast<const Intersection *>(rule) || dynamic_cast<const Union *>(rule)) {
+    const bool isIntersection = dynamic_cast<const Intersection *>(rule) != nullptr;
+    const Rule *ruleA = rule->leaf(0);
+    const Rule *ruleB = rule->leaf(1);
+    // as Intersection::isValid and Union::isValid treat missing leaves
+    if (ruleA && ruleB) {
+      if (!compile(ruleA, depth) || !compile(ruleB, depth + 1))
+        return false;
+      m_program.push_back({isIntersection ? OpCode::And : OpCode::Or, 0});
+    } else if (!isIntersection && (ruleA || ruleB)) {
+      return compile(ruleA ? ruleA : ruleB, depth);
+    } else {
+      m_program.push_back({OpCode::False, 0});
+    }
+  } else if (dynamic_cast<const CompGrp *>(rule)) {
+    const Rule *ruleA = rule->leaf(0);
+    if (!ruleA) {
+      m_program.push_back({OpCode::True, 0});
+      return true;
+    }
+    if (!compile(ruleA, depth))
+      return false;
+    m_program.push_back({OpCode::Not, 0});
+  } else if (dynamic_cast<const BoolValue *>(rule)) {
+    // a BoolValue does not depend on the point
+    m_program.push_back({rule->isValid(Kernel::V3D()) ? OpCode::True : OpCode::False, 0});
+  } else {
+    // CompObj depends on another object
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Find or add the literal for a surface and sign
+ * @param surface :: the surface
+ * @param sign :: the sign of the SurfPoint
+ * @return the bit of the literal
+ */
+size_t CompiledRule::addLiteral(const Surface *surface, const int sign) {
+  const auto surfaceIt = std::find(m_surfaces.cbegin(), m_surfaces.cend(), surface);
+  const auto surfaceIndex = static_cast<size_t>(surfaceIt - m_surfaces.cbegin());
+  if (surfaceIt == m_surfaces.cend())
+    m_surfaces.emplace_back(surface);
+  const auto literalIt = std::find_if(m_literals.cbegin(), m_literals.cend(), [&](const Literal &literal) {
+    return literal.surface == surfaceIndex && literal.sign == sign;
+  });
+  const auto literalIndex = static_cast<size_t>(literalIt - m_literals.cbegin());
+  if (literalIt == m_literals.cend())
+    m_literals.push_back({surfaceIndex, sign});
+  return literalIndex;
+}
+
+/**
+ * Run the program, with the top of the stack in the lowest bit of a word
+ * @param literals :: the value of each literal, one bit each
+ * @return the value of the rule
+ */
+bool CompiledRule::evaluate(const uint64_t literals) const {
+  uint64_t stack = 0;
+  for (const auto &instruction : m_program) {
+    switch (instruction.code) {
+    case OpCode::Literal:
+      stack = (stack << 1) | ((literals >> instruction.literal) & 1);
+      break;
+    case OpCode::True:
+      stack = (stack << 1) | 1;
+      break;
+    case OpCode::False:
+      stack <<= 1;
+      break;
+    case OpCode::And:
+      stack = ((stack >> 2) << 1) | ((stack >> 1) & stack & 1);
+      break;
+    case OpCode::Or:
+      stack = ((stack >> 2) << 1) | (((stack >> 1) | stack) & 1);
+      break;
+    case OpCode::Not:
+      stack ^= 1;
+      break;
+    }
+  }
+  return stack & 1;
+}
+
+} // namespace Mantid::Geometry
@@ -0,0 +1,112 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/Objects/CompiledRule.h"
+
+#include "MantidFrameworkTestHelpers/ComponentCreationHelper.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/Rules.h"
+#include "MantidGeometry/Surfaces/Plane.h"
+#include "MantidKernel/V3D.h"
+
+#include <cxxtest/TestSuite.h>
+
+#include <cmath>
+
+using Mantid::Geometry::CompiledRule;
+using Mantid::Kernel::V3D;
+using namespace Mantid::Geometry;
+
+namespace {
+/// The inside of a prism whose cross section is a regular polygon with a
+/// face at unit distance from the axis for each plane
+std::unique_ptr<Rule> createPrism(const int numPlanes, const V3D &centre) {
+  std::unique_ptr<Rule> prism;
+  for (int i = 0; i < numPlanes; ++i) {
+    const double angle = 2. * M_PI * i / numPlanes;
+    const V3D normal(std::cos(angle), std::sin(angle), 0.);
+    auto plane = std::make_shared<Plane>();
+    plane->setPlane(centre + normal, normal);
+    auto face = std::make_unique<SurfPoint>();
+    face->setKeyN(-(i + 1));
+    face->setKey(plane);
+    if (prism)
+      prism = std::make_unique<Intersection>(std::move(prism), std::move(face));
+    else
+      prism = std::move(face);
+  }
+  return prism;
+}
+} // namespace
+
+class CompiledRuleTest : public CxxTest::TestSuite {
+public:
+  static CompiledRuleTest *createSuite() { return new CompiledRuleTest(); }
+  static void destroySuite(CompiledRuleTest *suite) { delete suite; }
+
+  void test_default_is_not_compiled() {
+    CompiledRule rule;
+    TS_ASSERT(!rule.isCompiled());
+    TS_ASSERT(!rule.isValid(V3D()));
+  }
+
+  void test_null_rule_is_not_compiled() { TS_ASSERT(!CompiledRule(nullptr).isCompiled()); }
+
+  void test_rule_with_other_object_is_not_compiled() {
+    CompObj other;
+    TS_ASSERT(!CompiledRule(&other).isCompiled());
+  }
+
+  void test_cylinder_matches_rule_tree() {
+    checkAgainstRuleTree(*ComponentCreationHelper::createCappedCylinder(0.5, 1.5, V3D(), V3D(0., 0., 1.), "cyl"));
+  }
+
+  void test_cuboid_matches_rule_tree() { checkAgainstRuleTree(*ComponentCreationHelper::createCuboid(0.5, 0.7, 1.)); }
+
+  void test_hollow_shell_matches_rule_tree() {
+    checkAgainstRuleTree(*ComponentCreationHelper::createHollowShell(0.5, 1.));
+  }
+
+  void test_sphere_matches_rule_tree() { checkAgainstRuleTree(*ComponentCreationHelper::createSphere(1.)); }
+
+  void test_many_surfaces_match_rule_tree() {
+    // more literals than fit in a truth table
+    const auto rule = std::make_unique<Union>(createPrism(12, V3D(-0.5, 0., 0.)), createPrism(10, V3D(0.5, 0., 0.)));
+    const CompiledRule compiled(rule.get());
+    TS_ASSERT(compiled.isCompiled());
+    checkAgainstRuleTree(*rule, compiled);
+  }
+
+  void test_complement_matches_rule_tree() {
+    const auto rule = std::make_unique<CompGrp>(nullptr, createPrism(6, V3D()));
+    const CompiledRule compiled(rule.get());
+    TS_ASSERT(compiled.isCompiled());
+    checkAgainstRuleTree(*rule, compiled);
+  }
+
+private:
+  void checkAgainstRuleTree(const CSGObject &shape) {
+    const CompiledRule compiled(shape.topRule());
+    TS_ASSERT(compiled.isCompiled());
+    checkAgainstRuleTree(*shape.topRule(), compiled);
+  }
+
+  void checkAgainstRuleTree(const Rule &rule, const CompiledRule &compiled) {
+    // the grid includes points on the surfaces
+    constexpr int numSteps = 16;
+    constexpr double step = 0.125;
+    for (int i = -numSteps; i <= numSteps; ++i) {
+      for (int j = -numSteps; j <= numSteps; ++j) {
+        for (int k = -numSteps; k <= numSteps; ++k) {
+          const V3D point(i * step, j * step, k * step);
+          TSM_ASSERT_EQUALS(point.toString(), compiled.isValid(point), rule.isValid(point));
+        }
+      }
+    }
+  }
+};
@@ -0,0 +1,53 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cmath>
+
+namespace Mantid {
+namespace Kernel {
+
+/** KahanSum : A running total of doubles that keeps track of the rounding
+  error of each addition (the Kahan-Babuska, or Neumaier, variant of
+  compensated summation). Adding up millions of values of different magnitude
+  loses far less precision than with a plain double.
+
+  It can be used in place of a double accumulator in templated code:
+  operator+= accepts a double or another sum, and the total is read with
+  static_cast<double>().
+*/
+class KahanSum {
+public:
+  KahanSum() = default;
+  explicit KahanSum(double value) : m_sum(value) {}
+
+  KahanSum &operator+=(double value) {
+    const double total = m_sum + value;
+    // Recover the low-order bits lost from whichever operand is smaller
+    if (std::abs(m_sum) >= std::abs(value))
+      m_compensation += (m_sum - total) + value;
+    else
+      m_compensation += (value - total) + m_sum;
+    m_sum = total;
+    return *this;
+  }
+
+  KahanSum &operator+=(const KahanSum &other) {
+    *this += other.m_sum;
+    m_compensation += other.m_compensation;
+    return *this;
+  }
+
+  explicit operator double() const { return m_sum + m_compensation; }
+
+private:
+  double m_sum{0.0};
+  double m_compensation{0.0};
+};
+
+} // namespace Kernel
+} // namespace Mantid
@@ -0,0 +1,80 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/DllConfig.h"
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/**
+ * MemoryMappedFile gives read-only access to the whole of a file through a
+ * memory map, so that binary records can be used in place without copying
+ * them into a buffer first. Several threads may read from different parts of
+ * the file at the same time.
+ *
+ * The operating system is told that the file will be read sequentially, and
+ * large files are offered transparent huge pages where the platform supports
+ * it. If the file cannot be mapped its contents are read into memory instead,
+ * so callers do not need to handle that case.
+ *
+ * As with BinaryFile, the file must be a simple sequence of objects of type T
+ * (little-endian) to be viewed with elements<T>().
+ */
+class MANTID_KERNEL_DLL MemoryMappedFile {
+public:
+  explicit MemoryMappedFile(const std::string &filename);
+  ~MemoryMappedFile();
+  MemoryMappedFile(const MemoryMappedFile &) = delete;
+  MemoryMappedFile &operator=(const MemoryMappedFile &) = delete;
+
+  /// @return the contents of the file, or nullptr if it is empty
+  const char *data() const { return m_data; }
+  /// @return the size of the file in bytes
+  std::size_t size() const { return m_size; }
+  /// @return true if the file is mapped rather than read into memory
+  bool isMapped() const { return m_mapping != nullptr; }
+
+  /** @return the number of records of type T in the file
+   * @throw runtime_error if the file size is not a multiple of sizeof(T)
+   */
+  template <typename T> std::size_t numElements() const {
+    if (m_size % sizeof(T) != 0)
+      throw std::runtime_error("MemoryMappedFile: the size of " + m_filename + " is not a multiple of the record size.");
+    return m_size / sizeof(T);
+  }
+
+  /// @return the first record of type T in the file
+  template <typename T> const T *elements() const {
+    numElements<T>();
+    return reinterpret_cast<const T *>(m_data);
+  }
+
+private:
+  void readIntoMemory();
+  void unmap();
+
+  std::string m_filename;
+  const char *m_data{nullptr};
+  std::size_t m_size{0};
+  /// Start of the mapped view, or nullptr if the contents were read
+  void *m_mapping{nullptr};
+#ifdef _WIN32
+  void *m_fileHandle{nullptr};
+  void *m_mappingHandle{nullptr};
+#endif
+  /// Holds the contents if the file could not be mapped
+  std::vector<char> m_buffer;
+};
+
+} // namespace Kernel
+} // namespace Mantid
@@ -6,7 +6,9 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <mutex>
 
 namespace Mantid {
@@ -72,6 +74,33 @@ template <typename T, typename BinaryOp> void AtomicOp(std::atomic<T> &f, T d, B
   } while (!f.compare_exchange_weak(old, desired));
 }
 
+/** Splits a range of items into contiguous blocks, at most one per thread, for
+ * loops where each block accumulates into its own memory so that no two
+ * threads write to the same place. Block sizes differ by at most one item, and
+ * there is always at least one block, even for no items.
+ */
+class ThreadBlocks {
+public:
+  /**
+   * @param numItems the number of items to split
+   * @param maxBlocks the most blocks to use, normally PARALLEL_GET_MAX_THREADS,
+   * or 1 if the loop must run serially
+   */
+  ThreadBlocks(const size_t numItems, const size_t maxBlocks)
+      : m_numItems(numItems), m_numBlocks(std::max<size_t>(1, std::min(maxBlocks, numItems))) {}
+
+  /// @return the number of blocks
+  size_t size() const { return m_numBlocks; }
+  /// @return the first item of the block
+  size_t begin(const size_t block) const { return m_numItems * block / m_numBlocks; }
+  /// @return one past the last item of the block
+  size_t end(const size_t block) const { return begin(block + 1); }
+
+private:
+  size_t m_numItems;
+  size_t m_numBlocks;
+};
+
 } // namespace Kernel
 } // namespace Mantid
 
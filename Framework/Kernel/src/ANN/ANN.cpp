@@ -185,8 +185,8 @@ void annError(const char *msg, ANNerr level) {
 //		on the running time of the algorithm.
 //----------------------------------------------------------------------
 
-int ANNmaxPtsVisited = 0; // maximum number of pts visited
-int ANNptsVisited;        // number of pts visited in search
+int ANNmaxPtsVisited = 0;       // maximum number of pts visited
+thread_local int ANNptsVisited; // number of pts visited in search
 
 //----------------------------------------------------------------------
 //	Global function declarations
@@ -0,0 +1,122 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/MemoryMappedFile.h"
+#include "MantidKernel/Logger.h"
+
+#include <Poco/File.h>
+
+#include <fstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Mantid::Kernel {
+namespace {
+/// static logger object
+Logger g_log("MemoryMappedFile");
+} // namespace
+
+/** Map a file into memory
+ * @param filename :: full path to the file
+ * @throw invalid_argument if the file does not exist
+ * @throw runtime_error if the file cannot be read
+ */
+MemoryMappedFile::MemoryMappedFile(const std::string &filename) : m_filename(filename) {
+  if (!Poco::File(filename).exists())
+    throw std::invalid_argument("MemoryMappedFile: File " + filename + " was not found.");
+
+#ifdef _WIN32
+  HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  LARGE_INTEGER fileSize;
+  if (file != INVALID_HANDLE_VALUE && GetFileSizeEx(file, &fileSize)) {
+    m_fileHandle = file;
+    m_size = static_cast<std::size_t>(fileSize.QuadPart);
+    if (m_size == 0)
+      return;
+    m_mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (m_mappingHandle)
+      m_mapping = MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+  } else if (file != INVALID_HANDLE_VALUE) {
+    CloseHandle(file);
+  }
+#else
+  const int descriptor = ::open(filename.c_str(), O_RDONLY);
+  struct stat status;
+  if (descriptor >= 0 && ::fstat(descriptor, &status) == 0) {
+    m_size = static_cast<std::size_t>(status.st_size);
+    if (m_size == 0) {
+      ::close(descriptor);
+      return;
+    }
+    void *mapping = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    if (mapping != MAP_FAILED) {
+      m_mapping = mapping;
+      // Both are only hints: failures are harmless
+      ::madvise(m_mapping, m_size, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+      // Only worth it for mappings spanning several huge pages
+      constexpr std::size_t hugePageSize = 2 * 1024 * 1024;
+      if (m_size >= 4 * hugePageSize)
+        ::madvise(m_mapping, m_size, MADV_HUGEPAGE);
+#endif
+    }
+  }
+  // The mapping stays valid after the descriptor is closed
+  if (descriptor >= 0)
+    ::close(descriptor);
+#endif
+
+  if (m_mapping) {
+    m_data = static_cast<const char *>(m_mapping);
+  } else {
+    g_log.debug() << "Unable to map " << filename << " into memory. Reading it instead.\n";
+    unmap();
+    readIntoMemory();
+  }
+}
+
+MemoryMappedFile::~MemoryMappedFile() { unmap(); }
+
+/// Fallback for when the file cannot be mapped
+void MemoryMappedFile::readIntoMemory() {
+  std::ifstream file(m_filename, std::ios::binary | std::ios::ate);
+  if (!file)
+    throw std::runtime_error("MemoryMappedFile: Unable to open " + m_filename);
+  m_size = static_cast<std::size_t>(file.tellg());
+  m_buffer.resize(m_size);
+  file.seekg(0);
+  if (!file.read(m_buffer.data(), static_cast<std::streamsize>(m_size)))
+    throw std::runtime_error("MemoryMappedFile: Unable to read " + m_filename);
+  m_data = m_size > 0 ? m_buffer.data() : nullptr;
+}
+
+/// Release the mapping and any handles held on the file
+void MemoryMappedFile::unmap() {
+#ifdef _WIN32
+  if (m_mapping)
+    UnmapViewOfFile(m_mapping);
+  if (m_mappingHandle)
+    CloseHandle(m_mappingHandle);
+  if (m_fileHandle)
+    CloseHandle(m_fileHandle);
+  m_mappingHandle = nullptr;
+  m_fileHandle = nullptr;
+#else
+  if (m_mapping)
+    ::munmap(m_mapping, m_size);
+#endif
+  m_mapping = nullptr;
+}
+
+} // namespace Mantid::Kernel
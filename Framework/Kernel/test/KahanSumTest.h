@@ -0,0 +1,49 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/KahanSum.h"
+
+using Mantid::Kernel::KahanSum;
+
+class KahanSumTest : public CxxTest::TestSuite {
+public:
+  void test_default_is_zero() { TS_ASSERT_EQUALS(static_cast<double>(KahanSum()), 0.0); }
+
+  void test_small_values_are_not_lost() {
+    KahanSum sum(1.0);
+    double plain(1.0);
+    for (int i = 0; i < 1000000; ++i) {
+      sum += 1e-16;
+      plain += 1e-16;
+    }
+    TS_ASSERT_EQUALS(plain, 1.0);
+    TS_ASSERT_DELTA(static_cast<double>(sum), 1.0 + 1e-10, 1e-15);
+  }
+
+  void test_large_value_added_to_small_total() {
+    KahanSum sum;
+    sum += 1.0;
+    sum += 1e100;
+    sum += 1.0;
+    sum += -1e100;
+    TS_ASSERT_EQUALS(static_cast<double>(sum), 2.0);
+  }
+
+  void test_adding_sums_keeps_both_compensations() {
+    KahanSum first(1.0);
+    KahanSum second;
+    for (int i = 0; i < 1000; ++i) {
+      first += 1e-16;
+      second += 1e-16;
+    }
+    first += second;
+    TS_ASSERT_DELTA(static_cast<double>(first), 1.0 + 2e-13, 1e-15);
+  }
+};
@@ -0,0 +1,82 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/MemoryMappedFile.h"
+#include <Poco/File.h>
+#include <cxxtest/TestSuite.h>
+
+#include <cstdint>
+#include <fstream>
+#include <vector>
+
+using Mantid::Kernel::MemoryMappedFile;
+
+namespace {
+/// Matches the layout of the records in a PreNexus event file
+struct DasEvent {
+  uint32_t tof;
+  uint32_t pid;
+};
+
+/// Writes events with tof = i and pid = 2 * i
+void makeEventFile(const std::string &filename, uint32_t numEvents) {
+  std::vector<DasEvent> events(numEvents);
+  for (uint32_t i = 0; i < numEvents; ++i)
+    events[i] = {i, 2 * i};
+  std::ofstream file(filename, std::ios::out | std::ios::binary);
+  file.write(reinterpret_cast<const char *>(events.data()), numEvents * sizeof(DasEvent));
+}
+} // namespace
+
+class MemoryMappedFileTest : public CxxTest::TestSuite {
+public:
+  static MemoryMappedFileTest *createSuite() { return new MemoryMappedFileTest(); }
+  static void destroySuite(MemoryMappedFileTest *suite) { delete suite; }
+
+  void test_file_not_found() {
+    TS_ASSERT_THROWS(MemoryMappedFile("nonexistentfile.dat"), const std::invalid_argument &);
+  }
+
+  void test_records_are_read_in_place() {
+    makeEventFile(m_filename, 1000);
+    {
+      MemoryMappedFile file(m_filename);
+      TS_ASSERT(file.isMapped());
+      TS_ASSERT_EQUALS(file.size(), 1000 * sizeof(DasEvent));
+      TS_ASSERT_EQUALS(file.numElements<DasEvent>(), 1000);
+      const auto *events = file.elements<DasEvent>();
+      TS_ASSERT_EQUALS(events[0].tof, 0);
+      TS_ASSERT_EQUALS(events[999].tof, 999);
+      TS_ASSERT_EQUALS(events[999].pid, 1998);
+    }
+    Poco::File(m_filename).remove();
+  }
+
+  void test_wrong_size_throws() {
+    makeEventFile(m_filename, 3);
+    {
+      MemoryMappedFile file(m_filename);
+      TS_ASSERT_EQUALS(file.numElements<uint32_t>(), 6);
+      TS_ASSERT_THROWS(file.numElements<char[5]>(), const std::runtime_error &);
+    }
+    Poco::File(m_filename).remove();
+  }
+
+  void test_empty_file() {
+    makeEventFile(m_filename, 0);
+    {
+      MemoryMappedFile file(m_filename);
+      TS_ASSERT_EQUALS(file.size(), 0);
+      TS_ASSERT_EQUALS(file.numElements<DasEvent>(), 0);
+    }
+    Poco::File(m_filename).remove();
+  }
+
+private:
+  const std::string m_filename{"MemoryMappedFileTest.bin"};
+};
@@ -0,0 +1,55 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/MultiThreaded.h"
+
+#include <cxxtest/TestSuite.h>
+
+using Mantid::Kernel::ThreadBlocks;
+
+class MultiThreadedTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MultiThreadedTest *createSuite() { return new MultiThreadedTest(); }
+  static void destroySuite(MultiThreadedTest *suite) { delete suite; }
+
+  void test_ThreadBlocks_cover_all_items_in_order() {
+    const ThreadBlocks blocks(10, 4);
+    TS_ASSERT_EQUALS(blocks.size(), 4);
+    TS_ASSERT_EQUALS(blocks.begin(0), 0);
+    for (size_t block = 1; block < blocks.size(); ++block)
+      TS_ASSERT_EQUALS(blocks.begin(block), blocks.end(block - 1));
+    TS_ASSERT_EQUALS(blocks.end(3), 10);
+    // the sizes differ by at most one
+    for (size_t block = 0; block < blocks.size(); ++block) {
+      const auto size = blocks.end(block) - blocks.begin(block);
+      TS_ASSERT(size == 2 || size == 3);
+    }
+  }
+
+  void test_ThreadBlocks_never_has_more_blocks_than_items() {
+    const ThreadBlocks blocks(3, 8);
+    TS_ASSERT_EQUALS(blocks.size(), 3);
+    for (size_t block = 0; block < blocks.size(); ++block)
+      TS_ASSERT_EQUALS(blocks.end(block) - blocks.begin(block), 1);
+  }
+
+  void test_ThreadBlocks_has_one_empty_block_for_no_items() {
+    const ThreadBlocks blocks(0, 8);
+    TS_ASSERT_EQUALS(blocks.size(), 1);
+    TS_ASSERT_EQUALS(blocks.begin(0), 0);
+    TS_ASSERT_EQUALS(blocks.end(0), 0);
+  }
+
+  void test_ThreadBlocks_serial() {
+    const ThreadBlocks blocks(10, 1);
+    TS_ASSERT_EQUALS(blocks.size(), 1);
+    TS_ASSERT_EQUALS(blocks.end(0), 10);
+  }
+};
@@ -0,0 +1,73 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidLiveData/DllConfig.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace Mantid {
+namespace LiveData {
+
+/** ADARAChunkRing : A fixed set of reusable buffers that carry raw ADARA
+  stream data from the thread reading the socket (or a recorded stream file)
+  to the thread parsing it.
+
+  The reading thread takes an empty chunk with acquire(), fills it and hands
+  it over with submit(). The parsing thread takes filled chunks in order with
+  next() and gives them back with recycle(). No memory is allocated after
+  construction, and a slow consumer only stalls the reader once every chunk
+  is in use, so the socket keeps being drained while a packet is being
+  decoded.
+
+  Exactly one producer thread and one consumer thread are supported.
+*/
+class MANTID_LIVEDATA_DLL ADARAChunkRing {
+public:
+  struct Chunk {
+    std::vector<uint8_t> data;
+    /// Number of valid bytes in data
+    size_t length{0};
+  };
+
+  ADARAChunkRing(size_t numberOfChunks, size_t chunkSize);
+
+  Chunk *acquire();
+  void submit(Chunk *chunk);
+  Chunk *next(std::chrono::milliseconds timeout);
+  void recycle(Chunk *chunk);
+
+  void close();
+  bool isClosed() const;
+  bool isDrained() const;
+
+  /** Source of stream data for readInto(): fills up to `length` bytes at
+   * `buffer` and returns the number of bytes read, 0 if nothing is available
+   * yet, or a negative number at the end of the stream.
+   */
+  using ReadFunction = std::function<int(uint8_t *buffer, int length)>;
+  void readInto(const ReadFunction &read, const std::atomic<bool> &stop);
+
+private:
+  std::vector<Chunk> m_chunks;
+  std::deque<Chunk *> m_free;
+  std::deque<Chunk *> m_filled;
+  mutable std::mutex m_mutex;
+  std::condition_variable m_freeAvailable;
+  std::condition_variable m_filledAvailable;
+  bool m_closed{false};
+};
+
+} // namespace LiveData
+} // namespace Mantid
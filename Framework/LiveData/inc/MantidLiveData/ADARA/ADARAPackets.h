@@ -10,6 +10,7 @@
 #include <cstring>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "ADARA.h"
 #include "MantidKernel/System.h"
@@ -225,6 +226,20 @@ public:
   uint32_t getSourceTOFOffset() const { return m_TOFOffset; }
   uint32_t curBankId() const { return m_bankId; }
 
+  /// The events of one detector bank, with the settings of its source section
+  struct Bank {
+    uint32_t id;
+    bool isCorrected;
+    uint32_t tofOffset;
+    const Event *events;
+    uint32_t eventCount;
+  };
+
+  // Random access alternative to firstEvent()/nextEvent(): lists every bank
+  // that holds events so that banks can be decoded independently.  Does not
+  // change the iteration state.
+  void banks(std::vector<Bank> &banks) const;
+
   //        uint32_t curEventCount() const { return ((uint32_t *)m_curBank)[1];
   //        }
 
@@ -11,18 +11,29 @@
 //----------------------------------------------------------------------
 #include "MantidAPI/LiveListener.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidLiveData/ADARA/ADARAChunkRing.h"
 #include "MantidLiveData/ADARA/ADARAParser.h"
 
 #include <Poco/Net/StreamSocket.h>
 #include <Poco/Runnable.h>
+#include <Poco/RunnableAdapter.h>
+#include <Poco/Thread.h>
 #include <Poco/Timer.h>
 
+#include <atomic>
+#include <fstream>
+
 namespace Mantid {
 namespace LiveData {
 
 /** An implementation of ILiveListener for use at SNS.  Connects to the Stream
    Management
     Service and receives events from it.
+
+    Data flows through two background threads: one drains the socket (or a
+    recorded stream file, see replayFile()) into an ADARAChunkRing, the other
+    parses the packets and decodes the banks of each banked event packet in
+    parallel before adding the events to the buffer workspace.
  */
 class SNSLiveEventDataListener : public API::LiveListener, public Poco::Runnable, public ADARA::Parser {
 public:
@@ -34,6 +45,7 @@ public:
   bool buffersEvents() const override { return true; }
 
   bool connect(const Poco::Net::SocketAddress &address) override;
+  bool replayFile(const std::string &filename);
   void start(const Types::Core::DateAndTime startTime = Types::Core::DateAndTime()) override;
   std::shared_ptr<API::Workspace> extractData() override;
 
@@ -97,14 +109,21 @@ private:
   // Returns true if we've got a value for every log listed in m_requiredLogs
   bool haveRequiredLogs();
 
-  void appendEvent(const uint32_t pixelId, const double tof, const Mantid::Types::Core::DateAndTime pulseTime);
-  // tof is "Time Of Flight" and is in units of microsecondss relative to the
-  // start of the pulse
-  // (There's some documentation that says nanoseconds, but Russell Taylor
-  // assures me it's really is microseconds!)
-  // pulseTime is the start of the pulse relative to Jan 1, 1990.
-  // Both values are designed to be passed straight into the TofEvent
-  // constructor.
+  // The events of one bank of a BankedEventPkt, decoded into workspace
+  // indices and TofEvents.  Kept between packets to reuse the memory.
+  struct DecodedBank {
+    std::vector<std::pair<size_t, Types::Event::TofEvent>> events;
+    // pixel ID and tof of events with a pixel ID that isn't in the workspace
+    std::vector<std::pair<uint32_t, double>> invalidPixels;
+  };
+  void decodeBank(const ADARA::BankedEventPkt::Bank &bank, const Types::Core::DateAndTime &pulseTime,
+                  DecodedBank &decoded) const;
+  std::vector<ADARA::BankedEventPkt::Bank> m_banks;
+  std::vector<DecodedBank> m_decodedBanks;
+
+  // Body of the thread filling m_chunkRing from the socket or replay file
+  void receive();
+  void stopReceiving();
 
   ILiveListener::RunStatus m_status{RunStatus::NoRun};
   int m_runNumber{0};
@@ -131,11 +150,21 @@ private:
   Poco::Net::StreamSocket m_socket;
   bool m_isConnected{false};
 
+  // Set by replayFile(): read a recorded stream instead of the socket
+  std::ifstream m_replayFile;
+  bool m_replaying{false};
+
+  std::unique_ptr<ADARAChunkRing> m_chunkRing;
+  Poco::RunnableAdapter<SNSLiveEventDataListener> m_receiver{*this, &SNSLiveEventDataListener::receive};
+  Poco::Thread m_receiveThread;
+  // Error in the receiving thread, re-thrown by the parsing thread
+  std::string m_receiveError;
+
   Poco::Thread m_thread;
   std::mutex m_mutex; // protects m_buffer & m_status
   bool m_pauseNetRead{false};
-  bool m_stopThread{false}; // background thread checks this periodically.
-                            // If true, the thread exits
+  std::atomic<bool> m_stopThread{false}; // background threads check this periodically.
+                                         // If true, the threads exit
 
   Types::Core::DateAndTime m_startTime; // The requested start time for the data
                                         // stream (needed by the run() function)
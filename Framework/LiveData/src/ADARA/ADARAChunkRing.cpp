@@ -0,0 +1,127 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidLiveData/ADARA/ADARAChunkRing.h"
+
+#include <stdexcept>
+
+namespace Mantid::LiveData {
+
+/** Constructor
+ * @param numberOfChunks :: number of buffers in the ring
+ * @param chunkSize :: size of each buffer in bytes
+ */
+ADARAChunkRing::ADARAChunkRing(size_t numberOfChunks, size_t chunkSize) : m_chunks(numberOfChunks) {
+  if (numberOfChunks == 0 || chunkSize == 0)
+    throw std::invalid_argument("ADARAChunkRing needs at least one chunk of non-zero size");
+  for (auto &chunk : m_chunks) {
+    chunk.data.resize(chunkSize);
+    m_free.emplace_back(&chunk);
+  }
+}
+
+/** Take an empty chunk to fill, waiting until one is recycled if all of
+ * them are in use.
+ * @return the chunk, or nullptr once the ring has been closed
+ */
+ADARAChunkRing::Chunk *ADARAChunkRing::acquire() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_freeAvailable.wait(lock, [this] { return m_closed || !m_free.empty(); });
+  if (m_closed)
+    return nullptr;
+  auto *chunk = m_free.front();
+  m_free.pop_front();
+  chunk->length = 0;
+  return chunk;
+}
+
+/// Hand a filled chunk over to the consumer. Empty chunks are recycled.
+void ADARAChunkRing::submit(Chunk *chunk) {
+  if (chunk->length == 0) {
+    recycle(chunk);
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_filled.emplace_back(chunk);
+  }
+  m_filledAvailable.notify_one();
+}
+
+/** Take the oldest filled chunk.
+ * @param timeout :: how long to wait for data
+ * @return the chunk, or nullptr if nothing arrived in time or the ring is
+ * closed and drained
+ */
+ADARAChunkRing::Chunk *ADARAChunkRing::next(std::chrono::milliseconds timeout) {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  if (!m_filledAvailable.wait_for(lock, timeout, [this] { return m_closed || !m_filled.empty(); }) ||
+      m_filled.empty())
+    return nullptr;
+  auto *chunk = m_filled.front();
+  m_filled.pop_front();
+  return chunk;
+}
+
+/// Give a chunk returned by next() back to the producer
+void ADARAChunkRing::recycle(Chunk *chunk) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_free.emplace_back(chunk);
+  }
+  m_freeAvailable.notify_one();
+}
+
+/// Marks the end of the stream. Chunks already submitted can still be read.
+void ADARAChunkRing::close() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_closed = true;
+  }
+  m_freeAvailable.notify_all();
+  m_filledAvailable.notify_all();
+}
+
+bool ADARAChunkRing::isClosed() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_closed;
+}
+
+/// @return true if the ring is closed and every submitted chunk has been read
+bool ADARAChunkRing::isDrained() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_closed && m_filled.empty();
+}
+
+/** Producer loop: fill chunks from a data source until the end of the stream
+ * or until asked to stop, then close the ring. Exceptions thrown by the
+ * source are passed on without closing the ring, so that the caller can
+ * record the error before the consumer sees the end of the stream.
+ *
+ * @param read :: the data source
+ * @param stop :: checked after every read
+ */
+void ADARAChunkRing::readInto(const ReadFunction &read, const std::atomic<bool> &stop) {
+  while (!stop) {
+    Chunk *chunk = acquire();
+    if (!chunk)
+      return;
+    int bytesRead = 0;
+    try {
+      bytesRead = read(chunk->data.data(), static_cast<int>(chunk->data.size()));
+    } catch (...) {
+      recycle(chunk);
+      throw;
+    }
+    chunk->length = bytesRead > 0 ? static_cast<size_t>(bytesRead) : 0;
+    submit(chunk);
+    if (bytesRead < 0)
+      break;
+  }
+  close();
+}
+
+} // namespace Mantid::LiveData
@@ -247,6 +247,30 @@ void BankedEventPkt::firstEventInBank() const {
   }
 }
 
+// Walks the same source and bank headers as firstEvent() and nextEvent(),
+// but collects the banks instead of stepping through their events.
+void BankedEventPkt::banks(std::vector<Bank> &banks) const {
+  banks.clear();
+  unsigned index = 4;
+  while (index + 3 <= m_lastFieldIndex) {
+    // Start of a source section. The TOF offset is decoded as in
+    // firstEventInSource() so both ways of reading a packet agree.
+    const uint32_t bankCount = m_fields[index + 3];
+    const uint32_t tofOffset = ((m_fields[index + 2] & 0x7FFFFFFF) != 0);
+    const bool isCorrected = ((m_fields[index + 2] & 0x80000000) != 0);
+    index += 4;
+    for (uint32_t bank = 0; bank < bankCount && index + 1 <= m_lastFieldIndex; ++bank) {
+      const uint32_t eventCount = m_fields[index + 1];
+      if (index + 1 + 2 * static_cast<uint64_t>(eventCount) > m_lastFieldIndex)
+        throw invalid_packet("BankedEvent bank extends past the end of the packet");
+      if (eventCount > 0)
+        banks.push_back(
+            {m_fields[index], isCorrected, tofOffset, reinterpret_cast<const Event *>(&m_fields[index + 2]), eventCount});
+      index += 2 + 2 * eventCount;
+    }
+  }
+}
+
 /* ------------------------------------------------------------------------ */
 
 BeamMonitorPkt::BeamMonitorPkt(const uint8_t *data, uint32_t len)
@@ -89,10 +89,13 @@ void LoadLiveData::init() { this->initProps(); }
  *
  * @param inputWS :: workspace being processed
  * @param PostProcess :: flag, TRUE if doing the post-processing
+ * @param Incremental :: flag, TRUE if post-processing a single chunk rather
+ *than the accumulation workspace
  * @return the processed workspace. Will point to inputWS if no processing is to
  *do
  */
-Mantid::API::Workspace_sptr LoadLiveData::runProcessing(Mantid::API::Workspace_sptr inputWS, bool PostProcess) {
+Mantid::API::Workspace_sptr LoadLiveData::runProcessing(Mantid::API::Workspace_sptr inputWS, bool PostProcess,
+                                                        bool Incremental) {
   if (!inputWS)
     throw std::runtime_error("LoadLiveData::runProcessing() called for an empty input workspace.");
   // Prevent others writing to the workspace while we run.
@@ -110,12 +113,13 @@ Mantid::API::Workspace_sptr LoadLiveData::runProcessing(Mantid::API::Workspace_s
     // Run the processing algorithm
 
     // Make a unique anonymous names for the workspace, to put in ADS
-    std::string inputName = "__anonymous_livedata_input_" + this->getPropertyValue("OutputWorkspace");
+    std::string inputName = (Incremental ? "__anonymous_livedata_postprocess_" : "__anonymous_livedata_input_") +
+                            this->getPropertyValue("OutputWorkspace");
     // Transform the chunk in-place
     std::string outputName = inputName;
 
     // Except, no need for anonymous names with the post-processing
-    if (PostProcess) {
+    if (PostProcess && !Incremental) {
       inputName = this->getPropertyValue("AccumulationWorkspace");
       outputName = this->getPropertyValue("OutputWorkspace");
     }
@@ -167,7 +171,7 @@ Mantid::API::Workspace_sptr LoadLiveData::runProcessing(Mantid::API::Workspace_s
                                " Algorithm's OutputWorkspace property is not a WorkspaceProperty!");
     Workspace_sptr temp = wsProp->getWorkspace();
 
-    if (!PostProcess) {
+    if (!PostProcess || Incremental) {
       if (!temp) {
         // a group workspace cannot be returned by wsProp
         temp = AnalysisDataService::Instance().retrieve(inputName);
@@ -215,21 +219,79 @@ void LoadLiveData::runPostProcessing() {
   }
 }
 
+//----------------------------------------------------------------------------------------------
+/** Whether the post-processing can be applied to the new chunk alone and the
+ * result added to the previous output, rather than reprocessing all of the
+ * accumulated data. This is up to the post-processing algorithm, see
+ * Algorithm::isChunkMergeable(). Scripts are always run on the accumulation
+ * workspace.
+ *
+ * @param chunkWS :: processed chunk that was added to the accumulation workspace
+ * @return true if the post-processing can be done incrementally
+ */
+bool LoadLiveData::canPostProcessIncrementally(const Mantid::API::Workspace_sptr &chunkWS) {
+  if (!m_outputWS || m_outputWS == m_accumWS)
+    return false;
+  auto alg = std::dynamic_pointer_cast<Algorithm>(this->makeAlgorithm(true));
+  if (!alg || !alg->existsProperty("InputWorkspace"))
+    return false;
+  // Mergeability may depend on the kind of input. Groups are processed item by
+  // item, so look at the first one.
+  auto inputWS = chunkWS;
+  if (auto chunkGroup = std::dynamic_pointer_cast<WorkspaceGroup>(chunkWS))
+    inputWS = chunkGroup->getItem(0);
+  try {
+    alg->setProperty("InputWorkspace", inputWS);
+  } catch (std::invalid_argument &) {
+    return false;
+  }
+  return alg->isChunkMergeable();
+}
+
+//----------------------------------------------------------------------------------------------
+/** Post-process the new chunk and add the result to the previous output.
+ * Sets m_outputWS.
+ *
+ * @param chunkWS :: processed chunk that was added to the accumulation workspace
+ * @return false if the result could not be added to the output, e.g. because
+ *the binning differs. The accumulation workspace must then be post-processed.
+ */
+bool LoadLiveData::runIncrementalPostProcessing(const Mantid::API::Workspace_sptr &chunkWS) {
+  Workspace_sptr processed;
+  try {
+    processed = runProcessing(chunkWS, true, true);
+  } catch (...) {
+    g_log.error("While post processing:");
+    throw;
+  }
+  try {
+    this->addChunk(m_outputWS, processed);
+  } catch (std::exception &e) {
+    g_log.information() << "Could not add the post-processed chunk to the output workspace (" << e.what()
+                        << "). Post-processing all of the accumulated data instead.\n";
+    return false;
+  }
+  // Adding events does not check the X values, so the default bin boundaries
+  // of the output would otherwise stay those of the first chunk
+  this->updateDefaultBinBoundaries(m_outputWS.get());
+  return true;
+}
+
 //----------------------------------------------------------------------------------------------
 /** Accumulate the data by adding (summing) to the output workspace.
  * Calls the Plus algorithm
- * Sets m_accumWS.
  *
+ * @param accumWS :: workspace to add to, normally m_accumWS
  * @param chunkWS :: processed live data chunk workspace
  */
-void LoadLiveData::addChunk(const Mantid::API::Workspace_sptr &chunkWS) {
+void LoadLiveData::addChunk(API::Workspace_sptr &accumWS, const Mantid::API::Workspace_sptr &chunkWS) {
   // Acquire locks on the workspaces we use
-  WriteLock _lock1(*m_accumWS);
+  WriteLock _lock1(*accumWS);
   ReadLock _lock2(*chunkWS);
 
   // ISIS multi-period data come in workspace groups
   if (WorkspaceGroup_sptr gws = std::dynamic_pointer_cast<WorkspaceGroup>(chunkWS)) {
-    WorkspaceGroup_sptr accum_gws = std::dynamic_pointer_cast<WorkspaceGroup>(m_accumWS);
+    WorkspaceGroup_sptr accum_gws = std::dynamic_pointer_cast<WorkspaceGroup>(accumWS);
     if (!accum_gws) {
       throw std::runtime_error("Two workspace groups are expected.");
     }
@@ -244,10 +306,10 @@ void LoadLiveData::addChunk(const Mantid::API::Workspace_sptr &chunkWS) {
     }
   } else if (std::dynamic_pointer_cast<MatrixWorkspace>(chunkWS)) {
     // If workspace is a Matrix workspace just add the chunk
-    addMatrixWSChunk(m_accumWS, chunkWS);
+    addMatrixWSChunk(accumWS, chunkWS);
   } else {
     // Assume MD Workspace
-    addMDWSChunk(m_accumWS, chunkWS);
+    addMDWSChunk(accumWS, chunkWS);
   }
 }
 
@@ -543,6 +605,9 @@ void LoadLiveData::exec() {
 
   g_log.notice() << "Performing the " << accum << " operation.\n";
 
+  // Only added data can be post-processed chunk by chunk
+  bool addedToAccumulation(false);
+
   // Perform the accumulation and set the AccumulationWorkspace workspace
   if (accum == "Replace") {
     this->replaceChunk(processed);
@@ -550,7 +615,8 @@ void LoadLiveData::exec() {
     this->appendChunk(processed);
   } else {
     // Default to Add.
-    this->addChunk(processed);
+    this->addChunk(m_accumWS, processed);
+    addedToAccumulation = true;
 
     // When adding events, the default bin boundaries may need to be updated.
     // The function itself checks to see if it is appropriate
@@ -563,7 +629,9 @@ void LoadLiveData::exec() {
 
   if (this->hasPostProcessing()) {
     // ----------- Run post-processing -------------
-    this->runPostProcessing();
+    if (!(addedToAccumulation && this->canPostProcessIncrementally(processed) &&
+          this->runIncrementalPostProcessing(processed)))
+      this->runPostProcessing();
     // Set both output workspaces
     this->setProperty("AccumulationWorkspace", m_accumWS);
     this->setProperty("OutputWorkspace", m_outputWS);
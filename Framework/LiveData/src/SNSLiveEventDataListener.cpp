@@ -18,6 +18,7 @@
 #include "MantidGeometry/Instrument.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/DateAndTime.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/OptionalBool.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/TimeSeriesProperty.h"
@@ -41,6 +42,9 @@
 #include <Poco/Runnable.h>
 #include <Poco/Thread.h>
 
+#include <algorithm>
+#include <cstring>
+
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
 using Mantid::Types::Core::DateAndTime;
@@ -51,6 +55,10 @@ namespace { // anonymous namespace
 // Also used when shutting down the thread so we know how long to wait there
 const int64_t RECV_TIMEOUT = 30;
 
+// Buffers between the receiving and the parsing thread
+const size_t RING_CHUNKS = 32;
+const size_t RING_CHUNK_SIZE = 256 * 1024;
+
 // Names for a couple of time series properties
 const std::string PAUSE_PROPERTY("pause");
 const std::string SCAN_PROPERTY("scan_index");
@@ -121,6 +129,8 @@ SNSLiveEventDataListener::~SNSLiveEventDataListener() {
                     << "Talk to the Mantid developer team.\n";
     }
   }
+  // Normally joined when run() exits
+  stopReceiving();
 }
 
 /// Connect to the SMS daemon.
@@ -165,6 +175,25 @@ bool SNSLiveEventDataListener::connect(const Poco::Net::SocketAddress &address)
   return true;
 }
 
+/// Read a recorded ADARA stream from a file instead of the network
+
+/// Replays the packets of a stream saved from the SMS (e.g. with
+/// adara-dump or netcat) through the normal parsing path.  Must be called
+/// instead of connect() and before start().  No client hello packet is sent
+/// and the background threads exit once the whole file has been parsed.
+/// @param filename The file to read
+/// @return Returns true if the file could be opened.  False otherwise.
+bool SNSLiveEventDataListener::replayFile(const std::string &filename) {
+  m_replayFile.open(filename, std::ios::binary);
+  if (!m_replayFile) {
+    g_log.error() << "Cannot open ADARA stream file " << filename << '\n';
+    return false;
+  }
+  m_replaying = true;
+  m_isConnected = true;
+  return true;
+}
+
 /// Test to see if the object has connected to the SMS daemon
 
 /// Test to see if the object has connected to the SMS daemon
@@ -210,7 +239,8 @@ void SNSLiveEventDataListener::run() {
       throw std::runtime_error(std::string("SNSLiveEventDataListener::run(): No connection to SMS server."));
     }
 
-    // First thing to do is send a hello packet
+    // First thing to do is send a hello packet (unless we're replaying a
+    // recorded stream)
     uint32_t typeVal = ADARA_PKT_TYPE(ADARA::PacketType::Type::CLIENT_HELLO_TYPE, 0);
     uint32_t helloPkt[5] = {4, typeVal, 0, 0, 0};
     // TODO: The packet version should be bumped to 1 and we should add
@@ -224,7 +254,7 @@ void SNSLiveEventDataListener::run() {
     helloPkt[4] = static_cast<uint32_t>(m_startTime.totalNanoseconds() /
                                         1000000000); // divide by a billion to get time in seconds
 
-    if (m_socket.sendBytes(helloPkt, sizeof(helloPkt)) != sizeof(helloPkt))
+    if (!m_replaying && m_socket.sendBytes(helloPkt, sizeof(helloPkt)) != sizeof(helloPkt))
     // Yes, I know a send isn't guaranteed to send the whole buffer in one
     // call.  I'm treating such a case as an error anyway.
     {
@@ -233,6 +263,13 @@ void SNSLiveEventDataListener::run() {
       m_stopThread = true;
     }
 
+    // Network reads happen on their own thread so that the socket keeps being
+    // drained while we're busy parsing.
+    m_chunkRing = std::make_unique<ADARAChunkRing>(RING_CHUNKS, RING_CHUNK_SIZE);
+    m_receiveThread.start(m_receiver);
+
+    ADARAChunkRing::Chunk *chunk = nullptr; // data not yet copied to the parser
+    size_t chunkOffset = 0;
     while (!m_stopThread) // loop until the foreground thread tells us to stop
     {
 
@@ -248,37 +285,35 @@ void SNSLiveEventDataListener::run() {
         break;
       }
 
-      // Get some more data from our socket and put it in the parser's buffer
-      unsigned int bufFillLen = bufferFillLength();
-      if (bufFillLen) {
-        uint8_t *bufFillAddr = bufferFillAddress();
-        int bytesRead = 0;
-        try {
-          bytesRead = m_socket.receiveBytes(bufFillAddr, bufFillLen);
-        } catch (Poco::TimeoutException &) {
-          // Don't need to stop processing or anything - just log a warning
-          g_log.warning("Timeout reading from the network.  Is SMS still sending?");
-        } catch (Poco::Net::NetException &e) {
-          std::string msg("Parser::read(): ");
-          msg += e.name();
-          throw std::runtime_error(msg);
+      // Move the next piece of received data into the parser's buffer
+      if (!chunk) {
+        chunk = m_chunkRing->next(std::chrono::milliseconds(100));
+        chunkOffset = 0;
+        if (!chunk && m_chunkRing->isDrained()) {
+          if (!m_receiveError.empty())
+            throw std::runtime_error(m_receiveError);
+          g_log.notice("End of the ADARA stream reached.");
+          break;
         }
-
-        if (bytesRead > 0) {
-          bufferBytesAppended(bytesRead);
+      }
+      if (chunk) {
+        const auto count = std::min(static_cast<size_t>(bufferFillLength()), chunk->length - chunkOffset);
+        if (count > 0) {
+          std::memcpy(bufferFillAddress(), chunk->data.data() + chunkOffset, count);
+          bufferBytesAppended(static_cast<unsigned int>(count));
+          chunkOffset += count;
+        }
+        if (chunkOffset == chunk->length) {
+          m_chunkRing->recycle(chunk);
+          chunk = nullptr;
         }
       }
 
       std::string bufferParseLog;
       // bufferParse() wants a string where it can save log messages.
       // We don't actually use the messages for anything, though.
-      int packetsParsed = bufferParse(bufferParseLog);
+      bufferParse(bufferParseLog);
       bufferParseLog.clear(); // keep the string from growing without bound
-      if (packetsParsed == 0) {
-        // No packets were parsed.  Sleep a little to let some data accumulate
-        // before calling read again.  (Keeps us from spinlocking the cpu...)
-        Poco::Thread::sleep(10); // 10 milliseconds
-      }
     }
 
     // If we've gotten here, it's because the thread has thrown an otherwise
@@ -334,6 +369,59 @@ void SNSLiveEventDataListener::run() {
 
     m_backgroundException = std::make_shared<std::runtime_error>("Unknown error in backgound thread");
   }
+
+  stopReceiving();
+}
+
+/// Body of the receiving thread
+
+/// Fills m_chunkRing from the socket, or from the replay file, until the
+/// stream ends or the parsing thread asks us to stop.  Errors are saved in
+/// m_receiveError for the parsing thread to re-throw.
+void SNSLiveEventDataListener::receive() {
+  try {
+    if (m_replaying) {
+      m_chunkRing->readInto(
+          [this](uint8_t *buffer, int length) {
+            m_replayFile.read(reinterpret_cast<char *>(buffer), length);
+            const auto bytesRead = static_cast<int>(m_replayFile.gcount());
+            return bytesRead > 0 ? bytesRead : -1;
+          },
+          m_stopThread);
+    } else {
+      m_chunkRing->readInto(
+          [this](uint8_t *buffer, int length) {
+            int bytesRead = 0;
+            try {
+              bytesRead = m_socket.receiveBytes(buffer, length);
+            } catch (Poco::TimeoutException &) {
+              // Don't need to stop processing or anything - just log a warning
+              g_log.warning("Timeout reading from the network.  Is SMS still sending?");
+            } catch (Poco::Net::NetException &e) {
+              std::string msg("Parser::read(): ");
+              msg += e.name();
+              throw std::runtime_error(msg);
+            }
+            if (bytesRead == 0) {
+              // Keeps us from spinlocking the cpu...
+              Poco::Thread::sleep(10); // 10 milliseconds
+            }
+            return bytesRead;
+          },
+          m_stopThread);
+    }
+  } catch (std::exception &e) {
+    m_receiveError = e.what();
+    m_chunkRing->close();
+  }
+}
+
+/// Stop and join the receiving thread
+void SNSLiveEventDataListener::stopReceiving() {
+  if (m_chunkRing)
+    m_chunkRing->close();
+  if (m_receiveThread.isRunning())
+    m_receiveThread.join();
 }
 
 /// Parse a banked event packet
@@ -378,9 +466,6 @@ bool SNSLiveEventDataListener::rxPacket(const ADARA::BankedEventPkt &pkt) {
     }
   }
 
-  // A counter that we use for logging purposes
-  unsigned totalEvents = 0;
-
   // First, check to see if the run has been paused.  We don't process
   // the events if we're paused unless the user has specifically overridden
   // this behavior with the livelistener.keeppausedevents property.
@@ -388,51 +473,51 @@ bool SNSLiveEventDataListener::rxPacket(const ADARA::BankedEventPkt &pkt) {
     return false;
   }
 
-  // Append the events
   g_log.debug() << "----- Pulse ID: " << pkt.pulseId() << " -----\n";
+
+  // Timestamp for the events
+  Mantid::Types::Core::DateAndTime eventTime = timeFromPacket(pkt);
+
+  // Decode the banks in parallel.  This needs neither the mutex nor the
+  // workspace, so the foreground thread is only held up while we add the
+  // decoded events below.
+  pkt.banks(m_banks);
+  if (m_decodedBanks.size() < m_banks.size())
+    m_decodedBanks.resize(m_banks.size());
+  const auto numberOfBanks = static_cast<int64_t>(m_banks.size());
+  PARALLEL_FOR_IF(numberOfBanks > 1)
+  for (int64_t i = 0; i < numberOfBanks; ++i) {
+    decodeBank(m_banks[i], eventTime, m_decodedBanks[i]);
+  }
+
+  // Append the events
   // Scope braces
   {
     std::lock_guard<std::mutex> scopedLock(m_mutex);
 
-    // Timestamp for the events
-    Mantid::Types::Core::DateAndTime eventTime = timeFromPacket(pkt);
-
     // Save the pulse charge in the logs (*10 because we want the units to be
     // picoCulombs, and ADARA sends them out in units of 10pC)
     m_eventBuffer->mutableRun()
         .getTimeSeriesProperty<double>(PROTON_CHARGE_PROPERTY)
         ->addValue(eventTime, pkt.pulseCharge() * 10);
 
-    // Iterate through each event
-    const ADARA::Event *event = pkt.firstEvent();
-    unsigned lastBankID = pkt.curBankId();
-    // A counter that we use for logging purposes
-    unsigned eventsPerBank = 0;
-    while (event != nullptr) {
-      eventsPerBank++;
-      totalEvents++;
-      if (lastBankID < 0xFFFFFFFE) // Bank ID -1 & -2 are special cases and are
-                                   // not valid pixels
-      {
-        // appendEvent needs tof to be in units of microseconds, but it comes
-        // from the ADARA stream in units of 100ns.
-        if (pkt.getSourceCORFlag()) {
-          appendEvent(event->pixel, event->tof / 10.0, eventTime);
-        } else {
-          appendEvent(event->pixel, (event->tof + pkt.getSourceTOFOffset()) / 10.0, eventTime);
-        }
-      }
-
-      event = pkt.nextEvent();
-      if (pkt.curBankId() != lastBankID) {
-        g_log.debug() << "BankID " << lastBankID << " had " << eventsPerBank << " events\n";
-
-        lastBankID = pkt.curBankId();
-        eventsPerBank = 0;
+    for (size_t i = 0; i < m_banks.size(); ++i) {
+      for (const auto &event : m_decodedBanks[i].events) {
+        m_eventBuffer->getSpectrum(event.first).addEventQuickly(event.second);
       }
     }
   } // mutex automatically unlocks here
 
+  // A counter that we use for logging purposes
+  unsigned totalEvents = 0;
+  for (size_t i = 0; i < m_banks.size(); ++i) {
+    totalEvents += m_banks[i].eventCount;
+    g_log.debug() << "BankID " << m_banks[i].id << " had " << m_banks[i].eventCount << " events\n";
+    for (const auto &invalid : m_decodedBanks[i].invalidPixels) {
+      g_log.warning() << "Invalid pixel ID: " << invalid.first << " (TofF: " << invalid.second << " microseconds)\n";
+    }
+  }
+
   g_log.debug() << "Total Events: " << totalEvents << "\n";
   g_log.debug("-------------------------------");
 
@@ -1356,21 +1441,35 @@ bool SNSLiveEventDataListener::haveRequiredLogs() {
   return allFound;
 }
 
-/// Adds an event to the workspace
-void SNSLiveEventDataListener::appendEvent(const uint32_t pixelId, const double tof,
-                                           const Mantid::Types::Core::DateAndTime pulseTime)
-// NOTE: This function does NOT lock the mutex!  Make sure you do that
-// before calling this function!
-{
-  // It'd be nice to use operator[], but we might end up inserting a value....
-  // Have to use find() instead.
-  const auto it = m_indexMap.find(pixelId);
-  if (it != m_indexMap.end()) {
-    const std::size_t workspaceIndex = it->second;
-    Types::Event::TofEvent event(tof, pulseTime);
-    m_eventBuffer->getSpectrum(workspaceIndex).addEventQuickly(event);
-  } else {
-    g_log.warning() << "Invalid pixel ID: " << pixelId << " (TofF: " << tof << " microseconds)\n";
+/// Decode the events of one bank
+
+/// Looks up the workspace index of each event and converts its tof.  Only
+/// reads m_indexMap, so several banks can be decoded at the same time.
+/// @param bank The bank to decode
+/// @param pulseTime The start of the pulse relative to Jan 1, 1990
+/// @param decoded Receives the events and any invalid pixel IDs
+void SNSLiveEventDataListener::decodeBank(const ADARA::BankedEventPkt::Bank &bank,
+                                          const Types::Core::DateAndTime &pulseTime, DecodedBank &decoded) const {
+  decoded.events.clear();
+  decoded.invalidPixels.clear();
+  if (bank.id >= 0xFFFFFFFE) // Bank ID -1 & -2 are special cases and are
+                             // not valid pixels
+    return;
+
+  decoded.events.reserve(bank.eventCount);
+  for (uint32_t i = 0; i < bank.eventCount; ++i) {
+    const ADARA::Event &event = bank.events[i];
+    // TofEvent needs tof to be in units of microseconds, but it comes from
+    // the ADARA stream in units of 100ns.
+    const double tof = bank.isCorrected ? event.tof / 10.0 : (event.tof + bank.tofOffset) / 10.0;
+    // It'd be nice to use operator[], but we might end up inserting a value....
+    // Have to use find() instead.
+    const auto it = m_indexMap.find(event.pixel);
+    if (it != m_indexMap.end()) {
+      decoded.events.emplace_back(it->second, Types::Event::TofEvent(tof, pulseTime));
+    } else {
+      decoded.invalidPixels.emplace_back(event.pixel, tof);
+    }
   }
 }
 
@@ -0,0 +1,178 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidLiveData/ADARA/ADARAChunkRing.h"
+#include "MantidLiveData/ADARA/ADARAParser.h"
+
+#include "ADARAPackets.h"
+
+#include <Poco/Runnable.h>
+#include <Poco/Thread.h>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+
+using Mantid::LiveData::ADARAChunkRing;
+using namespace std::chrono_literals;
+
+namespace {
+/// Counts the banked event packets in a stream
+class CountingParser : public ADARA::Parser {
+public:
+  using ADARA::Parser::bufferBytesAppended;
+  using ADARA::Parser::bufferFillAddress;
+  using ADARA::Parser::bufferFillLength;
+  using ADARA::Parser::bufferParse;
+  using ADARA::Parser::rxPacket;
+
+  bool rxPacket(const ADARA::BankedEventPkt &pkt) override {
+    ++bankedEventPackets;
+    events += pkt.firstEvent() ? 1 : 0;
+    while (pkt.nextEvent())
+      ++events;
+    return false;
+  }
+
+  int bankedEventPackets{0};
+  int events{0};
+};
+
+/// Runs a function on a Poco::Thread
+class FunctionRunnable : public Poco::Runnable {
+public:
+  explicit FunctionRunnable(std::function<void()> function) : m_function(std::move(function)) {}
+  void run() override { m_function(); }
+
+private:
+  std::function<void()> m_function;
+};
+} // namespace
+
+class ADARAChunkRingTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ADARAChunkRingTest *createSuite() { return new ADARAChunkRingTest(); }
+  static void destroySuite(ADARAChunkRingTest *suite) { delete suite; }
+
+  void test_constructor_throws_for_empty_ring() {
+    TS_ASSERT_THROWS(ADARAChunkRing(0, 16), const std::invalid_argument &);
+    TS_ASSERT_THROWS(ADARAChunkRing(2, 0), const std::invalid_argument &);
+  }
+
+  void test_chunks_arrive_in_order() {
+    ADARAChunkRing ring(2, 16);
+    auto *first = ring.acquire();
+    first->data[0] = 1;
+    first->length = 1;
+    auto *second = ring.acquire();
+    second->data[0] = 2;
+    second->length = 1;
+    ring.submit(first);
+    ring.submit(second);
+
+    auto *chunk = ring.next(0ms);
+    TS_ASSERT_EQUALS(chunk, first);
+    ring.recycle(chunk);
+    chunk = ring.next(0ms);
+    TS_ASSERT_EQUALS(chunk, second);
+    ring.recycle(chunk);
+    TS_ASSERT(!ring.next(0ms));
+  }
+
+  void test_empty_chunks_are_not_passed_on() {
+    ADARAChunkRing ring(1, 16);
+    ring.submit(ring.acquire());
+    TS_ASSERT(!ring.next(0ms));
+    // The chunk went back to the free list
+    TS_ASSERT(ring.acquire());
+  }
+
+  void test_close_keeps_submitted_chunks() {
+    ADARAChunkRing ring(2, 16);
+    auto *chunk = ring.acquire();
+    chunk->length = 4;
+    ring.submit(chunk);
+    ring.close();
+    TS_ASSERT(ring.isClosed());
+    TS_ASSERT(!ring.isDrained());
+    TS_ASSERT(!ring.acquire());
+
+    TS_ASSERT_EQUALS(ring.next(0ms), chunk);
+    TS_ASSERT(ring.isDrained());
+    TS_ASSERT(!ring.next(0ms));
+  }
+
+  void test_close_wakes_a_waiting_producer() {
+    ADARAChunkRing ring(1, 16);
+    auto *chunk = ring.acquire();
+    ADARAChunkRing::Chunk *acquired = chunk;
+    FunctionRunnable acquire([&ring, &acquired] { acquired = ring.acquire(); });
+    Poco::Thread producer;
+    producer.start(acquire);
+    ring.close();
+    producer.join();
+    TS_ASSERT(!acquired);
+  }
+
+  void test_readInto_passes_exceptions_on_without_closing() {
+    ADARAChunkRing ring(1, 16);
+    std::atomic<bool> stop{false};
+    auto read = [](uint8_t *, int) -> int { throw std::runtime_error("lost connection"); };
+    TS_ASSERT_THROWS(ring.readInto(read, stop), const std::runtime_error &);
+    TS_ASSERT(!ring.isClosed());
+    // The chunk being filled was given back
+    TS_ASSERT(ring.acquire());
+  }
+
+  void test_replay_a_stream_through_the_parser() {
+    // Several packets in small chunks, so that packets span chunk boundaries
+    std::string stream;
+    const int numberOfPackets = 5;
+    for (int i = 0; i < numberOfPackets; ++i)
+      stream.append(reinterpret_cast<const char *>(bankedEventPacket), sizeof(bankedEventPacket));
+    std::istringstream source(stream);
+    auto read = [&source](uint8_t *buffer, int length) -> int {
+      source.read(reinterpret_cast<char *>(buffer), length);
+      const auto count = static_cast<int>(source.gcount());
+      return count > 0 ? count : -1;
+    };
+
+    ADARAChunkRing ring(3, 40);
+    std::atomic<bool> stop{false};
+    FunctionRunnable readInto([&ring, &read, &stop] { ring.readInto(read, stop); });
+    Poco::Thread producer;
+    producer.start(readInto);
+
+    CountingParser parser;
+    std::string log;
+    while (!ring.isDrained()) {
+      auto *chunk = ring.next(100ms);
+      if (!chunk)
+        continue;
+      size_t offset = 0;
+      while (offset < chunk->length) {
+        const auto length = std::min(chunk->length - offset, static_cast<size_t>(parser.bufferFillLength()));
+        std::memcpy(parser.bufferFillAddress(), chunk->data.data() + offset, length);
+        parser.bufferBytesAppended(static_cast<unsigned>(length));
+        offset += length;
+        parser.bufferParse(log, 0);
+      }
+      ring.recycle(chunk);
+    }
+    producer.join();
+
+    TS_ASSERT_EQUALS(parser.bankedEventPackets, numberOfPackets);
+    TS_ASSERT_EQUALS(parser.events, 2 * numberOfPackets);
+  }
+};
@@ -74,6 +74,33 @@ public:
     }
   }
 
+  void testBankedEventPacketBanks() {
+    std::shared_ptr<ADARA::BankedEventPkt> pkt =
+        basicPacketTests<ADARA::BankedEventPkt>(bankedEventPacket, sizeof(bankedEventPacket), 728504567, 761741666);
+    if (pkt != nullptr) {
+      std::vector<ADARA::BankedEventPkt::Bank> banks;
+      pkt->banks(banks);
+      // The second source section has no banks
+      TS_ASSERT_EQUALS(banks.size(), 2);
+      if (banks.size() == 2) {
+        TS_ASSERT_EQUALS(banks[0].id, 0x02);
+        TS_ASSERT_EQUALS(banks[0].eventCount, 1);
+        TS_ASSERT(banks[0].isCorrected);
+        TS_ASSERT_EQUALS(banks[0].tofOffset, 1);
+        TS_ASSERT_EQUALS(banks[0].events[0].tof, 0x00023BD9);
+        TS_ASSERT_EQUALS(banks[0].events[0].pixel, 0x043C);
+        TS_ASSERT_EQUALS(banks[1].id, 0x13);
+        TS_ASSERT_EQUALS(banks[1].eventCount, 1);
+        TS_ASSERT_EQUALS(banks[1].events[0].tof, 0x00023F3A);
+        TS_ASSERT_EQUALS(banks[1].events[0].pixel, 0x49E2);
+      }
+      // The iteration state is left alone
+      const ADARA::Event *event = pkt->firstEvent();
+      TS_ASSERT(event);
+      TS_ASSERT_EQUALS(pkt->curBankId(), 0x02);
+    }
+  }
+
   void testBeamMonitorPacketParser() {
     std::shared_ptr<ADARA::BeamMonitorPkt> pkt =
         basicPacketTests<ADARA::BeamMonitorPkt>(beamMonitorPacket, sizeof(beamMonitorPacket), 728504567, 761741666);
@@ -7,12 +7,15 @@
 #pragma once
 
 #include "MantidAPI/AlgorithmFactory.h"
+#include "MantidAPI/Axis.h"
 #include "MantidAPI/FrameworkManager.h"
+#include "MantidAPI/LiveListener.h"
 #include "MantidAPI/LiveListenerFactory.h"
 #include "MantidAPI/Run.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidFrameworkTestHelpers/FacilityHelper.h"
+#include "MantidFrameworkTestHelpers/WorkspaceCreationHelper.h"
 #include "MantidGeometry/Instrument/ComponentInfo.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidLiveData/LoadLiveData.h"
@@ -49,6 +52,39 @@ public:
   }
 };
 
+/// Gives back a chunk of events spread evenly over a fixed range of TOF
+class TofRangeDataListener final : public API::LiveListener {
+public:
+  TofRangeDataListener(const double tofMin, const double tofMax) : m_tofMin(tofMin), m_tofMax(tofMax) {}
+
+  std::string name() const override { return "TestDataListener"; }
+  bool supportsHistory() const override { return false; }
+  bool buffersEvents() const override { return true; }
+  bool connect(const Poco::Net::SocketAddress &) override { return true; }
+  void start(Types::Core::DateAndTime) override {}
+  bool isConnected() override { return true; }
+  ILiveListener::RunStatus runStatus() override { return Running; }
+  int runNumber() const override { return 999; }
+
+  std::shared_ptr<Workspace> extractData() override {
+    auto ws = WorkspaceCreationHelper::createEventWorkspaceWithFullInstrument(1, 2);
+    ws->getAxis(0)->setUnit("TOF");
+    ws->mutableRun().addProperty("run_number", std::string("999"));
+    constexpr int numEvents = 100;
+    for (size_t wi = 0; wi < ws->getNumberHistograms(); ++wi) {
+      auto &events = ws->getSpectrum(wi);
+      for (int i = 0; i < numEvents; ++i)
+        events.addEventQuickly(Types::Event::TofEvent(m_tofMin + (m_tofMax - m_tofMin) * i / (numEvents - 1)));
+    }
+    ws->resetAllXToSingleBin();
+    return ws;
+  }
+
+private:
+  const double m_tofMin;
+  const double m_tofMax;
+};
+
 class LoadLiveDataTest : public CxxTest::TestSuite {
 public:
   // This pair of boilerplate methods prevent the suite being created statically
@@ -296,6 +332,54 @@ public:
                      wsRun.getPropertyValueAsType<int>(FakeInOutPropertyAlgorithm::MarkerLogName));
   }
 
+  //--------------------------------------------------------------------------------------------
+  /** Rebinning to fixed boundaries is additive, so only the new chunk is
+   * post-processed and added to the output */
+  void test_Add_PostProcessing_Is_Incremental_For_Mergeable_Algorithm() {
+    EventWorkspace_sptr ws1 = doExec<EventWorkspace>("Add", "", "", "Rebin", "Params=40e3, 1e3, 60e3");
+    EventWorkspace_sptr ws2 = doExec<EventWorkspace>("Add", "", "", "Rebin", "Params=40e3, 1e3, 60e3");
+    EventWorkspace_sptr ws_accum = AnalysisDataService::Instance().retrieveWS<EventWorkspace>("fake_accum");
+
+    TSM_ASSERT("The output was updated in place", ws1 == ws2);
+    TS_ASSERT_EQUALS(ws_accum->getNumberEvents(), 400);
+    TS_ASSERT_EQUALS(ws2->getNumberEvents(), 400);
+    TS_ASSERT_EQUALS(ws2->blocksize(), 20);
+    TS_ASSERT_DELTA(ws2->x(0)[0], 40e3, 1e-4);
+    TS_ASSERT_EQUALS(AnalysisDataService::Instance().size(), 2);
+  }
+
+  void test_Add_PostProcessing_Is_Recomputed_For_Algorithm_That_Is_Not_Mergeable() {
+    // A single bin width takes the range from the data
+    EventWorkspace_sptr ws1 = doExec<EventWorkspace>("Add", "", "", "Rebin", "Params=1e3");
+    EventWorkspace_sptr ws2 = doExec<EventWorkspace>("Add", "", "", "Rebin", "Params=1e3");
+
+    TSM_ASSERT("The output was recreated from the accumulation workspace", ws1 != ws2);
+    TS_ASSERT_EQUALS(ws2->getNumberEvents(), 400);
+    TS_ASSERT_EQUALS(AnalysisDataService::Instance().size(), 2);
+  }
+
+  /** Events added to the output of an incremental post-processing must stay
+   * within its bins when a later chunk covers a wider range */
+  void test_Add_PostProcessing_Incrementally_Updates_Default_Bins_Of_Events() {
+    for (const std::string postProcessing : {"SumSpectra", "ConvertUnits"}) {
+      AnalysisDataService::Instance().clear();
+      const std::string properties = postProcessing == "ConvertUnits" ? "Target=Wavelength" : "";
+      EventWorkspace_sptr ws1 = doExec<EventWorkspace>("Add", "", "", postProcessing, properties, true,
+                                                       std::make_shared<TofRangeDataListener>(40e3, 50e3));
+      const auto firstRange = ws1->x(0).rawData();
+      EventWorkspace_sptr ws2 = doExec<EventWorkspace>("Add", "", "", postProcessing, properties, true,
+                                                       std::make_shared<TofRangeDataListener>(20e3, 70e3));
+
+      TSM_ASSERT("The output was updated in place", ws1 == ws2);
+      TS_ASSERT_EQUALS(ws2->getNumberEvents(), 800);
+      TS_ASSERT_EQUALS(ws2->x(0).size(), 2);
+      TS_ASSERT_LESS_THAN(ws2->x(0).front(), firstRange.front());
+      TS_ASSERT_LESS_THAN(firstRange.back(), ws2->x(0).back());
+      TS_ASSERT_LESS_THAN_EQUALS(ws2->x(0).front(), ws2->getEventXMin());
+      TS_ASSERT_LESS_THAN_EQUALS(ws2->getEventXMax(), ws2->x(0).back());
+    }
+  }
+
   //--------------------------------------------------------------------------------------------
   /** Perform both chunk and post-processing*/
   void test_Chunk_and_PostProcessing() {
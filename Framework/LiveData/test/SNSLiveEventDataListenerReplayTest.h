@@ -0,0 +1,150 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/FrameworkManager.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidLiveData/ADARA/ADARA.h"
+#include "MantidLiveData/SNSLiveEventDataListener.h"
+
+#include <Poco/TemporaryFile.h>
+#include <Poco/Thread.h>
+
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using Mantid::DataObjects::EventWorkspace;
+using Mantid::LiveData::SNSLiveEventDataListener;
+
+namespace {
+/// Two pixels with detector IDs 1 and 2
+const std::string INSTRUMENT_XML = "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>"
+                                   "<instrument name=\"ReplayTest\" valid-from=\"1900-01-31 23:59:59\" "
+                                   "valid-to=\"2100-01-31 23:59:59\" last-modified=\"2010-10-06T16:21:30\">"
+                                   "<defaults />"
+                                   "<component type=\"pixel\" idlist=\"pixels\">"
+                                   "<location x=\"0\" z=\"1\" />"
+                                   "<location x=\"1\" z=\"1\" />"
+                                   "</component>"
+                                   "<type is=\"detector\" name=\"pixel\">"
+                                   "<cuboid id=\"pixel-shape\" />"
+                                   "<algebra val=\"pixel-shape\"/>"
+                                   "</type>"
+                                   "<idlist idname=\"pixels\">"
+                                   "<id start=\"1\" end=\"2\" />"
+                                   "</idlist>"
+                                   "</instrument>";
+} // namespace
+
+/* Replays a recorded ADARA stream through SNSLiveEventDataListener, so the
+ * receiving thread, the chunk ring and the parsing thread are tested without
+ * an SMS to connect to. (SNSLiveEventDataListenerTest needs the network.) */
+class SNSLiveEventDataListenerReplayTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static SNSLiveEventDataListenerReplayTest *createSuite() { return new SNSLiveEventDataListenerReplayTest(); }
+  static void destroySuite(SNSLiveEventDataListenerReplayTest *suite) { delete suite; }
+
+  SNSLiveEventDataListenerReplayTest() { Mantid::API::FrameworkManager::Instance(); }
+
+  void test_replayFile_fails_for_missing_file() {
+    SNSLiveEventDataListener listener;
+    TS_ASSERT(!listener.replayFile("not_an_adara_stream.adara"));
+    TS_ASSERT(!listener.isConnected());
+  }
+
+  void test_replay_recorded_stream() {
+    // Enough events for the stream to fill several chunks of the ring, so
+    // that packets span chunk boundaries
+    const uint32_t numberOfPulses = 100;
+    const uint32_t eventsPerBank = 500;
+    Poco::TemporaryFile file;
+    writeStream(file.path(), numberOfPulses, eventsPerBank);
+
+    SNSLiveEventDataListener listener;
+    TS_ASSERT(listener.replayFile(file.path()));
+    TS_ASSERT(listener.isConnected());
+    listener.start(0);
+
+    // extractData() waits for the workspace to be initialized from the
+    // geometry, beamline info and run status packets
+    const size_t expectedEvents = 2 * numberOfPulses * eventsPerBank;
+    size_t events = 0;
+    std::vector<size_t> eventsPerSpectrum(2, 0);
+    for (int attempt = 0; attempt < 100 && events < expectedEvents; ++attempt) {
+      const auto buffer = std::dynamic_pointer_cast<EventWorkspace>(listener.extractData());
+      TS_ASSERT(buffer);
+      TS_ASSERT_EQUALS(buffer->getNumberHistograms(), 2);
+      for (size_t i = 0; i < buffer->getNumberHistograms(); ++i)
+        eventsPerSpectrum[i] += buffer->getSpectrum(i).getNumberEvents();
+      events += buffer->getNumberEvents();
+      if (events < expectedEvents)
+        Poco::Thread::sleep(100);
+    }
+
+    TS_ASSERT_EQUALS(events, expectedEvents);
+    TS_ASSERT_EQUALS(eventsPerSpectrum[0], numberOfPulses * eventsPerBank);
+    TS_ASSERT_EQUALS(eventsPerSpectrum[1], numberOfPulses * eventsPerBank);
+    TS_ASSERT_EQUALS(listener.runNumber(), 42);
+  }
+
+private:
+  /// Write a stream with the packets the SMS sends at the start of a run,
+  /// followed by one banked event packet per pulse with a bank for each of
+  /// the two pixels
+  void writeStream(const std::string &filename, const uint32_t numberOfPulses, const uint32_t eventsPerBank) {
+    using ADARA::PacketType::Type;
+    const uint32_t seconds = 1000;
+    std::string stream;
+    appendPacket(stream, Type::GEOMETRY_TYPE, seconds,
+                 stringPayload(static_cast<uint32_t>(INSTRUMENT_XML.size()), INSTRUMENT_XML));
+    // the beamline id, short name and long name, with their lengths packed in one field
+    const std::string id("BL99"), shortName("REPLAY"), longName("ReplayTest");
+    const auto sizes = static_cast<uint32_t>(longName.size() | shortName.size() << 8 | id.size() << 16);
+    appendPacket(stream, Type::BEAMLINE_INFO_TYPE, seconds, stringPayload(sizes, id + shortName + longName));
+    // run number, run start and the status in the top byte of the file number
+    appendPacket(stream, Type::RUN_STATUS_TYPE, seconds, {42, seconds, ADARA::RunStatus::STATE << 24});
+
+    for (uint32_t pulse = 0; pulse < numberOfPulses; ++pulse) {
+      // pulse charge, pulse energy, cycle and flags
+      std::vector<uint32_t> payload{10, 0, pulse, 0};
+      // one source with corrected times of flight and two banks
+      payload.insert(payload.end(), {1, 0, 0x80000000, 2});
+      for (uint32_t pixel = 1; pixel <= 2; ++pixel) {
+        payload.insert(payload.end(), {pixel, eventsPerBank});
+        for (uint32_t event = 0; event < eventsPerBank; ++event)
+          payload.insert(payload.end(), {10 * (event + 1), pixel});
+      }
+      appendPacket(stream, Type::BANKED_EVENT_TYPE, seconds + 1 + pulse, payload);
+    }
+
+    std::ofstream out(filename, std::ios::binary);
+    out.write(stream.data(), static_cast<std::streamsize>(stream.size()));
+  }
+
+  /// Append a version 0 packet to a stream
+  void appendPacket(std::string &stream, const ADARA::PacketType::Type type, const uint32_t seconds,
+                    const std::vector<uint32_t> &payload) {
+    const uint32_t header[4] = {static_cast<uint32_t>(payload.size() * sizeof(uint32_t)), ADARA_PKT_TYPE(type, 0),
+                                seconds, 0};
+    stream.append(reinterpret_cast<const char *>(header), sizeof(header));
+    stream.append(reinterpret_cast<const char *>(payload.data()), payload.size() * sizeof(uint32_t));
+  }
+
+  /// A field followed by text padded to a whole number of fields
+  std::vector<uint32_t> stringPayload(const uint32_t field, const std::string &text) {
+    std::vector<uint32_t> payload(1 + (text.size() + 3) / 4, 0);
+    payload[0] = field;
+    std::memcpy(payload.data() + 1, text.data(), text.size());
+    return payload;
+  }
+};
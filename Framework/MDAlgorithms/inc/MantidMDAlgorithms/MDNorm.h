@@ -58,8 +58,8 @@ private:
   std::vector<coord_t> getValuesFromOtherDimensions(bool &skipNormalization, uint16_t expInfoIndex = 0) const;
 
   void cacheDimensionXValues();
-  void calculateNormalization(const std::vector<coord_t> &otherValues, const Geometry::SymmetryOperation &so,
-                              uint16_t expInfoIndex, size_t soIndex);
+  void calculateNormalization(const std::vector<coord_t> &otherValues,
+                              const std::vector<Geometry::SymmetryOperation> &symmetryOps, uint16_t expInfoIndex);
 
   void calculateIntersections(std::vector<std::array<double, 4>> &intersections, const double theta, const double phi,
                               const Kernel::DblMatrix &transform, double lowvalue, double highvalue);
@@ -75,10 +75,13 @@ private:
   Mantid::Kernel::DblMatrix calQTransform(const Mantid::API::ExperimentInfo &currentExpInfo,
                                           const Geometry::SymmetryOperation &so);
 
+  /// Per-block or shared accumulation of normalization values
+  class NormAccumulator;
+
   void calcSingleDetectorNorm(const std::vector<std::array<double, 4>> &intersections, const double &solid,
                               std::vector<double> &yValues, const size_t &vmdDims, std::vector<coord_t> &pos,
-                              std::vector<coord_t> &posNew, std::vector<std::atomic<signal_t>> &signalArray,
-                              const double &solidBkgd, std::vector<std::atomic<signal_t>> &bkgdSignalArray);
+                              std::vector<coord_t> &posNew, const size_t block, NormAccumulator &signalArray,
+                              const double &solidBkgd, NormAccumulator &bkgdSignalArray);
 
   API::IMDWorkspace_sptr divideMD(const API::IMDHistoWorkspace_sptr &lhs, const API::IMDHistoWorkspace_sptr &rhs,
                                   const std::string &outputwsname, const double &startProgress,
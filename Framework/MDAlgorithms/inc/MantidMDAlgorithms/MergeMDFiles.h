@@ -54,7 +54,7 @@ private:
 
   void finalizeOutput(const std::string &outputFile);
 
-  uint64_t loadEventsFromSubBoxes(API::IMDNode *TargetBox);
+  uint64_t loadEventsFromSubBoxes(API::IMDNode *TargetBox, std::vector<coord_t> &readBuffer);
 
   // the class which flatten the box structure and deal with it
   DataObjects::MDBoxFlatTree m_BoxStruct;
@@ -25,12 +25,15 @@
 #include "MantidKernel/CompositeValidator.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Exception.h"
+#include "MantidKernel/Memory.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/UnitLabelTypes.h"
 #include "MantidKernel/VectorHelper.h"
 #include "MantidKernel/VisibleWhenProperty.h"
 
 #include <algorithm>
+#include <iterator>
 #include <boost/lexical_cast.hpp>
 
 namespace Mantid::MDAlgorithms {
@@ -56,6 +59,44 @@ static bool abs_compare(double a, double b) { return (std::fabs(a) < std::fabs(b
 // Register the algorithm into the AlgorithmFactory
 DECLARE_ALGORITHM(MDNorm)
 
+/** Accumulates normalization contributions from many threads. The detectors
+ * are split into one block per thread, and each block either adds into its own
+ * private grid, with all grids summed at the end, or, when there is not enough
+ * memory for one grid per block, directly into a shared grid of atomics.
+ */
+class MDNorm::NormAccumulator {
+public:
+  NormAccumulator(const size_t nPoints, const size_t nBlocks, const bool privateGrids)
+      : m_nPoints(nPoints),
+        m_blockGrids(privateGrids ? nBlocks : 0, std::vector<signal_t>(privateGrids ? nPoints : 0, 0.)),
+        m_sharedGrid(privateGrids ? 0 : nPoints) {}
+
+  void add(const size_t block, const size_t index, const signal_t value) {
+    if (m_blockGrids.empty())
+      Mantid::Kernel::AtomicOp(m_sharedGrid[index], value, std::plus<signal_t>());
+    else
+      m_blockGrids[block][index] += value;
+  }
+
+  /// Write the accumulated values to output, or add them to it if accumulate is set
+  void reduceInto(signal_t *output, const bool accumulate) const {
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < static_cast<int64_t>(m_nPoints); ++i) {
+      signal_t sum = accumulate ? output[i] : 0.;
+      if (m_blockGrids.empty())
+        sum += m_sharedGrid[i];
+      for (const auto &grid : m_blockGrids)
+        sum += grid[i];
+      output[i] = sum;
+    }
+  }
+
+private:
+  size_t m_nPoints;
+  std::vector<std::vector<signal_t>> m_blockGrids;
+  std::vector<std::atomic<signal_t>> m_sharedGrid;
+};
+
 //----------------------------------------------------------------------------------------------
 /**
  * Constructor
@@ -524,12 +565,7 @@ void MDNorm::exec() {
     cacheDimensionXValues();
 
     if (!skipNormalization) {
-      size_t symmOpsIndex = 0;
-      for (const auto &so : symmetryOps) {
-        calculateNormalization(otherValues, so, expInfoIndex, symmOpsIndex);
-        symmOpsIndex++;
-      }
-
+      calculateNormalization(otherValues, symmetryOps, expInfoIndex);
     } else {
       g_log.warning("Binning limits are outside the limits of the MDWorkspace. "
                     "Not applying normalization.");
@@ -1380,6 +1416,7 @@ inline void MDNorm::calcDiffractionIntersectionIntegral(std::vector<std::array<d
  * @param vmdDims: MD dimensions
  * @param pos: position from intersecton for memory efficiency
  * @param posNew: transformed positions
+ * @param block: index of the block of detectors being processed
  * @param signalArray: (output) normalization
  * @param solidBkgd: background proton charge
  * @param bkgdSignalArray: (output) background normalization
@@ -1387,8 +1424,8 @@ inline void MDNorm::calcDiffractionIntersectionIntegral(std::vector<std::array<d
 inline void MDNorm::calcSingleDetectorNorm(const std::vector<std::array<double, 4>> &intersections, const double &solid,
                                            std::vector<double> &yValues, const size_t &vmdDims,
                                            std::vector<coord_t> &pos, std::vector<coord_t> &posNew,
-                                           std::vector<std::atomic<signal_t>> &signalArray, const double &solidBkgd,
-                                           std::vector<std::atomic<signal_t>> &bkgdSignalArray) {
+                                           const size_t block, NormAccumulator &signalArray, const double &solidBkgd,
+                                           NormAccumulator &bkgdSignalArray) {
 
   auto intersectionsBegin = intersections.begin();
   for (auto it = intersectionsBegin + 1; it != intersections.end(); ++it) {
@@ -1447,24 +1484,25 @@ inline void MDNorm::calcSingleDetectorNorm(const std::vector<std::array<double,
 
     // Set to output
     // set the calculated signal to
-    Mantid::Kernel::AtomicOp(signalArray[linIndex], signal, std::plus<signal_t>());
+    signalArray.add(block, linIndex, signal);
     // [Task 89]
     if (m_backgroundWS)
-      Mantid::Kernel::AtomicOp(bkgdSignalArray[linIndex], bkgdSignal, std::plus<signal_t>());
+      bkgdSignalArray.add(block, linIndex, bkgdSignal);
   }
   return;
 }
 
 /**
- * Computed the normalization for the input workspace. Results are stored in
+ * Computed the normalization for the input workspace for all symmetry
+ * operations in a single pass over the detectors. Results are stored in
  * m_normWS
  * @param otherValues - values for dimensions other than Q or DeltaE
- * @param so - symmetry operation
+ * @param symmetryOps - symmetry operations
  * @param expInfoIndex - current experiment info index
- * @param soIndex - the index of symmetry operation (for progress purposes only)
  */
-void MDNorm::calculateNormalization(const std::vector<coord_t> &otherValues, const Geometry::SymmetryOperation &so,
-                                    uint16_t expInfoIndex, size_t soIndex) {
+void MDNorm::calculateNormalization(const std::vector<coord_t> &otherValues,
+                                    const std::vector<Geometry::SymmetryOperation> &symmetryOps,
+                                    uint16_t expInfoIndex) {
   const auto &currentExptInfo = *(m_inputWS->getExperimentInfo(expInfoIndex));
   std::vector<double> lowValues, highValues;
   auto *lowValuesLog = dynamic_cast<VectorDoubleProperty *>(currentExptInfo.getLog("MDNorm_low"));
@@ -1472,9 +1510,12 @@ void MDNorm::calculateNormalization(const std::vector<coord_t> &otherValues, con
   auto *highValuesLog = dynamic_cast<VectorDoubleProperty *>(currentExptInfo.getLog("MDNorm_high"));
   highValues = (*highValuesLog)();
 
-  // calculate Q transformation matrix (R * UB * SymmetryOperation * m_W)^-1
+  // calculate Q transformation matrices (R * UB * SymmetryOperation * m_W)^-1
   // in order to calculate intersections
-  DblMatrix Qtransform = calQTransform(currentExptInfo, so);
+  std::vector<DblMatrix> Qtransforms;
+  Qtransforms.reserve(symmetryOps.size());
+  std::transform(symmetryOps.cbegin(), symmetryOps.cend(), std::back_inserter(Qtransforms),
+                 [this, &currentExptInfo](const auto &so) { return calQTransform(currentExptInfo, so); });
 
   // get proton charges
   const double protonCharge = currentExptInfo.run().getProtonCharge();
@@ -1497,107 +1538,110 @@ void MDNorm::calculateNormalization(const std::vector<coord_t> &otherValues, con
   const detid2index_map fluxDetToIdx =
       (m_diffraction) ? integrFlux->getDetectorIDToWorkspaceIndexMap() : detid2index_map();
 
-  // Define dimension, signal array
+  // Define dimension
   const size_t vmdDims = (m_diffraction) ? 3 : 4;
-  std::vector<std::atomic<signal_t>> signalArray(m_normWS->getNPoints());
-
-  size_t numNPoints = (m_backgroundWS) ? m_bkgdNormWS->getNPoints() : 0;
-  if (m_backgroundWS && numNPoints != m_normWS->getNPoints()) {
+  const size_t numNPoints = m_normWS->getNPoints();
+  if (m_backgroundWS && m_bkgdNormWS->getNPoints() != numNPoints) {
     throw std::runtime_error("N points are different");
   }
-  std::vector<std::atomic<signal_t>> bkgdSignalArray(numNPoints);
 
+  // muliple threading
+  bool safe = m_diffraction ? Kernel::threadSafe(*integrFlux) : true;
+  const auto maxBlocks = static_cast<size_t>(safe ? PARALLEL_GET_MAX_THREADS : 1);
+  const Kernel::ThreadBlocks blocks(static_cast<size_t>(ndets), maxBlocks);
+  const auto numBlocks = static_cast<int64_t>(blocks.size());
+  // Private per-block grids avoid contended atomic updates of the same bins,
+  // but are only used when one copy per block fits comfortably in memory
+  const size_t gridKiB = numNPoints * sizeof(signal_t) * (m_backgroundWS ? 2 : 1) / 1024;
+  const bool privateGrids = numBlocks == 1 || blocks.size() * gridKiB < Kernel::MemoryStats().availMem() / 4;
+  NormAccumulator signalArray(numNPoints, blocks.size(), privateGrids);
+  NormAccumulator bkgdSignalArray(m_backgroundWS ? numNPoints : 0, blocks.size(), privateGrids);
+
+  // Buffers reused for every detector and symmetry operation handled by a thread
   std::vector<std::array<double, 4>> intersections;
   std::vector<double> xValues, yValues;
   std::vector<coord_t> pos, posNew;
 
   // Progress report
-  double progStep = 0.7 / static_cast<double>(m_numExptInfos * m_numSymmOps);
-  auto progIndex = static_cast<double>(soIndex + expInfoIndex * m_numSymmOps);
+  double progStep = 0.7 / static_cast<double>(m_numExptInfos);
+  auto progIndex = static_cast<double>(expInfoIndex);
   auto prog =
       std::make_unique<API::Progress>(this, 0.3 + progStep * progIndex, 0.3 + progStep * (1. + progIndex), ndets);
-  // muliple threading
-  bool safe = m_diffraction ? Kernel::threadSafe(*integrFlux) : true;
 
 PRAGMA_OMP(parallel for private(intersections, xValues, yValues, pos, posNew) if (safe))
-for (int64_t i = 0; i < ndets; i++) {
-  PARALLEL_START_INTERRUPT_REGION
-
-  // Skip: non-existing detector, monitor and masked detector
-  if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i) || spectrumInfo.isMasked(i)) {
-    continue;
-  }
-
-  const auto &detector = spectrumInfo.detector(i);
-  double theta = detector.getTwoTheta(m_samplePos, m_beamDir);
-  double phi = detector.getPhi();
-  // If the dtefctor is a group, this should be the ID of the first detector
-  const auto detID = detector.getID();
-
-  // get the flux spectrum number: this is for diffraction only!
-  size_t wsIdx = 0;
-  if (m_diffraction) {
-    auto index = fluxDetToIdx.find(detID);
-    if (index != fluxDetToIdx.end()) {
-      wsIdx = index->second;
-    } else { // masked detector in flux, but not in input workspace
+for (int64_t b = 0; b < numBlocks; ++b) {
+  const auto block = static_cast<size_t>(b);
+  const auto end = static_cast<int64_t>(blocks.end(block));
+  for (auto i = static_cast<int64_t>(blocks.begin(block)); i < end; i++) {
+    PARALLEL_START_INTERRUPT_REGION
+
+    // Skip: non-existing detector, monitor and masked detector
+    if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i) || spectrumInfo.isMasked(i)) {
       continue;
     }
-  }
 
-  // Intersections for sample and background if present
-  this->calculateIntersections(intersections, theta, phi, Qtransform, lowValues[i], highValues[i]);
+    const auto &detector = spectrumInfo.detector(i);
+    double theta = detector.getTwoTheta(m_samplePos, m_beamDir);
+    double phi = detector.getPhi();
+    // If the dtefctor is a group, this should be the ID of the first detector
+    const auto detID = detector.getID();
 
-  // No need to do normalization calculation if there is no intersection
-  if (intersections.empty())
-    continue;
+    // get the flux spectrum number: this is for diffraction only!
+    size_t wsIdx = 0;
+    if (m_diffraction) {
+      auto index = fluxDetToIdx.find(detID);
+      if (index != fluxDetToIdx.end()) {
+        wsIdx = index->second;
+      } else { // masked detector in flux, but not in input workspace
+        continue;
+      }
+    }
 
-  // Get solid angle for this contribution
-  double solid = protonCharge;
-  // [Task 89]
-  double bkgdSolid = protonChargeBkgd;
-  if (haveSA) {
-    double solid_angle_factor = solidAngleWS->y(solidAngDetToIdx.find(detID)->second)[0];
-    //  solidAngleWS->y(solidAngDetToIdx.find(detID)->second)[0]
-    solid = solid_angle_factor * protonCharge;
+    // Get solid angle for this contribution
+    double solid = protonCharge;
     // [Task 89]
-    bkgdSolid = solid_angle_factor * protonChargeBkgd;
-  }
+    double bkgdSolid = protonChargeBkgd;
+    if (haveSA) {
+      double solid_angle_factor = solidAngleWS->y(solidAngDetToIdx.find(detID)->second)[0];
+      //  solidAngleWS->y(solidAngDetToIdx.find(detID)->second)[0]
+      solid = solid_angle_factor * protonCharge;
+      // [Task 89]
+      bkgdSolid = solid_angle_factor * protonChargeBkgd;
+    }
 
-  if (m_diffraction) {
-    // -- calculate integrals for the intersection --
-    calcDiffractionIntersectionIntegral(intersections, xValues, yValues, *integrFlux, wsIdx);
-  }
+    // Compute final position in HKL
+    // pre-allocate for efficiency and copy non-hkl dim values into place
+    pos.resize(vmdDims + otherValues.size());
+    std::copy(otherValues.begin(), otherValues.end(), pos.begin() + vmdDims);
+
+    for (const auto &Qtransform : Qtransforms) {
+      // Intersections for sample and background if present
+      this->calculateIntersections(intersections, theta, phi, Qtransform, lowValues[i], highValues[i]);
 
-  // Compute final position in HKL
-  // pre-allocate for efficiency and copy non-hkl dim values into place
-  pos.resize(vmdDims + otherValues.size());
-  std::copy(otherValues.begin(), otherValues.end(), pos.begin() + vmdDims);
+      // No need to do normalization calculation if there is no intersection
+      if (intersections.empty())
+        continue;
+
+      if (m_diffraction) {
+        // -- calculate integrals for the intersection --
+        calcDiffractionIntersectionIntegral(intersections, xValues, yValues, *integrFlux, wsIdx);
+      }
 
-  calcSingleDetectorNorm(intersections, solid, yValues, vmdDims, pos, posNew, signalArray, bkgdSolid,
-                         bkgdSignalArray); // [Task 89] ADD solidBkgd, bkgdYValues, bkgdSignalArray
+      calcSingleDetectorNorm(intersections, solid, yValues, vmdDims, pos, posNew, block, signalArray, bkgdSolid,
+                             bkgdSignalArray); // [Task 89] ADD solidBkgd, bkgdYValues, bkgdSignalArray
+    }
 
-  prog->report();
+    prog->report();
 
-  PARALLEL_END_INTERRUPT_REGION
+    PARALLEL_END_INTERRUPT_REGION
+  }
 }
 PARALLEL_CHECK_INTERRUPT_REGION
-if (m_accumulate) {
-  std::transform(signalArray.cbegin(), signalArray.cend(), m_normWS->getSignalArray(), m_normWS->mutableSignalArray(),
-                 [](const std::atomic<signal_t> &a, const signal_t &b) { return a + b; });
-  // [Task 89] Process background
-  if (m_backgroundWS)
-    std::transform(bkgdSignalArray.cbegin(), bkgdSignalArray.cend(), m_bkgdNormWS->getSignalArray(),
-                   m_bkgdNormWS->mutableSignalArray(),
-                   [](const std::atomic<signal_t> &a, const signal_t &b) { return a + b; });
-
-} else {
-  // First time, init
-  std::copy(signalArray.cbegin(), signalArray.cend(), m_normWS->mutableSignalArray());
-  // [Task 89]
-  if (m_backgroundWS)
-    std::copy(bkgdSignalArray.cbegin(), bkgdSignalArray.cend(), m_bkgdNormWS->mutableSignalArray());
-}
+// Sum the per-block contributions, adding to earlier experiment infos if accumulating
+signalArray.reduceInto(m_normWS->mutableSignalArray(), m_accumulate);
+// [Task 89] Process background
+if (m_backgroundWS)
+  bkgdSignalArray.reduceInto(m_bkgdNormWS->mutableSignalArray(), m_accumulate);
 m_accumulate = true;
 }
 
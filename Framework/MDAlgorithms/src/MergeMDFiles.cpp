@@ -11,6 +11,7 @@
 #include "MantidDataObjects/MDBoxBase.h"
 #include "MantidDataObjects/MDEventFactory.h"
 #include "MantidKernel/CPUTimer.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/VectorHelper.h"
@@ -143,9 +144,12 @@ void MergeMDFiles::loadBoxData() {
 
 /** Task that loads all of the events from corresponded boxes of all files
  * that is being merged into a particular box in the output workspace.
+ * @param TargetBox :: the box in the output workspace
+ * @param readBuffer :: scratch space for the raw event data, reused between
+ * calls from the same thread
  */
 
-uint64_t MergeMDFiles::loadEventsFromSubBoxes(API::IMDNode *TargetBox) {
+uint64_t MergeMDFiles::loadEventsFromSubBoxes(API::IMDNode *TargetBox, std::vector<coord_t> &readBuffer) {
   /// get rid of the events and averages which are in the memory erroneously
   /// (from cloning)
   TargetBox->clear();
@@ -167,7 +171,7 @@ uint64_t MergeMDFiles::loadEventsFromSubBoxes(API::IMDNode *TargetBox) {
     uint64_t fileLocation = m_fileComponentsStructure[iw].getEventIndex()[2 * ID + 0];
     if (numFileEvents[iw] == 0)
       continue;
-    TargetBox->loadAndAddFrom(m_EventLoader[iw], fileLocation, numFileEvents[iw]);
+    TargetBox->loadAndAddFrom(m_EventLoader[iw], fileLocation, numFileEvents[iw], readBuffer);
   }
 
   return nBoxEvents;
@@ -186,9 +190,6 @@ void MergeMDFiles::doExecByCloning(const Mantid::API::IMDEventWorkspace_sptr &ws
   m_OutIWS = ws;
   m_MDEventType = ws->getEventTypeName();
 
-  // Run the tasks in parallel? TODO: enable
-  // bool Parallel = this->getProperty("Parallel");
-
   // Fix the box controller settings in the output workspace so that it splits
   // normally
   BoxController_sptr bc = ws->getBoxController();
@@ -223,64 +224,47 @@ void MergeMDFiles::doExecByCloning(const Mantid::API::IMDEventWorkspace_sptr &ws
   m_progress = std::make_unique<Progress>(this, 0.1, 0.9, size_t(numBoxes));
   m_progress->setNotifyStep(0.1);
 
-  // For tracking progress
-  // uint64_t m_totalEventsInTasks = 0;
-
-  // Prepare thread pool
   CPUTimer overallTime;
 
-  auto ts = new ThreadSchedulerFIFO();
-  ThreadPool tp(ts);
-
   Kernel::DiskBuffer *DiskBuf(nullptr);
   if (m_fileBasedTargetWS) {
     DiskBuf = bc->getFileIO();
   }
 
+  // Every output box gets the events of the same box in all input files and
+  // is written at a pre-calculated position, so boxes are independent of each
+  // other. Box sizes vary a lot, hence the dynamic schedule. Each thread holds
+  // at most one box and one read buffer in memory; the box is written out and
+  // released as soon as it is complete.
+  const bool parallel = getProperty("Parallel");
   this->m_totalLoaded = 0;
   const std::vector<API::IMDNode *> &boxes = m_BoxStruct.getBoxes();
+  std::vector<std::vector<coord_t>> readBuffers(parallel ? PARALLEL_GET_MAX_THREADS : 1);
 
-  for (size_t ib = 0; ib < numBoxes; ib++) {
+  PARALLEL_SET_CONFIG_THREADS
+  PRAGMA_OMP(parallel for schedule(dynamic, 1) if (parallel))
+  for (int64_t ib = 0; ib < static_cast<int64_t>(numBoxes); ib++) {
+    PARALLEL_START_INTERRUPT_REGION
     auto box = boxes[ib];
-    if (!box->isBox())
-      continue;
-    // load all contributed events into current box;
-    this->loadEventsFromSubBoxes(box);
+    if (box->isBox()) {
+      // load all contributed events into current box;
+      this->loadEventsFromSubBoxes(box, readBuffers[parallel ? PARALLEL_THREAD_NUMBER : 0]);
 
-    if (DiskBuf) {
-      if (box->getDataInMemorySize() > 0) { // data position has been already pre-calculated
+      // data position has been already pre-calculated
+      if (DiskBuf && box->getDataInMemorySize() > 0) {
         box->getISaveable()->save();
         box->clearDataFromMemory();
-        // Kernel::ISaveable *Saver = box->getISaveable();
-        // DiskBuf->toWrite(Saver);
       }
     }
-    // else
-    //{   size_t ID = box->getID();
-    //    uint64_t filePosition = targetEventIndexes[2*ID];
-    //    box->saveAt(saver.get(), filePosition);
-    //}
-    //
-    // if (!Parallel)
-    //{
-    //  // Run the task serially only
-    //  task->run();
-    //  delete task;
-    //}
-    // else
-    //{
-    //  // Enqueue to run in parallel (at the joinAll() call below).
-    //  ts->push(task);
-    //}
-
-    m_progress->reportIncrement(ib, "Loading and merging box data");
+    m_progress->report("Loading and merging box data");
+    PARALLEL_END_INTERRUPT_REGION
   }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
   if (DiskBuf) {
     DiskBuf->flushCache();
     bc->getFileIO()->flushData();
   }
-  //// Run any final tasks
-  // tp.joinAll();
   g_log.information() << overallTime << " to do all the adding.\n";
 
   // Close any open file handle
@@ -14,6 +14,7 @@
 #include "MantidPythonInterface/api/PythonAlgorithm/AlgorithmAdapter.h"
 #include "MantidPythonInterface/core/Converters/PySequenceToVector.h"
 #include "MantidPythonInterface/core/IsNone.h"
+#include "MantidPythonInterface/core/ReleaseGlobalInterpreterLock.h"
 
 namespace Mantid {
 namespace PythonInterface {
@@ -40,6 +41,14 @@ public:
   /// Disable assignment operator
   DataProcessorAdapter &operator=(const DataProcessorAdapter &) = delete;
 
+  /// Load a chunk with the Python loadChunk, if there is one
+  API::MatrixWorkspace_sptr loadChunk(const size_t rowIndex) override;
+  /// Process a chunk with the Python processChunk, if there is one
+  API::MatrixWorkspace_sptr processChunk(const API::MatrixWorkspace_sptr &chunk, const size_t rowIndex) override;
+  /// Accumulate a chunk with the Python accumulateChunk, if there is one
+  API::MatrixWorkspace_sptr accumulateChunk(const API::MatrixWorkspace_sptr &accumulated,
+                                            const API::MatrixWorkspace_sptr &chunk, const size_t rowIndex) override;
+
   // -------------------- Pass through methods ----------------------------
   // Boost.python needs public access to the base class methods in order to
   // be able to call them. We should just be able to put a using declaration
@@ -56,7 +65,26 @@ public:
 
   API::ITableWorkspace_sptr determineChunkProxy(const std::string &filename) { return this->determineChunk(filename); }
 
-  void loadChunkProxy(const size_t rowIndex) { this->loadChunk(rowIndex); }
+  // The hooks below call the base class, as the adapter overrides call Python
+
+  API::MatrixWorkspace_sptr loadChunkProxy(const size_t rowIndex) {
+    return API::GenericDataProcessorAlgorithm<Base>::loadChunk(rowIndex);
+  }
+
+  API::MatrixWorkspace_sptr processChunkProxy(const API::MatrixWorkspace_sptr &chunk, const size_t rowIndex) {
+    return API::GenericDataProcessorAlgorithm<Base>::processChunk(chunk, rowIndex);
+  }
+
+  API::MatrixWorkspace_sptr accumulateChunkProxy(const API::MatrixWorkspace_sptr &accumulated,
+                                                 const API::MatrixWorkspace_sptr &chunk, const size_t rowIndex) {
+    return API::GenericDataProcessorAlgorithm<Base>::accumulateChunk(accumulated, chunk, rowIndex);
+  }
+
+  API::MatrixWorkspace_sptr processChunksProxy(const size_t numChunks, const size_t memoryBudget) {
+    // chunks loaded ahead call Python on another thread, which needs the GIL
+    ReleaseGlobalInterpreterLock releaseGIL;
+    return this->processChunks(numChunks, memoryBudget);
+  }
 
   void copyPropertiesProxy(const std::string &algName, const boost::python::object &propNames, const int version = -1) {
     if (algName.empty()) {
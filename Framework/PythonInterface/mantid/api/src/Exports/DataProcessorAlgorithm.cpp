@@ -48,7 +48,22 @@ template <class Base> void do_export(const std::string &name) {
            "the "
            "input file when processing in chunks")
 
-      .def("loadChunk", &Adapter::loadChunkProxy, (arg("self"), arg("row_index")), "Load a chunk of data")
+      .def("loadChunk", &Adapter::loadChunkProxy, (arg("self"), arg("row_index")),
+           "Load a chunk of data and return it. Override this to use processChunks")
+
+      .def("processChunk", &Adapter::processChunkProxy, (arg("self"), arg("chunk"), arg("row_index")),
+           "Process a loaded chunk before it is accumulated and return the result. The default returns the chunk "
+           "unchanged")
+
+      .def("accumulateChunk", &Adapter::accumulateChunkProxy,
+           (arg("self"), arg("accumulated"), arg("chunk"), arg("row_index")),
+           "Add a processed chunk to the output so far, None for the first chunk, and return the new output. The "
+           "default runs the accumulation algorithm set with setAccumAlg")
+
+      .def("processChunks", &Adapter::processChunksProxy, (arg("self"), arg("num_chunks"), arg("memory_budget") = 0),
+           "Load, process and accumulate the given number of chunks in order and return the output. With a "
+           "memory budget in bytes, chunks are loaded ahead on another thread while they fit in it, so loadChunk "
+           "must not change the state of the algorithm")
 
       .def("load", (loadOverload<Base>)&Adapter::loadProxy, (arg("self"), arg("input_data"), arg("load_quiet") = false),
            "Loads the given file or workspace data and returns the workspace. "
@@ -5,11 +5,32 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidPythonInterface/api/PythonAlgorithm/DataProcessorAdapter.h"
+#include "MantidPythonInterface/core/CallMethod.h"
+#include "MantidPythonInterface/core/ExtractSharedPtr.h"
+#include "MantidPythonInterface/core/GlobalInterpreterLock.h"
 
 //-----------------------------------------------------------------------------
 // AlgorithmAdapter definition
 //-----------------------------------------------------------------------------
 namespace Mantid::PythonInterface {
+using namespace boost::python;
+
+namespace {
+/**
+ * Extract the workspace returned by a Python chunk hook. The GIL must be held.
+ * @param result The object returned by the hook
+ * @param methodName The name of the hook, for the error message
+ * @return The workspace, or null if the hook returned None
+ */
+API::MatrixWorkspace_sptr extractChunk(const object &result, const char *methodName) {
+  if (isNone(result))
+    return API::MatrixWorkspace_sptr();
+  auto chunk = std::dynamic_pointer_cast<API::MatrixWorkspace>(ExtractSharedPtr<API::Workspace>(result)());
+  if (!chunk)
+    throw std::invalid_argument(std::string(methodName) + " must return a MatrixWorkspace");
+  return chunk;
+}
+} // namespace
 
 /**
  * Construct the "wrapper" and stores the reference to the PyObject
@@ -19,5 +40,59 @@ template <class Base>
 DataProcessorAdapter<Base>::DataProcessorAdapter(PyObject *self)
     : AlgorithmAdapter<API::GenericDataProcessorAlgorithm<Base>>(self) {}
 
+/**
+ * Load a chunk by calling loadChunk on the Python object. This may be called
+ * on a thread loading chunks ahead. If not overridden it calls the base class.
+ * @param rowIndex The index of the chunk
+ * @return The loaded chunk
+ */
+template <class Base> API::MatrixWorkspace_sptr DataProcessorAdapter<Base>::loadChunk(const size_t rowIndex) {
+  try {
+    GlobalInterpreterLock gil;
+    return extractChunk(callMethod<object>(this->getSelf(), "loadChunk", rowIndex), "loadChunk");
+  } catch (UndefinedAttributeError &) {
+    return API::GenericDataProcessorAlgorithm<Base>::loadChunk(rowIndex);
+  }
+}
+
+/**
+ * Process a chunk by calling processChunk on the Python object. If not
+ * overridden it calls the base class.
+ * @param chunk The loaded chunk
+ * @param rowIndex The index of the chunk
+ * @return The processed chunk
+ */
+template <class Base>
+API::MatrixWorkspace_sptr DataProcessorAdapter<Base>::processChunk(const API::MatrixWorkspace_sptr &chunk,
+                                                                   const size_t rowIndex) {
+  try {
+    GlobalInterpreterLock gil;
+    return extractChunk(callMethod<object>(this->getSelf(), "processChunk", chunk, rowIndex), "processChunk");
+  } catch (UndefinedAttributeError &) {
+    return API::GenericDataProcessorAlgorithm<Base>::processChunk(chunk, rowIndex);
+  }
+}
+
+/**
+ * Accumulate a chunk by calling accumulateChunk on the Python object. If not
+ * overridden it calls the base class.
+ * @param accumulated The output so far, None for the first chunk
+ * @param chunk The processed chunk
+ * @param rowIndex The index of the chunk
+ * @return The output including the chunk
+ */
+template <class Base>
+API::MatrixWorkspace_sptr DataProcessorAdapter<Base>::accumulateChunk(const API::MatrixWorkspace_sptr &accumulated,
+                                                                      const API::MatrixWorkspace_sptr &chunk,
+                                                                      const size_t rowIndex) {
+  try {
+    GlobalInterpreterLock gil;
+    return extractChunk(callMethod<object>(this->getSelf(), "accumulateChunk", accumulated, chunk, rowIndex),
+                        "accumulateChunk");
+  } catch (UndefinedAttributeError &) {
+    return API::GenericDataProcessorAlgorithm<Base>::accumulateChunk(accumulated, chunk, rowIndex);
+  }
+}
+
 template class DataProcessorAdapter<API::Algorithm>;
 } // namespace Mantid::PythonInterface
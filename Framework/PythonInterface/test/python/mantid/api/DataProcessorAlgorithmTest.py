@@ -6,7 +6,15 @@
 # SPDX - License - Identifier: GPL - 3.0 +
 import unittest
 from testhelpers import assertRaisesNothing
-from mantid.api import Algorithm, DataProcessorAlgorithm, AlgorithmFactory, AlgorithmManager, WorkspaceProperty
+from mantid.api import (
+    Algorithm,
+    DataProcessorAlgorithm,
+    AlgorithmFactory,
+    AlgorithmManager,
+    MatrixWorkspaceProperty,
+    WorkspaceFactory,
+    WorkspaceProperty,
+)
 from mantid.kernel import Direction
 
 
@@ -21,6 +29,33 @@ class TestDataProcessor(DataProcessorAlgorithm):
 # end v1 alg
 
 
+class ChunkedDataProcessor(DataProcessorAlgorithm):
+    """Loads chunks holding their index plus one and adds them up"""
+
+    def PyInit(self):
+        self.declareProperty("MemoryBudget", 0)
+        self.declareProperty(MatrixWorkspaceProperty("OutputWorkspace", "", Direction.Output))
+
+    def PyExec(self):
+        self.processed = []
+        self.setProperty("OutputWorkspace", self.processChunks(4, self.getProperty("MemoryBudget").value))
+
+    def loadChunk(self, row_index):
+        chunk = WorkspaceFactory.create("Workspace2D", 1, 1, 1)
+        chunk.dataY(0)[0] = row_index + 1
+        return chunk
+
+    def processChunk(self, chunk, row_index):
+        self.processed.append(row_index)
+        return chunk
+
+    def accumulateChunk(self, accumulated, chunk, row_index):
+        if accumulated is None:
+            return chunk
+        accumulated.dataY(0)[0] += chunk.readY(0)[0]
+        return accumulated
+
+
 class DataProcessorAlgorithmTest(unittest.TestCase):
     def test_DataProcessorAlgorithm_instance_inherits_Algorithm(self):
         alg = TestDataProcessor()
@@ -33,6 +68,9 @@ class DataProcessorAlgorithmTest(unittest.TestCase):
             "setAccumAlg",
             "determineChunk",
             "loadChunk",
+            "processChunk",
+            "accumulateChunk",
+            "processChunks",
             "load",
             "splitInput",
             "forwardProperties",
@@ -79,6 +117,23 @@ class DataProcessorAlgorithmTest(unittest.TestCase):
         alg.setPropertyValue("Workspace", "__anon")
         assertRaisesNothing(self, alg.execute)
 
+    def test_processChunks_calls_python_hooks_one_at_a_time(self):
+        self._check_process_chunks(0)
+
+    def test_processChunks_calls_python_hooks_loading_ahead(self):
+        self._check_process_chunks(1 << 30)
+
+    def _check_process_chunks(self, memory_budget):
+        alg = ChunkedDataProcessor()
+        alg.initialize()
+        alg.setChild(True)
+        alg.setRethrows(True)
+        alg.setProperty("MemoryBudget", memory_budget)
+        alg.setPropertyValue("OutputWorkspace", "__anon")
+        assertRaisesNothing(self, alg.execute)
+        self.assertEqual(alg.processed, [0, 1, 2, 3])
+        self.assertEqual(alg.getProperty("OutputWorkspace").value.readY(0)[0], 10.0)
+
 
 if __name__ == "__main__":
     unittest.main()
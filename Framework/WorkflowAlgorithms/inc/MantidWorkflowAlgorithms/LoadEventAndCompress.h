@@ -26,6 +26,9 @@ public:
 protected:
   API::ITableWorkspace_sptr determineChunk(const std::string &filename) override;
   API::MatrixWorkspace_sptr loadChunk(const size_t rowIndex) override;
+  API::MatrixWorkspace_sptr processChunk(const API::MatrixWorkspace_sptr &chunk, const size_t rowIndex) override;
+  API::MatrixWorkspace_sptr accumulateChunk(const API::MatrixWorkspace_sptr &accumulated,
+                                            const API::MatrixWorkspace_sptr &chunk, const size_t rowIndex) override;
 
 private:
   void init() override;
@@ -14,6 +14,8 @@
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/VisibleWhenProperty.h"
 
+#include <algorithm>
+
 namespace Mantid::WorkflowAlgorithms {
 
 using std::size_t;
@@ -98,6 +100,13 @@ void LoadEventAndCompress::init() {
   auto range = std::make_shared<BoundedValidator<double>>();
   range->setBounds(0., 100.);
   declareProperty("FilterBadPulses", 95., range);
+
+  auto mustBePositive = std::make_shared<BoundedValidator<double>>();
+  mustBePositive->setLower(0.);
+  declareProperty("MemoryBudget", 0., mustBePositive,
+                  "Memory in GiB that the loaded chunks and the output may use. When more than one chunk fits, the "
+                  "next chunks are loaded while the previous one is added to the output. The default of zero loads "
+                  "one chunk at a time.");
 }
 
 /// @see DataProcessorAlgorithm::determineChunk(const std::string &)
@@ -179,6 +188,32 @@ MatrixWorkspace_sptr LoadEventAndCompress::loadChunk(const size_t rowIndex) {
   return std::dynamic_pointer_cast<MatrixWorkspace>(wksp);
 }
 
+/// @see DataProcessorAlgorithm::processChunk(const MatrixWorkspace_sptr &, const size_t)
+MatrixWorkspace_sptr LoadEventAndCompress::processChunk(const MatrixWorkspace_sptr &chunk, const size_t rowIndex) {
+  // only the logs of the first chunk are kept
+  if (rowIndex == 0)
+    return chunk;
+  auto removeLogsAlg = createChildAlgorithm("RemoveLogs");
+  removeLogsAlg->setProperty("Workspace", chunk);
+  removeLogsAlg->executeAsChildAlg();
+  return removeLogsAlg->getProperty("Workspace");
+}
+
+/// @see DataProcessorAlgorithm::accumulateChunk(const MatrixWorkspace_sptr &, const MatrixWorkspace_sptr &, const size_t)
+MatrixWorkspace_sptr LoadEventAndCompress::accumulateChunk(const MatrixWorkspace_sptr &accumulated,
+                                                           const MatrixWorkspace_sptr &chunk, const size_t rowIndex) {
+  UNUSED_ARG(rowIndex);
+  if (!accumulated)
+    return chunk;
+  auto plusAlg = createChildAlgorithm("Plus");
+  plusAlg->setProperty("LHSWorkspace", accumulated);
+  plusAlg->setProperty("RHSWorkspace", chunk);
+  plusAlg->setProperty("OutputWorkspace", accumulated);
+  plusAlg->setProperty("ClearRHSWorkspace", true);
+  plusAlg->executeAsChildAlg();
+  return plusAlg->getProperty("OutputWorkspace");
+}
+
 //----------------------------------------------------------------------------------------------
 /** Execute the algorithm.
  */
@@ -188,37 +223,9 @@ void LoadEventAndCompress::exec() {
 
   m_chunkingTable = determineChunk(filename);
 
-  Progress progress(this, 0.0, 1.0, 2);
-
-  // first run is free
-  progress.report("Loading Chunk");
-  MatrixWorkspace_sptr resultWS = loadChunk(0);
-
-  // load the other chunks
-  const size_t numRows = m_chunkingTable->rowCount();
-
-  progress.resetNumSteps(numRows, 0, 1);
-
-  for (size_t i = 1; i < numRows; ++i) {
-    MatrixWorkspace_sptr temp = loadChunk(i);
-
-    // remove logs
-    auto removeLogsAlg = createChildAlgorithm("RemoveLogs");
-    removeLogsAlg->setProperty("Workspace", temp);
-    removeLogsAlg->executeAsChildAlg();
-    temp = removeLogsAlg->getProperty("Workspace");
-
-    // accumulate data
-    auto plusAlg = createChildAlgorithm("Plus");
-    plusAlg->setProperty("LHSWorkspace", resultWS);
-    plusAlg->setProperty("RHSWorkspace", temp);
-    plusAlg->setProperty("OutputWorkspace", resultWS);
-    plusAlg->setProperty("ClearRHSWorkspace", true);
-    plusAlg->executeAsChildAlg();
-    resultWS = plusAlg->getProperty("OutputWorkspace");
-
-    progress.report();
-  }
+  const double memoryBudget = getProperty("MemoryBudget");
+  MatrixWorkspace_sptr resultWS = processChunks(std::max<size_t>(1, m_chunkingTable->rowCount()),
+                                                static_cast<size_t>(memoryBudget * 1024. * 1024. * 1024.));
 
   // don't assume that any chunk had the correct binning so just reset it here
   EventWorkspace_sptr totalEventWS = std::dynamic_pointer_cast<EventWorkspace>(resultWS);
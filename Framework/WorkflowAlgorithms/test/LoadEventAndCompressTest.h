@@ -87,9 +87,25 @@ public:
     checkAlg->execute();
     TS_ASSERT(checkAlg->getProperty("Result"));
 
+    // run with chunks loaded ahead
+    const std::string WS_NAME_AHEAD("LoadEventAndCompress_ahead");
+    LoadEventAndCompress algLoadingAhead;
+    TS_ASSERT_THROWS_NOTHING(algLoadingAhead.initialize());
+    TS_ASSERT_THROWS_NOTHING(algLoadingAhead.setPropertyValue("Filename", FILENAME));
+    TS_ASSERT_THROWS_NOTHING(algLoadingAhead.setPropertyValue("OutputWorkspace", WS_NAME_AHEAD));
+    TS_ASSERT_THROWS_NOTHING(algLoadingAhead.setProperty("MaxChunkSize", CHUNKSIZE));
+    TS_ASSERT_THROWS_NOTHING(algLoadingAhead.setProperty("MemoryBudget", 1.));
+    TS_ASSERT_THROWS_NOTHING(algLoadingAhead.execute(););
+    TS_ASSERT(algLoadingAhead.isExecuted());
+
+    checkAlg->setPropertyValue("Workspace2", WS_NAME_AHEAD);
+    checkAlg->execute();
+    TS_ASSERT(checkAlg->getProperty("Result"));
+
     // Remove workspace from the data service.
     AnalysisDataService::Instance().remove(WS_NAME_NO_CHUNKS);
     AnalysisDataService::Instance().remove(WS_NAME_CHUNKS);
+    AnalysisDataService::Instance().remove(WS_NAME_AHEAD);
   }
 
   void test_execNoFilter() {
@@ -36,10 +36,15 @@ def handle_testcase(case, suite_name):
     """Handle one test case and save it to DB"""
     # Build the full name (Project.Suite.Case)
     name = case.getAttribute("classname") + "." + case.getAttribute("name")
+    # A failed test has no meaningful time, so it must not be recorded as a timing
+    if case.getElementsByTagName("failure") or case.getElementsByTagName("error") or not case.hasAttribute("time"):
+        print("Skipping", name, "as it did not succeed")
+        return
     try:
         time = float(case.getAttribute("time"))
-    except:
-        time = 0.0
+    except ValueError:
+        print("Skipping", name, "as its time is not a number")
+        return
     try:
         cpu_fraction = float(case.getAttribute("CPUFraction"))
     except: